@@ -45,5 +45,10 @@ void registerNetworkOps(TF& nn) {
     nn.resolver.AddMinimum();
 }
 
+// sample data
+float idle[450] = { -0.3334, 0.0289, -0.0031, -0.3315, 0.0305, -0.0030, -0.3325, 0.0292, -0.0023, -0.3364, 0.0265, -0.0017, -0.3391, 0.0242, -0.0012, -0.3380, 0.0229, -0.0010, -0.3367, 0.0209, -0.0012, -0.3370, 0.0206, -0.0013, -0.3369, 0.0231, -0.0012, -0.3369, 0.0261, -0.0012, -0.3359, 0.0292, -0.0018, -0.3344, 0.0300, -0.0025, -0.3338, 0.0286, -0.0026, -0.3341, 0.0278, -0.0026, -0.3351, 0.0276, -0.0026, -0.3359, 0.0279, -0.0026, -0.3367, 0.0265, -0.0026, -0.3373, 0.0248, -0.0028, -0.3369, 0.0253, -0.0026, -0.3357, 0.0266, -0.0023, -0.3344, 0.0286, -0.0023, -0.3338, 0.0281, -0.0026, -0.3341, 0.0253, -0.0028, -0.3341, 0.0253, -0.0026, -0.3349, 0.0266, -0.0022, -0.3357, 0.0279, -0.0022, -0.3354, 0.0292, -0.0022, -0.3346, 0.0300, -0.0022, -0.3339, 0.0289, -0.0022, -0.3343, 0.0266, -0.0025, -0.3341, 0.0266, -0.0026, -0.3338, 0.0283, -0.0026, -0.3349, 0.0296, -0.0026, -0.3367, 0.0300, -0.0025, -0.3373, 0.0296, -0.0022, -0.3365, 0.0261, -0.0018, -0.3354, 0.0222, -0.0015, -0.3356, 0.0201, -0.0009, -0.3364, 0.0200, -0.0005, -0.3375, 0.0204, -0.0004, -0.3385, 0.0217, -0.0000, -0.3377, 0.0245, -0.0002, -0.3367, 0.0268, -0.0007, -0.3360, 0.0283, -0.0012, -0.3357, 0.0292, -0.0020, -0.3356, 0.0297, -0.0030, -0.3356, 0.0297, -0.0038, -0.3349, 0.0296, -0.0038, -0.3344, 0.0291, -0.0035, -0.3346, 0.0284, -0.0028, -0.3349, 0.0281, -0.0025, -0.3351, 0.0278, -0.0022, -0.3343, 0.0274, -0.0020, -0.3331, 0.0281, -0.0020, -0.3336, 0.0292, -0.0018, -0.3352, 0.0279, -0.0022, -0.3370, 0.0232, -0.0023, -0.3373, 0.0204, -0.0018, -0.3369, 0.0222, -0.0017, -0.3369, 0.0245, -0.0017, -0.3367, 0.0274, -0.0018, -0.3346, 0.0294, -0.0017, -0.3326, 0.0292, -0.0017, -0.3336, 0.0279, -0.0023, -0.3339, 0.0281, -0.0030, -0.3338, 0.0292, -0.0033, -0.3347, 0.0292, -0.0031, -0.3357, 0.0289, -0.0026, -0.3360, 0.0274, -0.0025, -0.3352, 0.0245, -0.0025, -0.3341, 0.0229, -0.0026, -0.3341, 0.0227, -0.0025, -0.3360, 0.0216, -0.0018, -0.3385, 0.0200, -0.0012, -0.3391, 0.0208, -0.0012, -0.3382, 0.0234, -0.0015, -0.3377, 0.0255, -0.0020, -0.3364, 0.0274, -0.0025, -0.3341, 0.0300, -0.0028, -0.3331, 0.0310, -0.0035, -0.3341, 0.0286, -0.0038, -0.3347, 0.0263, -0.0033, -0.3354, 0.0263, -0.0030, -0.3367, 0.0266, -0.0028, -0.3380, 0.0252, -0.0025, -0.3377, 0.0240, -0.0022, -0.3352, 0.0250, -0.0022, -0.3339, 0.0261, -0.0022, -0.3341, 0.0265, -0.0022, -0.3352, 0.0247, -0.0018, -0.3367, 0.0226, -0.0013, -0.3369, 0.0229, -0.0015, -0.3351, 0.0248, -0.0023, -0.3331, 0.0271, -0.0030, -0.3326, 0.0283, -0.0033, -0.3346, 0.0273, -0.0031, -0.3362, 0.0268, -0.0025, -0.3364, 0.0276, -0.0022, -0.3362, 0.0270, -0.0023, -0.3360, 0.0232, -0.0022, -0.3370, 0.0206, -0.0020, -0.3380, 0.0214, -0.0018, -0.3383, 0.0227, -0.0022, -0.3369, 0.0242, -0.0026, -0.3356, 0.0247, -0.0026, -0.3347, 0.0253, -0.0025, -0.3343, 0.0273, -0.0023, -0.3341, 0.0283, -0.0025, -0.3344, 0.0273, -0.0026, -0.3351, 0.0253, -0.0028, -0.3359, 0.0245, -0.0028, -0.3365, 0.0255, -0.0031, -0.3362, 0.0266, -0.0035, -0.3356, 0.0258, -0.0038, -0.3352, 0.0245, -0.0036, -0.3354, 0.0255, -0.0030, -0.3360, 0.0274, -0.0026, -0.3360, 0.0261, -0.0028, -0.3360, 0.0221, -0.0028, -0.3388, 0.0224, -0.0033, -0.3380, 0.0250, -0.0031, -0.3356, 0.0263, -0.0026, -0.3351, 0.0278, -0.0031, -0.3339, 0.0283, -0.0036, -0.3333, 0.0286, -0.0038, -0.3333, 0.0289, -0.0036, -0.3343, 0.0283, -0.0033, -0.3354, 0.0245, -0.0035, -0.3359, 0.0195, -0.0040, -0.3354, 0.0206, -0.0043, -0.3352, 0.0250, -0.0048, -0.3367, 0.0270, -0.0051, -0.3367, 0.0273, -0.0051, -0.3352, 0.0266, -0.0046, -0.3341, 0.0274, -0.0043, -0.3338, 0.0276, -0.0040, -0.3346, 0.0263, -0.0035, -0.3359, 0.0255, -0.0031, -0.3369, 0.0244, -0.0030, -0.3367, 0.0231, -0.0031, -0.3354, 0.0234, -0.0036, -0.3346, 0.0253, -0.0041, -0.3349, 0.0265, -0.0046, -0.3349, 0.0255, -0.0048, -0.3343, 0.0250, -0.0046, -0.3344, 0.0253, -0.0041, -0.3352, 0.0245, -0.0035, -0.3360, 0.0237, -0.0030, -0.3369, 0.0239, -0.0028, -0.3375, 0.0232, -0.0030 };
+float horizontal[450] = { -0.4638, -0.3242, 0.1993, -0.4544, -0.3369, 0.1930, -0.4449, -0.3400, 0.1868, -0.4365, -0.3304, 0.1834, -0.4184, -0.3171, 0.1814, -0.3985, -0.3026, 0.1785, -0.3805, -0.2873, 0.1752, -0.3640, -0.2648, 0.1724, -0.3491, -0.2404, 0.1692, -0.3316, -0.2199, 0.1666, -0.3177, -0.1992, 0.1651, -0.3100, -0.1804, 0.1648, -0.3048, -0.1615, 0.1638, -0.3027, -0.1390, 0.1619, -0.3009, -0.1154, 0.1606, -0.2970, -0.0912, 0.1593, -0.2918, -0.0669, 0.1570, -0.2867, -0.0453, 0.1544, -0.2838, -0.0235, 0.1519, -0.2810, -0.0008, 0.1490, -0.2768, 0.0231, 0.1451, -0.2693, 0.0532, 0.1405, -0.2597, 0.0860, 0.1357, -0.2499, 0.1197, 0.1296, -0.2412, 0.1575, 0.1230, -0.2325, 0.1974, 0.1171, -0.2221, 0.2353, 0.1113, -0.2110, 0.2726, 0.1036, -0.2003, 0.3167, 0.0933, -0.1889, 0.3660, 0.0820, -0.1743, 0.4132, 0.0701, -0.1583, 0.4562, 0.0584, -0.1469, 0.4936, 0.0473, -0.1437, 0.5221, 0.0382, -0.1388, 0.5398, 0.0282, -0.1315, 0.5452, 0.0172, -0.1306, 0.5427, 0.0094, -0.1319, 0.5364, 0.0063, -0.1298, 0.5300, 0.0076, -0.1284, 0.5229, 0.0110, -0.1318, 0.5084, 0.0141, -0.1388, 0.4863, 0.0164, -0.1494, 0.4576, 0.0188, -0.1637, 0.4208, 0.0232, -0.1804, 0.3803, 0.0297, -0.1988, 0.3447, 0.0387, -0.2182, 0.3188, 0.0496, -0.2366, 0.2981, 0.0616, -0.2517, 0.2704, 0.0754, -0.2670, 0.2327, 0.0881, -0.2820, 0.1938, 0.0997, -0.2888, 0.1619, 0.1108, -0.2838, 0.1420, 0.1220, -0.2727, 0.1396, 0.1275, -0.2856, 0.1498, 0.1311, -0.3346, 0.1396, 0.1515, -0.3696, 0.0859, 0.1685, -0.3649, 0.0104, 0.1632, -0.3456, -0.0480, 0.1549, -0.3302, -0.0713, 0.1513, -0.3160, -0.0786, 0.1497, -0.3066, -0.0956, 0.1508, -0.3136, -0.1258, 0.1554, -0.3320, -0.1602, 0.1630, -0.3587, -0.1945, 0.1724, -0.3748, -0.2282, 0.1803, -0.3749, -0.2591, 0.1861, -0.3787, -0.2829, 0.1900, -0.3878, -0.2956, 0.1952, -0.3994, -0.3018, 0.2016, -0.4086, -0.3062, 0.2066, -0.4184, -0.3125, 0.2100, -0.4256, -0.3127, 0.2107, -0.4282, -0.3039, 0.2083, -0.4291, -0.2881, 0.2045, -0.4319, -0.2676, 0.2024, -0.4357, -0.2408, 0.2035, -0.4340, -0.2051, 0.2070, -0.4311, -0.1664, 0.2125, -0.4282, -0.1276, 0.2175, -0.4231, -0.0936, 0.2201, -0.4122, -0.0642, 0.2192, -0.3948, -0.0324, 0.2138, -0.3740, 0.0058, 0.2039, -0.3517, 0.0463, 0.1915, -0.3334, 0.0877, 0.1790, -0.3160, 0.1284, 0.1674, -0.2978, 0.1625, 0.1555, -0.2791, 0.1959, 0.1427, -0.2568, 0.2338, 0.1288, -0.2324, 0.2748, 0.1150, -0.2099, 0.3170, 0.1003, -0.1883, 0.3598, 0.0820, -0.1660, 0.3972, 0.0588, -0.1437, 0.4207, 0.0338, -0.1259, 0.4353, 0.0097, -0.1179, 0.4389, -0.0113, -0.1153, 0.4332, -0.0264, -0.1126, 0.4275, -0.0362, -0.1114, 0.4215, -0.0424, -0.1126, 0.4127, -0.0455, -0.1160, 0.4011, -0.0455, -0.1243, 0.3933, -0.0414, -0.1355, 0.3909, -0.0344, -0.1404, 0.3953, -0.0272, -0.1398, 0.4049, -0.0210, -0.1409, 0.4163, -0.0147, -0.1456, 0.4221, -0.0082, -0.1494, 0.4177, -0.0026, -0.1497, 0.4081, 0.0027, -0.1495, 0.3969, 0.0089, -0.1495, 0.3829, 0.0173, -0.1497, 0.3701, 0.0291, -0.1521, 0.3578, 0.0431, -0.1640, 0.3354, 0.0582, -0.1842, 0.3028, 0.0732, -0.2057, 0.2636, 0.0870, -0.2249, 0.2184, 0.1005, -0.2389, 0.1731, 0.1143, -0.2514, 0.1341, 0.1298, -0.2659, 0.1000, 0.1466, -0.2812, 0.0694, 0.1617, -0.2949, 0.0499, 0.1739, -0.3069, 0.0370, 0.1851, -0.3276, 0.0091, 0.1951, -0.3518, -0.0334, 0.2047, -0.3743, -0.0752, 0.2135, -0.3945, -0.1122, 0.2169, -0.4134, -0.1405, 0.2187, -0.4300, -0.1608, 0.2206, -0.4391, -0.1753, 0.2232, -0.4508, -0.1911, 0.2242, -0.4663, -0.2082, 0.2247, -0.4773, -0.2233, 0.2281, -0.4820, -0.2411, 0.2299, -0.4861, -0.2600, 0.2275, -0.4900, -0.2774, 0.2226, -0.4881, -0.2923, 0.2179, -0.4786, -0.3031, 0.2130, -0.4669, -0.3033, 0.2073, -0.4536, -0.2958, 0.2011, -0.4347, -0.2819, 0.1944, -0.4116, -0.2609, 0.1879, -0.3881, -0.2359, 0.1824, -0.3642, -0.2053, 0.1785, -0.3430, -0.1729, 0.1754, -0.3240, -0.1437, 0.1720, -0.3069, -0.1166, 0.1684, -0.2932, -0.0936, 0.1646, -0.2838, -0.0734, 0.1594 };
+float vertical[450] = { -0.5387, 0.1786, 0.0916, -0.6150, 0.1673, 0.1033, -0.6876, 0.1510, 0.1156, -0.7535, 0.1344, 0.1272, -0.8173, 0.1166, 0.1376, -0.8772, 0.0886, 0.1458, -0.9124, 0.0748, 0.1488, -0.9212, 0.0701, 0.1516, -0.9368, 0.0598, 0.1555, -0.9498, 0.0567, 0.1589, -0.9444, 0.0623, 0.1628, -0.9234, 0.0755, 0.1651, -0.8875, 0.0867, 0.1645, -0.8354, 0.0981, 0.1593, -0.7742, 0.1139, 0.1524, -0.7153, 0.1261, 0.1451, -0.6629, 0.1306, 0.1357, -0.6201, 0.1287, 0.1262, -0.5838, 0.1199, 0.1186, -0.5484, 0.1049, 0.1126, -0.5148, 0.0891, 0.1059, -0.4842, 0.0732, 0.0982, -0.4523, 0.0602, 0.0906, -0.4160, 0.0470, 0.0846, -0.3714, 0.0359, 0.0787, -0.3193, 0.0344, 0.0704, -0.2670, 0.0419, 0.0595, -0.2161, 0.0528, 0.0468, -0.1691, 0.0566, 0.0343, -0.1319, 0.0634, 0.0196, -0.1031, 0.0729, 0.0051, -0.0756, 0.0769, -0.0046, -0.0471, 0.0795, -0.0131, -0.0229, 0.0769, -0.0232, -0.0050, 0.0676, -0.0328, 0.0113, 0.0502, -0.0393, 0.0241, 0.0323, -0.0450, 0.0350, 0.0167, -0.0502, 0.0449, 0.0017, -0.0531, 0.0495, -0.0103, -0.0533, 0.0503, -0.0170, -0.0510, 0.0480, -0.0150, -0.0459, 0.0415, -0.0069, -0.0383, 0.0336, -0.0000, -0.0297, 0.0239, -0.0015, -0.0227, 0.0093, -0.0100, -0.0176, -0.0042, -0.0191, -0.0131, -0.0126, -0.0238, -0.0085, -0.0232, -0.0262, -0.0036, -0.0382, -0.0292, 0.0030, -0.0543, -0.0339, 0.0102, -0.0696, -0.0389, 0.0157, -0.0821, -0.0402, 0.0195, -0.0934, -0.0350, 0.0227, -0.1052, -0.0213, 0.0269, -0.1181, -0.0004, 0.0323, -0.1284, 0.0265, 0.0388, -0.1409, 0.0527, 0.0439, -0.1650, 0.0753, 0.0474, -0.2068, 0.0960, 0.0527, -0.2262, 0.0961, 0.0626, -0.2644, 0.1108, 0.0652, -0.3168, 0.1314, 0.0655, -0.3609, 0.1349, 0.0725, -0.4247, 0.1401, 0.0798, -0.4861, 0.1352, 0.0906, -0.5576, 0.1238, 0.1015, -0.6331, 0.1087, 0.1130, -0.7120, 0.0956, 0.1238, -0.7760, 0.0789, 0.1339, -0.8230, 0.0663, 0.1433, -0.8611, 0.0605, 0.1492, -0.8878, 0.0572, 0.1541, -0.8979, 0.0657, 0.1581, -0.8951, 0.0660, 0.1625, -0.9029, 0.0541, 0.1664, -0.9016, 0.0491, 0.1681, -0.8821, 0.0468, 0.1687, -0.8590, 0.0460, 0.1684, -0.8225, 0.0484, 0.1679, -0.7770, 0.0496, 0.1661, -0.7317, 0.0497, 0.1620, -0.6878, 0.0512, 0.1558, -0.6427, 0.0540, 0.1487, -0.5974, 0.0593, 0.1422, -0.5530, 0.0620, 0.1349, -0.5082, 0.0621, 0.1262, -0.4636, 0.0628, 0.1166, -0.4213, 0.0610, 0.1078, -0.3829, 0.0605, 0.0995, -0.3354, 0.0519, 0.0922, -0.2830, 0.0397, 0.0847, -0.2394, 0.0359, 0.0753, -0.2031, 0.0305, 0.0640, -0.1695, 0.0182, 0.0502, -0.1326, 0.0151, 0.0346, -0.0869, 0.0187, 0.0193, -0.0414, 0.0118, 0.0032, -0.0086, 0.0008, -0.0140, 0.0173, -0.0101, -0.0292, 0.0430, -0.0155, -0.0419, 0.0718, -0.0157, -0.0529, 0.1011, -0.0212, -0.0606, 0.1244, -0.0340, -0.0640, 0.1384, -0.0515, -0.0669, 0.1376, -0.0744, -0.0681, 0.1195, -0.0939, -0.0651, 0.0902, -0.1005, -0.0578, 0.0500, -0.0918, -0.0461, 0.0111, -0.0723, -0.0316, -0.0156, -0.0448, -0.0175, -0.0364, -0.0122, -0.0053, -0.0527, 0.0161, 0.0053, -0.0613, 0.0340, 0.0141, -0.0652, 0.0460, 0.0199, -0.0694, 0.0528, 0.0224, -0.0753, 0.0556, 0.0225, -0.0831, 0.0603, 0.0245, -0.1023, 0.0712, 0.0308, -0.1368, 0.0859, 0.0385, -0.1712, 0.0939, 0.0440, -0.1962, 0.0973, 0.0455, -0.2088, 0.0838, 0.0504, -0.2324, 0.0872, 0.0496, -0.2542, 0.0870, 0.0445, -0.2685, 0.0703, 0.0445, -0.2901, 0.0621, 0.0431, -0.2968, 0.0410, 0.0471, -0.3167, 0.0255, 0.0585, -0.3644, 0.0222, 0.0745, -0.4148, 0.0437, 0.0717, -0.4622, 0.0803, 0.0273, -0.5445, 0.0794, -0.0079, -0.6842, 0.0440, 0.0237, -0.8333, 0.0216, 0.0992, -0.9581, 0.0257, 0.1858, -1.0000, 0.0738, 0.2670, -1.0000, 0.1581, 0.3233, -1.0000, 0.2535, 0.3445, -1.0000, 0.3333, 0.3417, -1.0000, 0.3915, 0.3193, -0.9859, 0.4314, 0.2779, -0.8331, 0.4270, 0.2291, -0.6754, 0.3801, 0.1840, -0.5463, 0.3095, 0.1471, -0.4643, 0.2306, 0.1114, -0.4247, 0.1570, 0.0831, -0.4067, 0.0976, 0.0701, -0.3966, 0.0496, 0.0642, -0.3878, 0.0152, 0.0600 };
+
 // model data
 const unsigned char tfModel[15104] DATA_ALIGN_ATTRIBUTE = { 0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x88, 0x2b, 0x00, 0x00, 0x98, 0x2b, 0x00, 0x00, 0x7c, 0x3a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0xd4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x98, 0x2a, 0x00, 0x00, 0x58, 0x2a, 0x00, 0x00, 0xc8, 0x29, 0x00, 0x00, 0xac, 0x29, 0x00, 0x00, 0x5c, 0x27, 0x00, 0x00, 0x0c, 0x25, 0x00, 0x00, 0xbc, 0x22, 0x00, 0x00, 0x6c, 0x20, 0x00, 0x00, 0x2c, 0x20, 0x00, 0x00, 0xec, 0x1f, 0x00, 0x00, 0xac, 0x1f, 0x00, 0x00, 0x6c, 0x1f, 0x00, 0x00, 0xcc, 0x1e, 0x00, 0x00, 0x2c, 0x1e, 0x00, 0x00, 0x8c, 0x1d, 0x00, 0x00, 0xec, 0x1c, 0x00, 0x00, 0x9c, 0x1a, 0x00, 0x00, 0x4c, 0x18, 0x00, 0x00, 0xfc, 0x15, 0x00, 0x00, 0xac, 0x13, 0x00, 0x00, 0x6c, 0x13, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x00, 0xec, 0x12, 0x00, 0x00, 0xac, 0x12, 0x00, 0x00, 0x5c, 0x10, 0x00, 0x00, 0x0c, 0x0e, 0x00, 0x00, 0xbc, 0x0b, 0x00, 0x00, 0x6c, 0x09, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8a, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x35, 0x2e, 0x30, 0x00, 0x00, 0xea, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x33, 0x2e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc7, 0xff, 0xff, 0xc4, 0xc7, 0xff, 0xff, 0xc8, 0xc7, 0xff, 0xff, 0xcc, 0xc7, 0xff, 0xff, 0xd0, 0xc7, 0xff, 0xff, 0x1a, 0xd6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xd6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xc8, 0xff, 0xff, 0x96, 0xd6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xea, 0xd6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xac, 0x52, 0xc3, 0x3e, 0x56, 0x24, 0x51, 0xbe, 0x11, 0x55, 0xc9, 0xbc, 0xa0, 0xb9, 0xd7, 0xbd, 0xb4, 0x78, 0x70, 0x3e, 0x11, 0x89, 0x32, 0x3e, 0xfe, 0x16, 0xb9, 0x3e, 0x24, 0xbe, 0xa0, 0xbe, 0x12, 0x6f, 0xda, 0x3d, 0x9d, 0x9a, 0x6e, 0x3e, 0xa4, 0xbf, 0x95, 0x3e, 0x7e, 0xb4, 0x87, 0xbe, 0x00, 0xa3, 0x2b, 0x3c, 0xc7, 0x1c, 0x83, 0xbe, 0xbd, 0x3c, 0xa2, 0xbe, 0xe6, 0x4f, 0x64, 0x3e, 0x23, 0xde, 0xb8, 0x3e, 0xc3, 0x98, 0xe7, 0xbd, 0x05, 0xa8, 0x74, 0x3d, 0x0f, 0x12, 0x9b, 0xbe, 0xf2, 0x0c, 0x35, 0x3e, 0x26, 0x59, 0xa6, 0xbd, 0xee, 0xa4, 0xbd, 0xbe, 0x72, 0xcf, 0xc4, 0xbe, 0x84, 0x9a, 0xe0, 0xbd, 0x63, 0x01, 0x0f, 0x3f, 0x50, 0xe3, 0x7e, 0xbe, 0xaa, 0xff, 0x9e, 0x3e, 0x0f, 0x4b, 0x06, 0xbe, 0x3a, 0xdc, 0xbc, 0x3e, 0xdc, 0x9d, 0xbd, 0x3e, 0x70, 0xd8, 0xd8, 0xbe, 0x83, 0x0d, 0x9d, 0xbe, 0xe7, 0xe7, 0xdd, 0x3e, 0xc4, 0xee, 0x5f, 0x3e, 0xd0, 0x52, 0x2e, 0x3e, 0x7b, 0x08, 0xd5, 0xbc, 0x3a, 0xa0, 0x06, 0xbe, 0x50, 0xaf, 0x2b, 0x3e, 0xb6, 0xb9, 0x3d, 0x3e, 0x5d, 0xe5, 0xf9, 0xbe, 0x3c, 0xb7, 0xab, 0x3e, 0xfb, 0x1e, 0x10, 0xbd, 0x49, 0xbd, 0xbc, 0x3d, 0x32, 0x06, 0xf2, 0xbd, 0x04, 0x9e, 0x6c, 0x3e, 0x5c, 0xd5, 0xc1, 0x3e, 0x09, 0xe2, 0xa7, 0x3c, 0xdf, 0xdd, 0x17, 0x3c, 0x46, 0xbb, 0xe4, 0xbe, 0x43, 0xb1, 0xc8, 0x3e, 0xc2, 0x91, 0x40, 0x3e, 0xc9, 0x46, 0xc9, 0x3e, 0x7c, 0xc9, 0xb2, 0x3c, 0xd9, 0x24, 0xc4, 0x3e, 0xb0, 0x75, 0xbf, 0xbe, 0x4b, 0x29, 0x76, 0x3e, 0x5a, 0x8f, 0x08, 0xbf, 0x52, 0x5f, 0x0e, 0xbf, 0x98, 0xf5, 0x02, 0xbf, 0xfb, 0x44, 0x25, 0x3e, 0x65, 0x44, 0xea, 0xbe, 0xd5, 0xd7, 0xf4, 0x3c, 0x0f, 0x2b, 0xb6, 0xbe, 0x33, 0x18, 0xbb, 0x3e, 0x81, 0xdc, 0x4c, 0xbe, 0x94, 0xb6, 0xa8, 0x3e, 0xe0, 0xfb, 0xb1, 0x3e, 0x1e, 0xe6, 0xac, 0xbe, 0x6f, 0x40, 0x4b, 0x3e, 0x97, 0x89, 0xf4, 0xbe, 0xa4, 0x17, 0xd3, 0x3d, 0xdc, 0x94, 0x88, 0xbc, 0xea, 0xb9, 0x65, 0xbe, 0x20, 0x8a, 0xfb, 0xbd, 0x65, 0xed, 0xfb, 0x3e, 0x77, 0x07, 0x98, 0x3e, 0x7f, 0xd5, 0xf5, 0xbd, 0x8c, 0x0e, 0xd7, 0xbd, 0x12, 0x3f, 0x97, 0x3e, 0xe4, 0xf0, 0x05, 0x3e, 0x64, 0x24, 0x02, 0x3e, 0xf0, 0xc5, 0x9c, 0xbe, 0x02, 0x98, 0xcf, 0x3c, 0x5c, 0x8c, 0x8f, 0xbe, 0xd3, 0x97, 0x38, 0x3e, 0x2c, 0xe5, 0x3e, 0x3e, 0x85, 0xb2, 0x0c, 0x3f, 0xe6, 0x19, 0x09, 0xbf, 0xf5, 0x32, 0x81, 0xbe, 0xc8, 0x4a, 0xab, 0x3d, 0xa4, 0xe3, 0x05, 0x3e, 0x6f, 0x54, 0x79, 0xbd, 0xc5, 0x48, 0xc1, 0xbe, 0x51, 0x2b, 0xb9, 0xbe, 0x09, 0x24, 0x04, 0x3f, 0xa6, 0xd8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x87, 0x53, 0x9f, 0xbb, 0x38, 0xd1, 0x85, 0x3e, 0x67, 0xcd, 0x1b, 0x3c, 0x2d, 0x87, 0x25, 0x3e, 0x73, 0x46, 0xda, 0x3d, 0xae, 0xbb, 0x94, 0x3d, 0xe9, 0xfb, 0xf4, 0xbb, 0x5e, 0x8f, 0x3b, 0x3e, 0xd4, 0x82, 0x5a, 0x3e, 0xc9, 0x92, 0x6d, 0x3e, 0x96, 0xe5, 0x90, 0xbe, 0x2c, 0x34, 0x74, 0x3e, 0x1b, 0x5c, 0x34, 0xbc, 0x9e, 0x9f, 0x35, 0x3d, 0x7d, 0x2e, 0xa2, 0x3e, 0x83, 0x34, 0x24, 0xbe, 0x11, 0x05, 0xda, 0x3e, 0xec, 0xa7, 0xa3, 0xbe, 0x5c, 0x8e, 0xd3, 0xbd, 0x48, 0x16, 0xcc, 0x3c, 0xe2, 0x7e, 0x7d, 0xbe, 0x6e, 0xa0, 0x1c, 0x3e, 0x7d, 0xa6, 0x86, 0xbc, 0x6e, 0x89, 0xe8, 0xbd, 0x7e, 0x21, 0x2d, 0xbe, 0x7b, 0xa6, 0x28, 0x3e, 0x57, 0x82, 0x56, 0x3e, 0x19, 0x67, 0x03, 0x3e, 0x25, 0x26, 0xc3, 0xbd, 0xa2, 0xb9, 0xa4, 0xbe, 0xd6, 0xe0, 0x64, 0xbd, 0x98, 0x62, 0x53, 0xbe, 0xb7, 0x2b, 0x85, 0x3e, 0x18, 0x6a, 0xc5, 0xbc, 0x9b, 0x82, 0x9e, 0x3e, 0x85, 0x42, 0xe7, 0x3d, 0xcc, 0x23, 0xa6, 0xbe, 0xaf, 0x37, 0xa0, 0xbe, 0x92, 0x95, 0x94, 0xbd, 0x07, 0xa5, 0x04, 0xbd, 0x0a, 0x2e, 0x00, 0xbe, 0xa9, 0x64, 0xf9, 0x3d, 0x75, 0x6e, 0x60, 0x3c, 0xeb, 0xb9, 0xb3, 0xbd, 0xcf, 0x88, 0xa5, 0xbd, 0xeb, 0x55, 0xa5, 0x3c, 0x4f, 0x3b, 0x40, 0x3d, 0x22, 0xb2, 0x3a, 0x3e, 0x54, 0x2f, 0xd4, 0xbe, 0x72, 0x11, 0x31, 0x3e, 0x01, 0xec, 0x50, 0x3d, 0x26, 0xe8, 0x8c, 0xbe, 0xa4, 0xbc, 0x16, 0xbe, 0xfd, 0x24, 0x01, 0x3c, 0xf7, 0x81, 0x8d, 0xbe, 0x5c, 0xd6, 0x6a, 0xbe, 0xc4, 0xb0, 0xb1, 0xbe, 0x71, 0x3d, 0x16, 0x3e, 0xab, 0x82, 0x98, 0xbe, 0x1f, 0x81, 0x29, 0xbc, 0x4d, 0x7b, 0x0c, 0x3e, 0x9b, 0x3f, 0xc5, 0x3d, 0x0a, 0xc5, 0x3f, 0xbd, 0xd6, 0x49, 0x5b, 0x3e, 0xb9, 0xe3, 0x88, 0x3e, 0x83, 0x7e, 0xd5, 0x3e, 0x68, 0x4e, 0xbc, 0xbe, 0x58, 0xe7, 0x2a, 0xbe, 0xc3, 0x6d, 0x0a, 0x3e, 0xcc, 0x66, 0x16, 0x3e, 0x57, 0xa1, 0xcf, 0xbe, 0x47, 0x65, 0xa7, 0x3e, 0x8a, 0x3f, 0xf2, 0x3d, 0x84, 0x19, 0x52, 0x3e, 0x8e, 0x37, 0xba, 0x3d, 0xce, 0x8b, 0x3f, 0xba, 0xfd, 0x19, 0x0e, 0xbe, 0xd1, 0x80, 0x23, 0x3c, 0xdd, 0x0e, 0x4a, 0x3d, 0x5c, 0x0c, 0x77, 0x3e, 0x6e, 0x18, 0x83, 0xbd, 0xc4, 0x42, 0x35, 0xbe, 0xde, 0x3a, 0x32, 0x3e, 0xed, 0xdf, 0x31, 0x3e, 0x2f, 0x29, 0xad, 0x3e, 0x39, 0x97, 0x9e, 0xbe, 0xc0, 0x2a, 0x3c, 0x3c, 0x1c, 0x39, 0x99, 0xbe, 0x72, 0x83, 0x02, 0xbe, 0x03, 0x8e, 0xbc, 0xbe, 0xc8, 0x69, 0xf3, 0x3d, 0x20, 0x86, 0xb3, 0xbe, 0x00, 0xd9, 0x83, 0xbc, 0xb2, 0x54, 0x48, 0x3e, 0x64, 0x00, 0xfa, 0x3d, 0x88, 0xa7, 0x9b, 0x3d, 0x13, 0x58, 0xd5, 0xbd, 0x97, 0xf5, 0xac, 0x3d, 0x43, 0x23, 0x84, 0x3e, 0xb3, 0x1d, 0xfb, 0x3d, 0xbf, 0x69, 0xa6, 0xbd, 0xfe, 0x58, 0x5f, 0x3e, 0xf9, 0x25, 0xb5, 0xbd, 0xdc, 0xfa, 0xbb, 0x3e, 0xb2, 0x9a, 0x80, 0x3c, 0x68, 0x0f, 0x94, 0x3d, 0x52, 0xde, 0x3b, 0xbc, 0x41, 0x4a, 0x82, 0x3e, 0x78, 0x50, 0x86, 0xbe, 0x5a, 0xc3, 0xb0, 0x3e, 0x8e, 0x7c, 0x80, 0xbd, 0x22, 0xbc, 0xe4, 0x3d, 0xc4, 0x7f, 0xe8, 0x3e, 0x08, 0x30, 0x0b, 0xbe, 0xaa, 0xf5, 0xf8, 0xbe, 0xd4, 0x25, 0x38, 0xbe, 0xe9, 0xfa, 0xe7, 0xbd, 0x6c, 0xcf, 0xee, 0xbe, 0x5a, 0x69, 0xd9, 0xbe, 0x1a, 0x03, 0xfc, 0x3d, 0xc2, 0xf9, 0xf2, 0xbc, 0x38, 0xb2, 0x74, 0x3e, 0xa5, 0x8a, 0x20, 0xbe, 0x81, 0x7b, 0x0b, 0xbd, 0x6f, 0x07, 0x92, 0x3e, 0x5f, 0x1c, 0x0f, 0x3e, 0x6a, 0xe0, 0x90, 0x3e, 0x8a, 0x17, 0x6a, 0xbc, 0x5d, 0xb9, 0x84, 0x3e, 0xbd, 0xe8, 0x8c, 0x3e, 0x8f, 0x9b, 0xfa, 0xbd, 0x77, 0x28, 0x20, 0x3e, 0xcb, 0x48, 0x99, 0x3e, 0x34, 0x8b, 0xd3, 0xbd, 0x76, 0x4c, 0x94, 0xbe, 0x17, 0xbb, 0x78, 0x3e, 0xf4, 0x96, 0x3c, 0x3d, 0xa8, 0x47, 0xcb, 0x3e, 0x9e, 0x7d, 0xaf, 0xbe, 0x1d, 0x8c, 0xc5, 0xbc, 0x7d, 0xbd, 0xb7, 0xbd, 0x17, 0x5d, 0xc4, 0x3e, 0x66, 0x48, 0xf4, 0xbd, 0x27, 0x85, 0xc3, 0xbe, 0xf1, 0x61, 0x47, 0x3e, 0xc1, 0x87, 0xf7, 0x3d, 0x6c, 0x3c, 0x99, 0xbe, 0xaf, 0xf8, 0x76, 0xbe, 0x90, 0x0b, 0x91, 0xbe, 0x9e, 0xae, 0xfd, 0x3e, 0x0b, 0x90, 0x8a, 0xbe, 0xef, 0x15, 0xc6, 0x3b, 0x04, 0x26, 0x2c, 0x3e, 0x5a, 0x34, 0xb4, 0x3d, 0xe6, 0xb8, 0xa1, 0xbe, 0xa9, 0x36, 0xe8, 0xbe, 0x81, 0x4b, 0x43, 0xbe, 0x2b, 0x5a, 0xb9, 0xbd, 0x71, 0x74, 0x42, 0x3e, 0x2c, 0xd6, 0x67, 0xbe, 0xa3, 0xe5, 0xa4, 0xbc, 0x50, 0xdc, 0x01, 0xbf, 0xe8, 0x7b, 0xc0, 0x3c, 0xf0, 0x33, 0x1b, 0xbe, 0x82, 0x12, 0xc6, 0xbd, 0x45, 0x9e, 0x98, 0xbe, 0x9a, 0x8d, 0x05, 0xbe, 0xd0, 0xf5, 0xc1, 0xbe, 0xb5, 0x0e, 0x9a, 0xbd, 0x93, 0xfd, 0xbd, 0x3d, 0x89, 0x09, 0x40, 0xbe, 0x34, 0xca, 0xe5, 0xbc, 0x9e, 0xec, 0xd8, 0xbd, 0xbc, 0x0c, 0x97, 0x3e, 0x44, 0x5a, 0x8b, 0x3c, 0x2d, 0xc2, 0x29, 0xbe, 0xd6, 0xb3, 0xae, 0x3e, 0x50, 0xa3, 0x1c, 0xbe, 0x27, 0xe3, 0x8c, 0x3e, 0x94, 0xab, 0x99, 0x3d, 0xb7, 0xa3, 0x5c, 0x3e, 0xa0, 0x6d, 0xf0, 0x3d, 0x4f, 0xa2, 0x29, 0xbe, 0x0c, 0xd2, 0x01, 0xbe, 0x63, 0xbc, 0x93, 0xbe, 0x7b, 0x8a, 0xb6, 0x3e, 0xe5, 0x84, 0x4a, 0xbe, 0x38, 0x4c, 0x08, 0x3e, 0xc6, 0xd9, 0xa4, 0xbb, 0x94, 0x70, 0x85, 0x3e, 0x83, 0xfe, 0x01, 0xbe, 0xc1, 0xd8, 0xa0, 0x3e, 0x2b, 0x65, 0xaa, 0x3d, 0x6d, 0x81, 0xc0, 0x3e, 0x1a, 0xe0, 0x93, 0x3c, 0xee, 0x8d, 0xf9, 0xbd, 0xf6, 0x00, 0x70, 0x3e, 0x0a, 0x53, 0xdd, 0x3d, 0x87, 0x32, 0xa4, 0x3e, 0x3f, 0x0b, 0x45, 0x3e, 0x49, 0x52, 0xe1, 0xbe, 0x59, 0xdd, 0x34, 0x3e, 0x37, 0x4d, 0x17, 0xbc, 0x57, 0xc9, 0x6d, 0xbc, 0x53, 0xfd, 0x73, 0x3e, 0xd5, 0x2d, 0x53, 0x3e, 0x80, 0x30, 0x43, 0x3d, 0x0e, 0xbd, 0x8d, 0x3e, 0xe6, 0xe8, 0x6a, 0x3d, 0x0b, 0xb3, 0x5a, 0x3e, 0x77, 0x0e, 0x77, 0x3d, 0xd2, 0x0a, 0x76, 0x3e, 0x0f, 0x86, 0xb8, 0xbe, 0x06, 0x9e, 0x27, 0xbe, 0x74, 0xdc, 0x57, 0x3e, 0x48, 0xed, 0x9c, 0xbe, 0x57, 0xb6, 0x55, 0x3e, 0xa4, 0x0f, 0xf6, 0x3d, 0x1f, 0xed, 0x29, 0xbe, 0x5e, 0xff, 0xbd, 0x3d, 0x94, 0x31, 0xaf, 0x3e, 0x30, 0xa2, 0x48, 0x3a, 0xbb, 0x4d, 0xd1, 0x3b, 0xf4, 0xe7, 0x30, 0xbe, 0x83, 0x6d, 0x6b, 0x3e, 0x73, 0x6b, 0x8c, 0xbe, 0x95, 0xb0, 0x89, 0x3e, 0xfb, 0xd4, 0x41, 0x3c, 0xdb, 0xf0, 0x51, 0xbe, 0x11, 0x5c, 0x99, 0x3e, 0x81, 0x48, 0x68, 0xbe, 0xbf, 0x85, 0x41, 0xbe, 0xab, 0x54, 0xb8, 0xbe, 0xf1, 0x3d, 0x0d, 0x3e, 0x46, 0x4f, 0x8f, 0x3d, 0x15, 0x76, 0xc3, 0xbe, 0x72, 0x2a, 0xb7, 0x3e, 0x9a, 0x55, 0xdb, 0x3d, 0x9a, 0x91, 0x7f, 0x3e, 0x96, 0xde, 0x97, 0x3e, 0x48, 0xb8, 0xee, 0xbe, 0xc1, 0xd1, 0x9a, 0x3e, 0xaf, 0x66, 0x9b, 0x3e, 0x77, 0xf9, 0x2d, 0x3e, 0x65, 0x21, 0x96, 0x3e, 0x11, 0xc2, 0xba, 0xbe, 0x94, 0x6c, 0x3b, 0xbd, 0x01, 0x6d, 0x3c, 0xbd, 0x3c, 0xd5, 0x72, 0xbe, 0xbd, 0xb7, 0xf5, 0xbe, 0x1b, 0x55, 0x23, 0x3e, 0x05, 0x9f, 0xbb, 0xbe, 0x45, 0x6b, 0x96, 0x3e, 0x17, 0x43, 0x3b, 0xbd, 0x9b, 0x68, 0x3b, 0xbe, 0x16, 0xf2, 0xc8, 0x3e, 0xcb, 0x85, 0xc3, 0xbe, 0xc9, 0xb5, 0x72, 0xbe, 0xbf, 0x4d, 0x75, 0xbd, 0x38, 0xd8, 0x14, 0xbe, 0x6d, 0x79, 0xda, 0xbd, 0x83, 0xc3, 0xed, 0xbd, 0x44, 0xfb, 0x85, 0x3e, 0x3d, 0x7a, 0xc0, 0xbe, 0xfd, 0x63, 0x0e, 0xbe, 0xa6, 0x6f, 0x9a, 0xbe, 0xfb, 0x1b, 0xb9, 0xbd, 0x88, 0x23, 0xe7, 0xbe, 0xf4, 0xdb, 0x22, 0x3e, 0x70, 0x33, 0x38, 0x3e, 0xbc, 0xad, 0xb3, 0xbd, 0x58, 0x11, 0x15, 0x3c, 0x48, 0x46, 0x07, 0x3e, 0x2a, 0xca, 0xe3, 0xbc, 0x25, 0x5e, 0xfa, 0x3d, 0xdc, 0x9f, 0xfc, 0xbe, 0xa6, 0x32, 0xe0, 0x3d, 0x01, 0xaa, 0xa2, 0x3e, 0x57, 0xdf, 0xa2, 0xbe, 0xa4, 0x10, 0x63, 0x3e, 0x41, 0xab, 0xea, 0xbd, 0x37, 0xfe, 0x60, 0x3e, 0xd6, 0x4f, 0x84, 0x3d, 0xf1, 0x3f, 0x75, 0x3e, 0x64, 0x0e, 0x2f, 0xbe, 0x1a, 0xc8, 0xba, 0x3e, 0x72, 0x4e, 0xac, 0xbe, 0x9d, 0xde, 0xd8, 0xbe, 0x12, 0x75, 0x06, 0xbf, 0x22, 0x4b, 0xa7, 0x3e, 0x54, 0x61, 0x27, 0x3e, 0xc5, 0xe9, 0x26, 0xbe, 0x52, 0xb6, 0x7f, 0xbd, 0xb0, 0x76, 0x03, 0xbf, 0x28, 0x4c, 0xa7, 0xbe, 0xd3, 0xba, 0xa0, 0xbd, 0x62, 0x05, 0x52, 0x3e, 0x86, 0xe2, 0x8a, 0xbd, 0xbb, 0xeb, 0x3c, 0xbe, 0x1e, 0x38, 0x66, 0xbe, 0xee, 0xb1, 0x09, 0x3e, 0xaa, 0xd6, 0xcc, 0x3e, 0x7e, 0x4c, 0xb0, 0x3e, 0xab, 0x71, 0x49, 0x3e, 0x0a, 0x92, 0x60, 0x3e, 0x4a, 0x9c, 0xa7, 0x3e, 0x08, 0xa2, 0xa2, 0xbe, 0xdc, 0xdc, 0x28, 0x3c, 0x39, 0xfe, 0x74, 0x3d, 0x96, 0x3e, 0xc6, 0x3d, 0xe1, 0x66, 0x2f, 0x3e, 0xd2, 0x7f, 0xe3, 0x3e, 0x1c, 0x93, 0x8f, 0xbe, 0x56, 0x53, 0x11, 0x3e, 0x88, 0xfd, 0x48, 0x3d, 0x45, 0xdb, 0xac, 0x3e, 0x9c, 0xbd, 0x1a, 0xbc, 0x9e, 0x6f, 0x18, 0x3e, 0x3f, 0x9a, 0xc7, 0x3e, 0x65, 0x10, 0x9a, 0x3e, 0x48, 0xa2, 0x18, 0x3e, 0x71, 0x9d, 0xa2, 0xbc, 0x19, 0x29, 0xff, 0xbd, 0x9a, 0xaf, 0xa1, 0x3e, 0x2a, 0x6d, 0x82, 0x3e, 0x73, 0xbb, 0x39, 0x3e, 0xab, 0xfa, 0xb9, 0x3b, 0x39, 0xaf, 0x4e, 0xbe, 0x24, 0xf0, 0x17, 0xbe, 0xfa, 0xc1, 0xac, 0x3e, 0xee, 0x83, 0x93, 0xbe, 0x32, 0xf2, 0x8c, 0x3e, 0x28, 0x09, 0xa0, 0xbe, 0x04, 0x5b, 0x24, 0xbe, 0x83, 0xb9, 0x87, 0x3e, 0x9d, 0xb2, 0xf7, 0xbd, 0x43, 0xaf, 0x15, 0x3e, 0xba, 0x1c, 0xcf, 0xbe, 0x77, 0x92, 0xe2, 0x3d, 0x6a, 0x90, 0x70, 0x3d, 0x67, 0x27, 0x97, 0xbe, 0x90, 0x02, 0xd2, 0x3d, 0xf8, 0x88, 0x0d, 0x3d, 0xfa, 0xd6, 0xda, 0xbd, 0x2e, 0xc0, 0xa3, 0x3e, 0x67, 0x38, 0x83, 0x3e, 0xe4, 0x9d, 0x76, 0xbe, 0xf1, 0x0f, 0xa9, 0x3e, 0x09, 0xbb, 0x12, 0x3e, 0x3f, 0x86, 0xb1, 0x3e, 0x3c, 0x43, 0xc1, 0x3c, 0xfa, 0xbb, 0xda, 0xbd, 0xf6, 0xa0, 0xa6, 0x3d, 0xcf, 0xe6, 0x97, 0x3e, 0x9d, 0x5d, 0xb1, 0x3e, 0x08, 0xb1, 0x4b, 0xbe, 0x24, 0xe6, 0x65, 0xbe, 0x52, 0x7b, 0xc7, 0xbe, 0x72, 0x10, 0x2d, 0x3e, 0xd1, 0x1c, 0xad, 0x3d, 0x98, 0x28, 0x62, 0x3e, 0x45, 0xff, 0x9c, 0x3d, 0x53, 0x8f, 0x1f, 0xbe, 0xff, 0x83, 0xbf, 0xbe, 0xc4, 0x97, 0x61, 0xbe, 0x49, 0x95, 0x5d, 0x3e, 0xaa, 0x6a, 0xa1, 0xbe, 0xa7, 0xd0, 0xa8, 0xbe, 0xc8, 0x5d, 0x34, 0x3e, 0xe5, 0x38, 0x95, 0xbd, 0xf0, 0xe7, 0x40, 0xbe, 0x23, 0x41, 0xc7, 0x3e, 0xe4, 0xd1, 0x93, 0x3e, 0xa7, 0xa7, 0x20, 0x3e, 0x03, 0x1b, 0x0c, 0x3e, 0x6d, 0x42, 0xb9, 0x3e, 0x5f, 0x71, 0x8a, 0xbe, 0x83, 0x7f, 0x5f, 0xbe, 0xf5, 0xd7, 0xaa, 0xbe, 0xd6, 0x41, 0x45, 0x3e, 0x64, 0x95, 0x0b, 0x3e, 0x32, 0x03, 0x5c, 0x3e, 0xf8, 0xdc, 0xa0, 0x3d, 0xde, 0x99, 0xe3, 0xbe, 0xb2, 0xde, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x98, 0xd5, 0x92, 0x3e, 0x6a, 0x13, 0x8e, 0x3c, 0xcb, 0xbd, 0x24, 0xbe, 0x9f, 0xd6, 0xad, 0x3d, 0x75, 0x8b, 0x5f, 0xbd, 0x0b, 0x02, 0x78, 0xbe, 0xc1, 0x0c, 0x85, 0x3e, 0xea, 0x48, 0x1d, 0x3e, 0x1a, 0x53, 0x29, 0x3d, 0xd4, 0xc8, 0x8a, 0x3e, 0xca, 0x84, 0xe0, 0x3d, 0x17, 0xda, 0xc7, 0x3e, 0x37, 0xbc, 0x7a, 0x3e, 0x5c, 0xc9, 0x0e, 0x3e, 0x6a, 0xad, 0x39, 0x3e, 0x1a, 0x56, 0x73, 0x3e, 0x15, 0xf6, 0xdd, 0x3d, 0x9d, 0xb0, 0xc1, 0x3d, 0xaf, 0xb2, 0x1a, 0x3e, 0xa5, 0xe8, 0xea, 0xbd, 0xe2, 0xc4, 0x76, 0x3e, 0xeb, 0x32, 0x7e, 0x3e, 0x46, 0x05, 0xc9, 0xbc, 0x3c, 0xc3, 0x43, 0x3e, 0x04, 0xfc, 0x62, 0xbe, 0x43, 0x0b, 0x2e, 0x3e, 0x77, 0x8b, 0xd5, 0xbd, 0x71, 0x7a, 0x8a, 0xbe, 0x63, 0x78, 0x0d, 0xbe, 0xf6, 0x78, 0x69, 0x3e, 0xfe, 0x59, 0x6d, 0x3e, 0x77, 0x7d, 0x45, 0x3e, 0x55, 0xc2, 0x88, 0xbd, 0x5e, 0x6d, 0x57, 0xbe, 0x8c, 0xb9, 0xa5, 0x3e, 0x9d, 0x43, 0xa5, 0xbb, 0x73, 0xb7, 0xbb, 0x3d, 0x0d, 0x7f, 0x1e, 0x3e, 0x3d, 0xb6, 0xa3, 0x3e, 0x7d, 0x46, 0x68, 0x3e, 0xa0, 0xd7, 0x12, 0x3e, 0x70, 0xfb, 0x2c, 0x3e, 0x5e, 0xdf, 0xa1, 0xbd, 0xce, 0x9e, 0xd5, 0xbd, 0x19, 0xbd, 0x6d, 0x3d, 0x61, 0x63, 0x40, 0x3d, 0x5f, 0xd9, 0x38, 0xbe, 0x26, 0x3e, 0x8d, 0x3d, 0xbb, 0x5b, 0xae, 0x3e, 0x6a, 0xb2, 0x6d, 0xbc, 0x5f, 0x23, 0x54, 0x3e, 0x82, 0x8a, 0x1a, 0xbe, 0x08, 0x74, 0x80, 0x3e, 0x61, 0x3e, 0x89, 0xbe, 0xdc, 0x25, 0x83, 0xbe, 0xc6, 0xf5, 0xbf, 0x3d, 0xcf, 0xa5, 0x7e, 0xbe, 0x14, 0x28, 0x95, 0x3d, 0x22, 0xa3, 0x63, 0xbd, 0x85, 0xb7, 0x99, 0xbd, 0x6b, 0x72, 0x04, 0x3e, 0x8d, 0x7d, 0x29, 0xbe, 0x2a, 0x75, 0x30, 0x3e, 0x6b, 0x71, 0xba, 0x3e, 0xff, 0x2b, 0x57, 0x3e, 0xf3, 0xca, 0xf9, 0xbd, 0x77, 0x0c, 0xd0, 0x3e, 0x11, 0x73, 0xf0, 0xbd, 0x6f, 0x2d, 0x11, 0xbd, 0x90, 0xd9, 0x1f, 0xbe, 0xf3, 0xd6, 0xbc, 0x3d, 0x10, 0x15, 0xc2, 0x3d, 0xdd, 0x4d, 0x9f, 0x3e, 0xd1, 0xa3, 0xff, 0x3d, 0xa5, 0xa3, 0xff, 0xbd, 0x31, 0x20, 0x96, 0x3e, 0x30, 0x1b, 0xe4, 0x3c, 0xb0, 0x15, 0xa7, 0xbd, 0x7e, 0x51, 0x49, 0x3b, 0xa1, 0x59, 0x7a, 0xbe, 0x50, 0x67, 0xfb, 0xbd, 0x57, 0x3d, 0x1d, 0x3d, 0xf7, 0x82, 0x5c, 0x3e, 0x48, 0x66, 0x4e, 0x3e, 0xc7, 0x1d, 0xda, 0xbc, 0x18, 0xa4, 0x73, 0xbe, 0xaf, 0x19, 0x53, 0xbe, 0x1f, 0xdd, 0x91, 0x3d, 0x05, 0x54, 0x5f, 0x3e, 0x6e, 0x5d, 0x46, 0x3e, 0x77, 0xb3, 0x05, 0xbd, 0x38, 0xca, 0xcc, 0xbd, 0xbb, 0xf8, 0x19, 0xbe, 0xaf, 0x74, 0x69, 0xbe, 0x6f, 0xc0, 0x96, 0xbd, 0x64, 0x9b, 0xac, 0x3e, 0x0d, 0x39, 0xde, 0x3d, 0x90, 0x5d, 0x7d, 0x3e, 0xd2, 0xb8, 0x86, 0xbd, 0x18, 0x76, 0x15, 0x3e, 0x27, 0x72, 0xa1, 0xbe, 0x0d, 0x1f, 0x4a, 0x3e, 0x97, 0xa7, 0x79, 0x3e, 0xe6, 0x38, 0x99, 0xbd, 0x06, 0xa1, 0x8f, 0xbd, 0x69, 0xc6, 0x3e, 0xbe, 0xad, 0xdc, 0x51, 0x3e, 0x28, 0x9b, 0xae, 0x3e, 0x2f, 0x93, 0x3a, 0x3e, 0x82, 0x13, 0x72, 0xbd, 0x8e, 0xf0, 0x49, 0x3e, 0x8c, 0xb0, 0xd8, 0xbd, 0x3e, 0x40, 0x53, 0x3d, 0x9b, 0xaf, 0x39, 0x3e, 0x99, 0x03, 0x00, 0x3e, 0x52, 0xac, 0x07, 0xbe, 0xe1, 0x10, 0x9b, 0x3e, 0xa7, 0x7a, 0x15, 0xbe, 0x51, 0xa2, 0x80, 0x3e, 0xe9, 0x59, 0x0c, 0xbe, 0x42, 0x36, 0x55, 0xbe, 0x03, 0xbc, 0x49, 0x3e, 0x2b, 0x41, 0xc5, 0xbd, 0x69, 0xbe, 0x1d, 0x3e, 0x65, 0xcd, 0x03, 0x3e, 0x08, 0x33, 0xa7, 0x3c, 0xf5, 0xe8, 0x2b, 0x3e, 0xf8, 0x95, 0x83, 0x3e, 0xab, 0x13, 0xd3, 0xbd, 0x2e, 0x1e, 0xd0, 0xbd, 0xff, 0x72, 0x76, 0x3d, 0x6d, 0x1b, 0x90, 0x3e, 0x32, 0xad, 0x24, 0x3d, 0x3f, 0xfb, 0x03, 0xbe, 0xca, 0xad, 0x51, 0x3c, 0x6a, 0xc7, 0xe8, 0x3e, 0x17, 0x6a, 0xa0, 0xbe, 0x61, 0x96, 0x9a, 0xbe, 0x73, 0xac, 0x88, 0x3e, 0x17, 0x91, 0xd3, 0xbe, 0x20, 0x7f, 0xdb, 0x3d, 0x03, 0x62, 0x6a, 0x3e, 0x15, 0x19, 0xaa, 0xbd, 0xc8, 0xe1, 0xdd, 0x3e, 0xfe, 0xe0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x28, 0x8c, 0x58, 0xbc, 0xf0, 0x68, 0x3b, 0xbe, 0x39, 0x15, 0x6e, 0xbe, 0x9a, 0xa7, 0x75, 0xbe, 0x64, 0x1e, 0x19, 0xbe, 0xaa, 0x2d, 0xa2, 0xbe, 0xad, 0xbf, 0x32, 0xbd, 0xe9, 0xc5, 0x6b, 0xbe, 0xa5, 0x45, 0xdd, 0x3c, 0xee, 0xe7, 0xba, 0xbd, 0xd7, 0xc6, 0xa4, 0xbe, 0xed, 0x94, 0x3d, 0x3e, 0x9b, 0x45, 0xa0, 0xbd, 0xf2, 0xc6, 0x5e, 0x3e, 0x2e, 0xc5, 0xfa, 0x3d, 0xf0, 0x38, 0x31, 0x3e, 0x12, 0x1e, 0x23, 0xbe, 0x56, 0xc7, 0x65, 0x3e, 0x27, 0x92, 0x8a, 0x3e, 0xd6, 0xf8, 0x40, 0xbe, 0xa6, 0xc2, 0xd9, 0x3d, 0x1f, 0x4e, 0x15, 0x3e, 0xec, 0x77, 0x07, 0xbe, 0x38, 0x2d, 0xb4, 0x3d, 0xa7, 0x12, 0x96, 0x3e, 0x93, 0xd1, 0x0b, 0xbe, 0x8f, 0xac, 0x21, 0x3e, 0x5a, 0xbd, 0x52, 0x3e, 0xb2, 0x4d, 0x9d, 0xbe, 0x7e, 0xd8, 0x75, 0xbd, 0x7e, 0x3b, 0xfd, 0xbd, 0xaa, 0x3e, 0xe2, 0x3d, 0x37, 0x99, 0x1d, 0xbe, 0xff, 0xc3, 0x96, 0x3e, 0xe2, 0x1c, 0x79, 0xbd, 0x06, 0xa0, 0x2a, 0x3e, 0xfd, 0x30, 0x8a, 0xbe, 0x88, 0x41, 0xf1, 0x3d, 0x7d, 0xcf, 0x9a, 0xbe, 0xcf, 0x27, 0x42, 0xbe, 0xeb, 0x4f, 0x66, 0xbe, 0xf8, 0xd3, 0x97, 0x3e, 0x2d, 0x8b, 0xa1, 0xbd, 0x6e, 0xae, 0x0b, 0xbe, 0x9f, 0x8f, 0xab, 0x3d, 0xf1, 0x3b, 0x3f, 0xbd, 0xc9, 0x3c, 0xfc, 0xbd, 0xa8, 0xff, 0x2d, 0xbe, 0x59, 0x7e, 0x8a, 0x3e, 0xc4, 0xc5, 0x9e, 0x3d, 0x69, 0x30, 0x87, 0x3d, 0x63, 0x4f, 0xd6, 0xbd, 0x36, 0xd3, 0x74, 0xbe, 0x75, 0x02, 0xb2, 0x3c, 0x86, 0x87, 0x80, 0xbe, 0xdf, 0x7c, 0x89, 0xbc, 0x34, 0xf0, 0x26, 0xbe, 0x30, 0xe5, 0xd6, 0xbd, 0xb8, 0xd7, 0x80, 0x3e, 0xa7, 0x80, 0xae, 0x3e, 0x43, 0x2e, 0x46, 0x3c, 0x3c, 0xf2, 0x9e, 0xbe, 0xe2, 0xa1, 0x64, 0xbe, 0x07, 0x74, 0xd5, 0xbc, 0x3b, 0x24, 0xa8, 0xbe, 0x21, 0xf7, 0x4f, 0x3c, 0xbe, 0x96, 0x38, 0x3e, 0x72, 0xd4, 0xc8, 0x3d, 0x1c, 0xf3, 0x7f, 0x3e, 0x3f, 0x8d, 0xb0, 0x3e, 0xb4, 0x57, 0x16, 0x3e, 0xb8, 0xec, 0x11, 0xbe, 0xea, 0xd3, 0xa4, 0xbe, 0xe7, 0xb1, 0x50, 0xbe, 0x2f, 0x1e, 0x46, 0xbe, 0xdb, 0x2e, 0x22, 0xbe, 0xbd, 0xf2, 0x35, 0xbd, 0xc6, 0x38, 0x2b, 0xbe, 0x69, 0x97, 0xb6, 0xbe, 0xa0, 0x2f, 0xb7, 0x3d, 0xa1, 0x65, 0x66, 0xbe, 0x34, 0xec, 0xa5, 0x3d, 0x04, 0xd6, 0xb0, 0xbd, 0xbc, 0xec, 0x73, 0xbe, 0x1a, 0xad, 0xfe, 0x3b, 0xd4, 0xe2, 0x8f, 0xbe, 0x22, 0x64, 0x6f, 0x3d, 0xec, 0xdf, 0xd5, 0xbb, 0x1b, 0xaf, 0x0b, 0x3e, 0x11, 0x89, 0xb3, 0xbd, 0x45, 0x7e, 0x8b, 0x3e, 0xf2, 0xc7, 0xb3, 0xbd, 0x8d, 0x10, 0x7b, 0xbe, 0x0a, 0x32, 0xfb, 0xbd, 0x6f, 0xea, 0x94, 0xbe, 0x9d, 0x8e, 0xa2, 0x3c, 0xcb, 0x7b, 0x37, 0x3e, 0xd5, 0x2d, 0x0c, 0xbe, 0x6a, 0x9c, 0x64, 0xbe, 0xc9, 0x18, 0x12, 0x3b, 0x92, 0x04, 0xa3, 0x3e, 0x25, 0xc9, 0x13, 0x3e, 0x39, 0xbd, 0xa3, 0x3d, 0xbb, 0x1c, 0xa0, 0x3e, 0xeb, 0xc4, 0x73, 0x3d, 0x56, 0x9f, 0x80, 0xbd, 0x90, 0x74, 0x0a, 0xbe, 0xc2, 0x7c, 0x4e, 0xbd, 0xb7, 0x7a, 0x08, 0xbe, 0x38, 0xaf, 0x7b, 0x3e, 0x16, 0xe0, 0xae, 0xbd, 0x6d, 0x34, 0x48, 0x3d, 0xfb, 0x45, 0x7e, 0xbe, 0x6c, 0x65, 0xc5, 0xbd, 0x9a, 0x43, 0x27, 0x3e, 0x6f, 0xda, 0x97, 0xbe, 0xac, 0xf7, 0x13, 0x3d, 0x83, 0x61, 0x81, 0xbe, 0x40, 0x86, 0x4e, 0x3e, 0xfc, 0x6c, 0x79, 0x3d, 0x6c, 0xb5, 0x1c, 0x3d, 0xb0, 0x2e, 0x9f, 0x3e, 0x36, 0x0d, 0x9d, 0xbe, 0x9f, 0x5e, 0x84, 0xbe, 0x92, 0x8a, 0xd0, 0xbd, 0x4e, 0x23, 0x20, 0xbe, 0x13, 0xec, 0x1d, 0x3e, 0xb5, 0xb5, 0x65, 0xbe, 0x92, 0x41, 0x0c, 0xbe, 0x3f, 0x4b, 0xbb, 0x3b, 0x4b, 0xb6, 0x2a, 0x3d, 0xd9, 0x0a, 0xb7, 0xbd, 0xf4, 0xe2, 0x73, 0xbe, 0xa5, 0x92, 0x7e, 0x3e, 0x75, 0x76, 0xbf, 0xbd, 0xbd, 0xc9, 0x93, 0xbe, 0x77, 0x6d, 0x9c, 0xbe, 0xcd, 0x4a, 0x05, 0x3e, 0x9f, 0xb2, 0x5e, 0xbe, 0xae, 0x16, 0x46, 0x3e, 0xd6, 0x87, 0xa8, 0x3e, 0xfd, 0xae, 0x11, 0x3e, 0x0d, 0xae, 0x89, 0x3e, 0xea, 0x1d, 0x70, 0xbe, 0x4a, 0xe3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0xd3, 0x20, 0xee, 0x3d, 0x08, 0x68, 0x68, 0xbe, 0x5a, 0xa9, 0x82, 0x3d, 0x86, 0x92, 0xfb, 0xbc, 0xb4, 0x88, 0x4f, 0x3e, 0xd4, 0xec, 0x0b, 0x3e, 0x15, 0x51, 0x87, 0x3e, 0x9c, 0xa4, 0x99, 0xbd, 0xf4, 0x03, 0x00, 0xbe, 0x8f, 0x7a, 0x9b, 0x3e, 0x66, 0x72, 0x10, 0xbe, 0xc1, 0xbe, 0xa9, 0xbd, 0x62, 0x3f, 0x61, 0xbd, 0xb7, 0x20, 0xec, 0x3d, 0x8b, 0x06, 0x1c, 0x3d, 0x07, 0x1f, 0xb6, 0x3e, 0x1e, 0xd4, 0x0c, 0x3e, 0x1b, 0xef, 0x9f, 0x3e, 0x19, 0x42, 0x1e, 0x3e, 0x8b, 0xd7, 0xe0, 0xbd, 0x34, 0x8c, 0x20, 0xbe, 0xe3, 0x63, 0x58, 0xbe, 0x7b, 0x92, 0x43, 0xbe, 0x54, 0x7c, 0x66, 0x3e, 0x2b, 0x9e, 0xfe, 0xbd, 0xa8, 0x39, 0x74, 0x3e, 0x32, 0x3d, 0x26, 0x3e, 0xf8, 0xa8, 0x1e, 0x3e, 0x0d, 0xac, 0x36, 0xbe, 0xa4, 0xaf, 0x3e, 0xbe, 0xd3, 0x73, 0x33, 0x3e, 0x13, 0x1c, 0xca, 0x3d, 0x59, 0xf0, 0x0c, 0xbe, 0xc2, 0xd4, 0xb0, 0xbb, 0x58, 0xc9, 0x13, 0xbe, 0x80, 0x6d, 0xa4, 0x3a, 0xb4, 0xff, 0x11, 0xbe, 0x01, 0xa6, 0x8f, 0x3e, 0x21, 0x7e, 0x4a, 0xbd, 0x16, 0x19, 0x0e, 0x3e, 0x72, 0xf8, 0xee, 0xbd, 0xf6, 0x24, 0x62, 0xbd, 0x27, 0xc6, 0x16, 0x3e, 0x3e, 0xd6, 0xfa, 0xbd, 0xc8, 0x0b, 0x84, 0x3d, 0xc2, 0xcf, 0x39, 0x3d, 0xd6, 0x97, 0x56, 0x3c, 0xd5, 0x9d, 0xb7, 0xbd, 0x7a, 0xb3, 0x7d, 0x3e, 0xdc, 0xa3, 0x93, 0x3d, 0x6a, 0x89, 0xbf, 0x3c, 0x60, 0x35, 0xe0, 0x3d, 0x0c, 0xa1, 0x44, 0x3e, 0x8e, 0x61, 0x83, 0x3d, 0x9e, 0x90, 0x0b, 0x3e, 0x0a, 0x5d, 0x2a, 0x3e, 0x98, 0x38, 0x0a, 0xbe, 0xb5, 0x22, 0xa2, 0x3e, 0xa7, 0xa3, 0x74, 0x3e, 0x00, 0x41, 0x39, 0x3d, 0xf9, 0xe5, 0xd5, 0x3a, 0x8c, 0xef, 0x99, 0xbe, 0x81, 0x2e, 0x53, 0xbe, 0xe6, 0x45, 0xd4, 0x3e, 0xa5, 0x58, 0x82, 0x3d, 0xc9, 0x94, 0xd0, 0xbd, 0xe4, 0x0f, 0xaa, 0x3d, 0xc4, 0x8f, 0x32, 0xbe, 0xab, 0x55, 0x6c, 0x3d, 0x4b, 0x94, 0x53, 0x3e, 0x7f, 0x9f, 0xc9, 0x3e, 0x91, 0x38, 0xd0, 0x3e, 0xd3, 0x2f, 0x5f, 0x3d, 0x50, 0xd5, 0x73, 0x3e, 0x68, 0x1b, 0xb1, 0x3d, 0x57, 0xd0, 0x7a, 0xbe, 0x8f, 0x29, 0x8c, 0x3a, 0x16, 0xe2, 0x6c, 0xbd, 0xe3, 0x98, 0x63, 0xbd, 0x99, 0x18, 0x26, 0x3e, 0x3f, 0x2d, 0xb5, 0xbb, 0x26, 0xfc, 0x8c, 0x3d, 0x1c, 0x27, 0xa0, 0x3e, 0x5b, 0x35, 0x0f, 0x3e, 0xa0, 0x6a, 0x38, 0x3d, 0xe8, 0xde, 0x0d, 0x3e, 0x7a, 0x90, 0x91, 0x3e, 0x72, 0xb3, 0x65, 0xbe, 0x90, 0xfd, 0x93, 0x3e, 0x51, 0xb4, 0x22, 0xbe, 0x5e, 0xc3, 0x08, 0xbd, 0x93, 0xb1, 0x69, 0xbe, 0x2f, 0xe9, 0x79, 0xbe, 0xca, 0x63, 0x8e, 0xbd, 0xf9, 0x05, 0x3f, 0x3e, 0xe4, 0x17, 0x12, 0x3e, 0x4e, 0x50, 0x92, 0x3e, 0x8e, 0x47, 0xaa, 0x3c, 0xc6, 0x85, 0x68, 0xbe, 0x0c, 0xc1, 0xa0, 0xbd, 0x33, 0xcf, 0x93, 0xbe, 0x69, 0x50, 0xb3, 0x3d, 0x2d, 0x87, 0xb5, 0x3e, 0xeb, 0x46, 0xa8, 0xbe, 0xc2, 0x10, 0x10, 0x3e, 0xc0, 0xbe, 0xa0, 0x3c, 0x67, 0x2a, 0x8b, 0xbe, 0xd3, 0x30, 0x78, 0xbe, 0x3e, 0xde, 0x5b, 0xbe, 0x30, 0xab, 0x42, 0xbe, 0x3c, 0xc3, 0xf6, 0x3c, 0x61, 0x88, 0x62, 0xbe, 0xd7, 0x43, 0x9c, 0xbe, 0x26, 0xc6, 0x58, 0x3d, 0x55, 0xf1, 0x91, 0x3d, 0x79, 0x76, 0x21, 0xbe, 0x2c, 0xcf, 0x47, 0x3e, 0x51, 0x73, 0x5d, 0x3e, 0x8e, 0x92, 0x49, 0x3d, 0xe8, 0x4e, 0xeb, 0x3d, 0x32, 0x76, 0x0a, 0xbe, 0xc5, 0xd7, 0x16, 0xbe, 0x3d, 0x29, 0x31, 0xbd, 0xef, 0xd0, 0x1a, 0xbe, 0x07, 0xaa, 0x0c, 0xbe, 0x26, 0xd0, 0x3a, 0xbe, 0xbb, 0x95, 0x92, 0xbc, 0x03, 0xc1, 0x11, 0x3e, 0x9f, 0x9c, 0x58, 0x3e, 0x83, 0x48, 0x21, 0x3e, 0xe6, 0x73, 0x92, 0x3d, 0x7b, 0xab, 0xb6, 0x3e, 0x0c, 0xe9, 0xa7, 0x3e, 0x35, 0xbb, 0x34, 0xbe, 0x89, 0xa9, 0x4b, 0x3e, 0x04, 0xd3, 0xaf, 0x3e, 0xb1, 0x14, 0xb4, 0xbe, 0x21, 0x20, 0x68, 0xbd, 0x64, 0x87, 0x67, 0x3e, 0x09, 0x09, 0x7e, 0x3d, 0x79, 0xee, 0xe5, 0x3e, 0xee, 0xa6, 0x5d, 0x3e, 0x80, 0x49, 0x9e, 0x3e, 0x19, 0x6c, 0xae, 0xbd, 0x96, 0xe5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0xdb, 0x76, 0x4c, 0xbe, 0x19, 0xc1, 0x6f, 0xbc, 0xd9, 0xd8, 0xba, 0x3e, 0x60, 0xcb, 0xff, 0x3d, 0xca, 0xdc, 0xa5, 0x3c, 0xee, 0x84, 0x56, 0xbe, 0xc6, 0xf2, 0x00, 0xbe, 0x85, 0x1b, 0x3c, 0xbe, 0xc6, 0x85, 0xa9, 0x3e, 0x0f, 0x1a, 0x2f, 0x3e, 0x1d, 0x95, 0x7e, 0x3b, 0xf5, 0x0b, 0x03, 0xbd, 0x5d, 0x93, 0xac, 0x3c, 0x0c, 0xd1, 0x51, 0x3e, 0x5e, 0xca, 0xb9, 0xbd, 0xfa, 0x0d, 0x16, 0xbe, 0x19, 0xc4, 0x4e, 0xbe, 0x31, 0x65, 0xe5, 0x3d, 0x50, 0x5f, 0xae, 0x3d, 0x65, 0x16, 0xe3, 0xbd, 0x5a, 0xee, 0x87, 0x3d, 0xd2, 0xd9, 0x80, 0xbe, 0x8e, 0x9d, 0xd0, 0xbd, 0x42, 0xa3, 0x55, 0xbe, 0xe8, 0x76, 0x05, 0x3d, 0x36, 0xb0, 0x64, 0xbe, 0xea, 0xd2, 0x7b, 0x3e, 0x54, 0x73, 0x97, 0x3e, 0x12, 0x4a, 0x72, 0xbe, 0xd6, 0x4d, 0xa3, 0xbd, 0xc0, 0xa9, 0x8d, 0xbe, 0x4b, 0x3f, 0x84, 0xbe, 0x7c, 0xb0, 0xbe, 0x3d, 0xba, 0x63, 0x9b, 0xbe, 0x22, 0x26, 0xe5, 0xbd, 0x99, 0x99, 0x38, 0x3e, 0x05, 0x13, 0x5c, 0x3e, 0x1c, 0x10, 0x7e, 0x3e, 0xe2, 0xf8, 0x7b, 0xbe, 0x40, 0xa4, 0x01, 0xbe, 0x5c, 0x3a, 0x89, 0xbe, 0xa4, 0x6e, 0x0f, 0xbe, 0x98, 0x1e, 0x55, 0xbd, 0x5b, 0xe1, 0xd5, 0xbc, 0xb4, 0xba, 0x91, 0x3d, 0x6f, 0x88, 0x57, 0xbc, 0x95, 0x59, 0x7f, 0xbe, 0x7a, 0x57, 0x93, 0x3e, 0xe6, 0x45, 0x36, 0xbe, 0x03, 0xdf, 0xab, 0x3e, 0x11, 0xe0, 0x67, 0xbe, 0x94, 0xb8, 0x22, 0x3e, 0x31, 0x3f, 0x93, 0x3d, 0xa7, 0xbb, 0x68, 0xbe, 0xc8, 0xbe, 0x83, 0xbd, 0x26, 0x47, 0x49, 0xbe, 0xc9, 0xca, 0xae, 0xbd, 0x2a, 0x1c, 0x2a, 0x3e, 0x34, 0x8b, 0x4f, 0xbe, 0xee, 0x4a, 0x85, 0xbe, 0xfe, 0x4f, 0xec, 0xbd, 0xc7, 0xcc, 0xbb, 0xbe, 0x4a, 0x75, 0x0a, 0xbe, 0x7e, 0x53, 0x57, 0x3d, 0x80, 0xfe, 0xbd, 0xbe, 0xda, 0x2b, 0xb1, 0xbe, 0xf7, 0x5e, 0x31, 0xbe, 0x76, 0x39, 0xab, 0x3d, 0x18, 0xf2, 0xcb, 0x3e, 0x78, 0x8c, 0xa8, 0x3e, 0x8c, 0x78, 0x0c, 0xbe, 0x86, 0x16, 0x88, 0x3d, 0x19, 0x9b, 0xa6, 0x3d, 0x4a, 0x9a, 0x4e, 0xbe, 0xf4, 0xe1, 0x13, 0x3e, 0x20, 0xa3, 0x27, 0xbe, 0x65, 0xfb, 0x8a, 0x3d, 0x0c, 0x0e, 0x71, 0x3e, 0xe0, 0x3b, 0x02, 0x3e, 0xe4, 0x37, 0xad, 0x3b, 0x17, 0x09, 0xaa, 0x3c, 0xe7, 0xae, 0xb5, 0xbc, 0x20, 0xd5, 0x9b, 0x3e, 0xd7, 0xba, 0xa1, 0xbc, 0x95, 0x47, 0x88, 0x3e, 0x07, 0xcb, 0xc4, 0xbd, 0x76, 0x9d, 0x39, 0xbe, 0x69, 0x22, 0x95, 0x3d, 0x32, 0x00, 0x2e, 0x3e, 0x00, 0x7f, 0x1f, 0x3e, 0x92, 0xfb, 0x8f, 0x3e, 0xee, 0x94, 0x36, 0xbe, 0x40, 0xad, 0x90, 0xbe, 0x44, 0x0a, 0x5f, 0x3e, 0x51, 0x1a, 0x92, 0xbe, 0xd1, 0x9a, 0x30, 0x3e, 0xe7, 0xd4, 0x8f, 0xbe, 0x4f, 0x13, 0x42, 0x3e, 0xc2, 0x4c, 0x92, 0x3e, 0x88, 0xf2, 0x95, 0xbd, 0x6e, 0xf7, 0x5a, 0xbe, 0xd7, 0xb7, 0x24, 0x3d, 0xa1, 0x7a, 0x71, 0xbe, 0x11, 0x7d, 0x77, 0xbd, 0xf2, 0xf5, 0x53, 0x3e, 0x81, 0x20, 0x04, 0x3e, 0x26, 0xa3, 0x94, 0x3e, 0x3e, 0xd5, 0xcc, 0xbb, 0xe7, 0xc6, 0x2a, 0x3e, 0x90, 0x97, 0xd0, 0xbb, 0xea, 0x8e, 0x98, 0x3e, 0x0a, 0xef, 0x31, 0x3e, 0xde, 0x4d, 0x71, 0xbe, 0xb1, 0xda, 0x7d, 0xbe, 0x61, 0x4c, 0x96, 0x3e, 0x2a, 0x50, 0x83, 0xbe, 0x23, 0xbb, 0x7a, 0x3d, 0xd0, 0x5e, 0xef, 0x3d, 0xe2, 0x4a, 0x5f, 0xbe, 0xff, 0x20, 0xff, 0xbc, 0xbd, 0x9b, 0x42, 0xbc, 0xaa, 0x50, 0x6c, 0x3e, 0x5f, 0x9f, 0x9f, 0x3c, 0x9a, 0x74, 0x33, 0x3e, 0x76, 0xe6, 0x92, 0xbd, 0xf6, 0x17, 0x23, 0xbe, 0xf8, 0x81, 0xa0, 0x3e, 0x3c, 0xb7, 0xf2, 0xbd, 0x62, 0xc8, 0x3a, 0xbd, 0x8e, 0x4a, 0x1f, 0x3e, 0x24, 0x7c, 0xf9, 0xbc, 0x33, 0xfe, 0xaa, 0x3d, 0x42, 0xd1, 0xe2, 0x3c, 0x20, 0x5e, 0x31, 0xbe, 0xb1, 0x90, 0xb1, 0x3e, 0x55, 0x30, 0xe2, 0x3e, 0xc9, 0x6d, 0x25, 0x3e, 0x15, 0x42, 0x76, 0xbe, 0x85, 0x0c, 0xdf, 0x3e, 0xeb, 0x9d, 0xe7, 0xbe, 0x35, 0x2d, 0x1e, 0xbe, 0x16, 0xe3, 0xb5, 0x3e, 0x54, 0x42, 0x60, 0x3c, 0x73, 0x82, 0xd1, 0x3e, 0xe2, 0xe7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x23, 0x6f, 0xaf, 0x3d, 0xe4, 0x36, 0xa5, 0x3c, 0xd7, 0x3f, 0x9b, 0x3c, 0x6b, 0xa0, 0x0d, 0x3d, 0x8c, 0xf2, 0x9b, 0x3d, 0x65, 0x67, 0xc4, 0x3d, 0x4d, 0x8b, 0x36, 0x3d, 0x94, 0x41, 0x11, 0x3b, 0xc1, 0x1e, 0x66, 0x3d, 0x86, 0x7f, 0x94, 0x3d, 0x8b, 0x32, 0x16, 0x3c, 0x85, 0x25, 0x10, 0x3e, 0x1e, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x19, 0x97, 0x68, 0xbc, 0xa2, 0x32, 0x19, 0x3d, 0xbf, 0xcb, 0xca, 0xbb, 0xb7, 0xa9, 0x04, 0x3c, 0x32, 0x78, 0x0d, 0x3d, 0x67, 0xee, 0xe2, 0x3c, 0xd4, 0x4a, 0xe3, 0x39, 0xbd, 0x9d, 0x05, 0x3b, 0x7d, 0xc9, 0x1d, 0xbd, 0xb5, 0x57, 0x54, 0xbc, 0x48, 0xc4, 0xed, 0xbc, 0x48, 0x7b, 0x96, 0x3c, 0x5a, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa7, 0x7e, 0x8a, 0x3f, 0x72, 0xe6, 0x81, 0x3f, 0x36, 0xf4, 0x82, 0x3f, 0x8a, 0x01, 0x85, 0x3f, 0xdb, 0x56, 0x88, 0x3f, 0x75, 0x26, 0x8c, 0x3f, 0xcf, 0xbd, 0x84, 0x3f, 0xce, 0xfe, 0x7e, 0x3f, 0xeb, 0x1e, 0x87, 0x3f, 0x9e, 0xe0, 0x85, 0x3f, 0x6b, 0x31, 0x82, 0x3f, 0x86, 0x05, 0x94, 0x3f, 0x96, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x5c, 0x5a, 0x85, 0x3d, 0x4d, 0xbc, 0x90, 0x3c, 0x50, 0xbf, 0xa7, 0x3c, 0x5b, 0x82, 0x0a, 0x3d, 0xe8, 0xeb, 0x68, 0x3d, 0x1d, 0x1b, 0xb3, 0x3d, 0xba, 0xa1, 0x27, 0x3d, 0x6f, 0x06, 0x09, 0xbb, 0x29, 0xb0, 0x47, 0x3d, 0xdf, 0xc1, 0x2e, 0x3d, 0x79, 0xbc, 0x45, 0x3c, 0x24, 0x03, 0x12, 0x3e, 0xd2, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x89, 0x51, 0x48, 0xbc, 0x94, 0x68, 0x51, 0x3e, 0xf4, 0x48, 0xa4, 0x3d, 0xe9, 0x94, 0x82, 0xbd, 0x42, 0x4d, 0xc5, 0x3e, 0x6e, 0x7a, 0xe7, 0xbd, 0x20, 0x1f, 0x74, 0xbe, 0xd9, 0x3c, 0x5f, 0xbd, 0xcf, 0x0e, 0xa2, 0x3d, 0x1d, 0xf2, 0x5c, 0xbd, 0xbb, 0xb3, 0x49, 0xbe, 0xd1, 0xb7, 0xac, 0xbe, 0x6d, 0x06, 0xb0, 0xbd, 0xc3, 0x86, 0x5d, 0x3e, 0x9c, 0x0f, 0xdf, 0x3d, 0x59, 0xd3, 0xa4, 0xbe, 0x2e, 0xd8, 0x23, 0xbe, 0xb0, 0x6b, 0x45, 0x3e, 0x7a, 0xad, 0xe7, 0x3c, 0xa0, 0xe4, 0x10, 0xbd, 0xd0, 0x39, 0x1f, 0xbe, 0xad, 0x1e, 0x08, 0xbe, 0x66, 0x09, 0x4d, 0xbe, 0xb1, 0x03, 0x50, 0x3e, 0x69, 0xfd, 0x40, 0xbe, 0x10, 0xb9, 0xc9, 0x3d, 0xf6, 0xe3, 0x6a, 0xbd, 0x09, 0x65, 0x15, 0xbd, 0x1e, 0xef, 0xde, 0x3d, 0xc1, 0x61, 0x3a, 0xbe, 0xf3, 0x0f, 0x02, 0xbd, 0x22, 0x89, 0x25, 0xb8, 0x08, 0xbf, 0x8b, 0xb8, 0x71, 0x22, 0x90, 0x3c, 0x24, 0xc9, 0x9c, 0xbe, 0x11, 0x22, 0x25, 0x3e, 0x03, 0x8c, 0x25, 0x3d, 0x04, 0xe2, 0xc5, 0xbd, 0x39, 0xe4, 0x0a, 0x3e, 0x24, 0xff, 0x00, 0xbe, 0xed, 0xdb, 0x2b, 0x3e, 0x20, 0x54, 0x91, 0xbe, 0x71, 0x3f, 0x8f, 0xbc, 0x44, 0x69, 0x90, 0xbd, 0xfa, 0x40, 0x02, 0x3e, 0x96, 0xe0, 0x42, 0xbe, 0x12, 0x88, 0x70, 0xbe, 0x78, 0x22, 0x55, 0x3e, 0x98, 0x60, 0x44, 0xbe, 0x33, 0xf4, 0x53, 0x3e, 0xf5, 0x38, 0x87, 0x3e, 0xcc, 0x65, 0x9a, 0xbd, 0xb6, 0x47, 0x7a, 0xbc, 0x3a, 0x07, 0x03, 0xbf, 0x51, 0x91, 0x1f, 0x3d, 0x36, 0x81, 0x28, 0x3e, 0x53, 0xd9, 0xab, 0x3d, 0xa1, 0xfd, 0x34, 0xbe, 0x77, 0xa5, 0x7a, 0xbe, 0x9b, 0x4a, 0x75, 0xbe, 0x36, 0xd7, 0x85, 0xbc, 0xd2, 0xdf, 0x8e, 0x3e, 0x24, 0x09, 0xb6, 0x3e, 0x76, 0x87, 0x2b, 0x3c, 0xa5, 0x80, 0xca, 0x3e, 0x2e, 0x50, 0x0f, 0x3d, 0x9d, 0x42, 0x90, 0xbd, 0xfa, 0x77, 0xf7, 0x3d, 0x15, 0x6e, 0x13, 0x3e, 0x2f, 0x53, 0x9b, 0x3e, 0xbb, 0xfa, 0x91, 0xbe, 0xf8, 0x1f, 0x65, 0xbd, 0xa5, 0x06, 0x3e, 0xbd, 0xda, 0x3e, 0x57, 0x3e, 0x48, 0xcc, 0x93, 0xbd, 0xf1, 0x8a, 0x52, 0x3d, 0x30, 0x6e, 0xe6, 0x3d, 0x22, 0xa3, 0x36, 0xbe, 0x89, 0xcd, 0x35, 0xbe, 0x1a, 0x59, 0x0d, 0x3e, 0x76, 0x66, 0x16, 0x3c, 0x29, 0xd3, 0xb7, 0xbd, 0x03, 0xbf, 0x2f, 0xbe, 0xd0, 0x2b, 0xa6, 0xbe, 0x68, 0x1e, 0x56, 0x3d, 0x22, 0xbb, 0x9f, 0xbd, 0x0c, 0xbc, 0xb7, 0xbd, 0x6b, 0x6b, 0x55, 0xbc, 0x26, 0xee, 0x1e, 0xbe, 0x92, 0x0b, 0xa9, 0xbd, 0x34, 0xde, 0x1a, 0xbe, 0x4f, 0x1d, 0xc4, 0x3e, 0x53, 0x98, 0xbd, 0x3d, 0x5f, 0xd9, 0xf7, 0x3d, 0xe6, 0x18, 0xb7, 0xbd, 0x14, 0x41, 0xa6, 0x3c, 0xdb, 0x7f, 0xd8, 0xbb, 0x4a, 0xc8, 0xbb, 0x3c, 0xe2, 0x09, 0xf2, 0xbb, 0xd0, 0xa6, 0xcb, 0xbd, 0x9a, 0x8b, 0xe9, 0x3e, 0x3b, 0x52, 0x53, 0x3e, 0x52, 0xaa, 0x0f, 0xbe, 0x30, 0xb2, 0x07, 0x3e, 0x45, 0x43, 0x44, 0xbe, 0x6b, 0xe7, 0xa0, 0x3d, 0x05, 0x46, 0x60, 0x3e, 0x14, 0xdf, 0x55, 0x3e, 0xe3, 0xbf, 0xa2, 0x3d, 0xe4, 0x0a, 0x0f, 0x3d, 0xae, 0xcc, 0x1f, 0x3e, 0xed, 0x71, 0x02, 0x3e, 0xf1, 0x41, 0x90, 0x3d, 0x16, 0x89, 0x3b, 0xbc, 0x64, 0xfa, 0xd1, 0x3d, 0x0a, 0x14, 0x01, 0xbe, 0x03, 0x64, 0x85, 0xbd, 0x68, 0x18, 0x20, 0x3e, 0xc7, 0xa0, 0x08, 0x3e, 0xcf, 0x71, 0x11, 0x3d, 0x31, 0x21, 0xc8, 0xbd, 0xcf, 0x07, 0x4f, 0xbd, 0x13, 0x01, 0x8d, 0x3e, 0x93, 0x45, 0x41, 0xbe, 0x77, 0x49, 0x6f, 0x3e, 0xad, 0xf1, 0x30, 0xbe, 0xbd, 0x8c, 0x1d, 0xbe, 0xec, 0xb0, 0x30, 0xbe, 0x2a, 0xa1, 0xd2, 0x3c, 0xce, 0x3e, 0x27, 0x3e, 0x6e, 0x2f, 0xc0, 0x3d, 0x27, 0x84, 0x6b, 0xbe, 0x24, 0x36, 0x86, 0xbc, 0xc2, 0x62, 0x8c, 0x3d, 0x48, 0xa1, 0xf5, 0x3d, 0xdf, 0x92, 0x3d, 0xbd, 0x6f, 0xcd, 0xb6, 0x3e, 0x2c, 0xc7, 0x58, 0x3e, 0xe7, 0x7f, 0x0e, 0xbe, 0xd7, 0x8f, 0x7e, 0x3e, 0x01, 0xcb, 0xed, 0xbd, 0x3f, 0xd5, 0x6e, 0xbe, 0x84, 0x16, 0x9b, 0xbd, 0x4c, 0xec, 0x52, 0xbe, 0x1e, 0xeb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x32, 0x8c, 0x2d, 0x3e, 0xf7, 0xc3, 0xcb, 0x3e, 0x87, 0xe6, 0x25, 0xbe, 0xa9, 0x46, 0x56, 0x3e, 0xe9, 0xc2, 0x0b, 0xbe, 0x87, 0xce, 0xa3, 0x3e, 0xb4, 0x62, 0x5f, 0x3e, 0x32, 0xac, 0xde, 0xbd, 0x11, 0x3a, 0xe7, 0xbd, 0xaf, 0x8c, 0xf4, 0x3d, 0xc1, 0x20, 0x8e, 0x3d, 0xfa, 0xc9, 0x2d, 0xbc, 0x4e, 0xb3, 0xc9, 0xbb, 0x97, 0x23, 0x95, 0x3b, 0xb7, 0x4d, 0x3a, 0xbc, 0xe5, 0x5e, 0x48, 0xbe, 0x96, 0xd4, 0xca, 0x3b, 0xc2, 0xcf, 0xc4, 0x3c, 0x14, 0x6a, 0x59, 0xbc, 0xd2, 0xc3, 0x8b, 0x3c, 0x72, 0x8b, 0x49, 0xbe, 0xa0, 0x71, 0x92, 0xbd, 0x41, 0x97, 0x96, 0x3d, 0x60, 0x52, 0xf8, 0x3d, 0x22, 0xe3, 0x89, 0xbe, 0xa4, 0x36, 0xac, 0xbd, 0xc2, 0x40, 0x86, 0x3e, 0xde, 0x02, 0x32, 0xba, 0xd1, 0x18, 0x07, 0xbe, 0x8b, 0x53, 0xfb, 0xbd, 0x08, 0x6b, 0x58, 0xbc, 0xa6, 0x79, 0x70, 0x3e, 0xe4, 0xa0, 0x5e, 0xbc, 0x67, 0xbb, 0xbe, 0x3d, 0x23, 0xe5, 0xb4, 0x3d, 0xa9, 0xf3, 0x4d, 0xbd, 0x77, 0x98, 0x96, 0xbd, 0x11, 0x60, 0x69, 0x3a, 0x4f, 0xf2, 0xe3, 0xbc, 0x29, 0xe9, 0x46, 0xbd, 0x67, 0x02, 0xd6, 0xbd, 0x59, 0x9d, 0x3c, 0x3e, 0xcc, 0x47, 0x5f, 0x3e, 0x50, 0x45, 0x48, 0x3d, 0x21, 0xc5, 0x95, 0xbd, 0xcc, 0x71, 0x66, 0x3e, 0x6a, 0x7c, 0xbb, 0xbd, 0x5d, 0x79, 0xac, 0xbe, 0x46, 0x21, 0x4d, 0xbe, 0xd9, 0x61, 0x8b, 0xbd, 0x58, 0x90, 0x85, 0x3e, 0xe6, 0x60, 0x34, 0xbe, 0xf4, 0x95, 0x24, 0x39, 0xb0, 0x69, 0xb9, 0xbc, 0x02, 0x97, 0x3d, 0x3e, 0xa1, 0xef, 0x55, 0xbd, 0xc4, 0x34, 0xe3, 0x3d, 0x9a, 0xc6, 0xaa, 0xbe, 0x3c, 0x32, 0xe3, 0xbb, 0xc9, 0x42, 0xf7, 0xbd, 0xc5, 0x7a, 0x54, 0x3e, 0x75, 0x2c, 0x4b, 0xbb, 0xac, 0x7d, 0xc5, 0xbd, 0xe7, 0x6c, 0xec, 0x3c, 0xac, 0xb1, 0x0c, 0xbe, 0x90, 0xdc, 0x6d, 0x3d, 0x6b, 0x22, 0x5a, 0x3e, 0x83, 0xe1, 0xf9, 0xbb, 0x2b, 0xa5, 0x90, 0xbd, 0xa0, 0x98, 0x06, 0xbd, 0xfb, 0x9e, 0x25, 0xbc, 0x7d, 0xe1, 0x85, 0x3d, 0x25, 0x07, 0x9b, 0xba, 0x6d, 0x1f, 0xea, 0x3d, 0xc8, 0xde, 0x80, 0xbe, 0xb6, 0x9d, 0x87, 0x3d, 0xbc, 0x41, 0x20, 0xbe, 0xc0, 0x5d, 0x97, 0xbe, 0x0c, 0xac, 0x44, 0xbe, 0x33, 0xa7, 0x38, 0xbe, 0xe7, 0x31, 0x11, 0x3e, 0xd7, 0xbf, 0x73, 0x3d, 0x55, 0x6b, 0x54, 0x3e, 0x68, 0x82, 0x1a, 0x3e, 0xcc, 0xa6, 0x4f, 0xbc, 0xaf, 0x2d, 0x6d, 0x3e, 0xe8, 0x0a, 0x92, 0x3c, 0x6b, 0x70, 0x72, 0x3d, 0x02, 0x1d, 0x7c, 0x3d, 0x8c, 0xe8, 0xab, 0x3d, 0x5e, 0xb0, 0xd9, 0xbd, 0x6e, 0x9b, 0x6b, 0x3d, 0x5d, 0xb4, 0x9c, 0xbe, 0x02, 0x11, 0x8b, 0x3c, 0x3d, 0xa0, 0x06, 0xbe, 0xc7, 0x5c, 0x9c, 0x3c, 0x4d, 0x66, 0x78, 0x3d, 0x06, 0x67, 0x19, 0xbe, 0x2a, 0xc2, 0xea, 0xbd, 0x63, 0x4b, 0x36, 0x3e, 0xd8, 0x07, 0xb0, 0xbc, 0x3c, 0xbc, 0xd8, 0xbe, 0xa7, 0x77, 0x86, 0xbd, 0xc1, 0x1c, 0x36, 0x3e, 0xb1, 0xd0, 0x9c, 0xbe, 0x85, 0xfd, 0x36, 0xbe, 0x7d, 0x10, 0xc8, 0x3d, 0x1c, 0xc5, 0x17, 0xbe, 0x34, 0xa3, 0xb2, 0x3e, 0x79, 0xaf, 0x93, 0xbe, 0x46, 0xf9, 0x18, 0xbe, 0x51, 0xed, 0x7b, 0x3d, 0xdb, 0x15, 0xdc, 0xbd, 0xee, 0x37, 0x84, 0x3e, 0xef, 0xf1, 0xe3, 0xbd, 0x81, 0x1b, 0x4e, 0xbe, 0x49, 0x34, 0x83, 0x3e, 0x28, 0xed, 0xdd, 0xbd, 0x4f, 0xd7, 0xab, 0x3b, 0x05, 0xc6, 0x44, 0xbe, 0x5e, 0x3d, 0x1e, 0xbe, 0x69, 0xf2, 0xac, 0xbd, 0x10, 0x47, 0xee, 0x3d, 0x92, 0xa8, 0x90, 0xbd, 0x30, 0xeb, 0xdd, 0xbd, 0x05, 0x59, 0x10, 0x3e, 0x1e, 0x8a, 0x44, 0x3e, 0xbc, 0x5b, 0x63, 0xbe, 0x1f, 0x01, 0xe3, 0xbd, 0x88, 0x1c, 0xb1, 0xbb, 0xdf, 0x42, 0xb6, 0x3c, 0x2a, 0x8f, 0xc5, 0x3d, 0x87, 0x56, 0xbf, 0xbd, 0xa0, 0xca, 0x15, 0x3e, 0xce, 0x48, 0x84, 0xbe, 0xe6, 0x83, 0x14, 0x3c, 0x03, 0x86, 0x83, 0x3d, 0x3d, 0x14, 0x91, 0x3d, 0x51, 0xbc, 0xa9, 0x3d, 0x60, 0xd4, 0xdd, 0xbd, 0x9e, 0x75, 0x56, 0xbe, 0x8a, 0xf6, 0x98, 0xbe, 0xdc, 0x74, 0x12, 0x3e, 0x53, 0xfd, 0x96, 0x3d, 0x6a, 0xed, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x97, 0xee, 0x43, 0x3e, 0x12, 0x60, 0x03, 0x3e, 0x77, 0x26, 0x3d, 0x3d, 0x87, 0xfd, 0x63, 0xbe, 0xd5, 0xf0, 0xdb, 0x3c, 0x62, 0x1f, 0x8f, 0x3e, 0xe0, 0xa0, 0xf4, 0xbd, 0x93, 0xa9, 0x4b, 0x3e, 0x16, 0x41, 0x2f, 0xbe, 0xbd, 0x5c, 0x46, 0x3e, 0x6c, 0x24, 0x2b, 0xbe, 0x44, 0x15, 0x0e, 0xbe, 0xb2, 0xa1, 0xe2, 0x3d, 0x59, 0xd4, 0x1d, 0x3e, 0x4d, 0x29, 0x59, 0x3e, 0x06, 0xae, 0x0c, 0x3e, 0x39, 0x08, 0x8a, 0xbe, 0x51, 0x11, 0xeb, 0x3d, 0x30, 0x5b, 0x3a, 0xbe, 0x57, 0xca, 0x9f, 0x3d, 0x7e, 0x56, 0x6f, 0xbd, 0xe0, 0x96, 0xab, 0x3d, 0x5c, 0x29, 0xbb, 0x3d, 0x29, 0xd3, 0x1c, 0x3e, 0xdb, 0x5c, 0x6c, 0x3e, 0x9e, 0x75, 0xd7, 0x3c, 0x4d, 0xf6, 0x54, 0x3c, 0x46, 0x32, 0x4e, 0xbe, 0xbb, 0x6c, 0x36, 0x3d, 0x08, 0xb9, 0x8e, 0xbe, 0x1d, 0x78, 0x4a, 0xbe, 0xe0, 0xd2, 0x63, 0xbe, 0xcc, 0x30, 0xef, 0xbb, 0xf4, 0x70, 0x27, 0x3c, 0x3e, 0xc8, 0x7b, 0xbe, 0x35, 0x8e, 0x11, 0x3d, 0x4c, 0x43, 0xc3, 0xbd, 0x10, 0x3e, 0x06, 0xbe, 0xd1, 0x82, 0xf0, 0xbd, 0xd6, 0x8d, 0x49, 0xbd, 0x60, 0xde, 0xa6, 0xbd, 0xa3, 0xfa, 0x18, 0xbe, 0xcc, 0x67, 0x98, 0x3d, 0x03, 0x10, 0x46, 0x3c, 0x84, 0x69, 0x27, 0xbe, 0x09, 0xf0, 0x69, 0xbe, 0x74, 0xed, 0x44, 0xbe, 0x0e, 0x9a, 0xb4, 0x3d, 0x89, 0x49, 0x93, 0xbe, 0xb8, 0x35, 0x72, 0x3e, 0xfb, 0x30, 0x8b, 0xbe, 0x50, 0x83, 0xa2, 0xbe, 0x68, 0x78, 0xe3, 0x3d, 0x2c, 0x80, 0x63, 0xbe, 0x1d, 0x0e, 0xef, 0x3c, 0x9c, 0x82, 0x41, 0x3c, 0x60, 0x7a, 0x0e, 0x3e, 0x72, 0x5f, 0x8a, 0xbd, 0xd8, 0xae, 0x1a, 0xbe, 0x6b, 0xfe, 0xf4, 0x3d, 0x92, 0xcc, 0xaa, 0xbd, 0x47, 0xf2, 0x4c, 0x3e, 0x82, 0x05, 0x5f, 0x3e, 0x92, 0xe7, 0x89, 0xbe, 0xd0, 0xd2, 0xfa, 0xbd, 0xf1, 0xb1, 0x96, 0x3d, 0x1a, 0xa9, 0xc5, 0xbe, 0xd3, 0xeb, 0x16, 0x3d, 0xda, 0x90, 0x12, 0xbd, 0xfd, 0xe7, 0xf7, 0x3c, 0x91, 0x0f, 0xc8, 0x3c, 0x56, 0x86, 0x89, 0xbe, 0xb3, 0xdd, 0x8e, 0xbe, 0x67, 0xfe, 0x33, 0xbe, 0x9e, 0xb8, 0x4d, 0xbe, 0x12, 0xf2, 0x57, 0xba, 0xe1, 0xb3, 0x02, 0x3d, 0x28, 0x92, 0x7a, 0xbd, 0x3b, 0x00, 0xbf, 0xbc, 0x2a, 0x08, 0x2d, 0xbd, 0x64, 0x53, 0xc4, 0xbd, 0xf0, 0x36, 0x5e, 0x3e, 0x11, 0x8b, 0x09, 0x3e, 0x21, 0xe5, 0x51, 0xbe, 0xa8, 0xb9, 0x2f, 0x3b, 0xad, 0x94, 0x3e, 0xbc, 0xbc, 0x03, 0x03, 0x3e, 0x80, 0xc4, 0x77, 0xbd, 0x2d, 0x70, 0x37, 0xbe, 0x01, 0xe7, 0x39, 0x3e, 0x0a, 0xb3, 0xda, 0xbc, 0xfe, 0x6e, 0x36, 0xbe, 0x79, 0x8c, 0x20, 0xbe, 0xcf, 0x96, 0x13, 0xbc, 0x7d, 0x74, 0x24, 0x3e, 0x8f, 0xb4, 0xea, 0xbb, 0x20, 0x04, 0x20, 0x3e, 0xf7, 0x7e, 0x1b, 0x3e, 0xc1, 0x75, 0x57, 0x3e, 0xd8, 0xa1, 0x73, 0xbe, 0x7a, 0x9a, 0x20, 0x3e, 0x31, 0xb1, 0x72, 0x3d, 0xf8, 0x02, 0x4e, 0xbe, 0x97, 0x6f, 0x5b, 0xbd, 0x00, 0x0a, 0xbe, 0xbe, 0xce, 0xe8, 0x3f, 0x3d, 0x90, 0xee, 0x9a, 0x3d, 0xb5, 0x54, 0x1d, 0xbe, 0x04, 0xd5, 0xcc, 0xbd, 0xc1, 0x40, 0xc5, 0x3d, 0xd8, 0x5b, 0x13, 0xbe, 0xb8, 0x24, 0x6b, 0xbe, 0x47, 0x97, 0xe5, 0xbd, 0x0b, 0x20, 0x8a, 0x3d, 0x96, 0xc5, 0x9a, 0xbe, 0x4e, 0x82, 0x0a, 0x3e, 0x19, 0xf1, 0x4b, 0xbe, 0x8c, 0xec, 0xcb, 0x3d, 0x81, 0x27, 0x24, 0xbe, 0x1e, 0x44, 0xa7, 0xbe, 0x66, 0xfd, 0xaa, 0x3d, 0x17, 0x70, 0x89, 0xbd, 0xd6, 0x62, 0xcb, 0x3d, 0xc4, 0x76, 0x0a, 0x3e, 0x2c, 0x4a, 0x65, 0xbe, 0xdc, 0x2f, 0x0a, 0xbe, 0x1d, 0x4f, 0xa6, 0x3d, 0x0b, 0x15, 0x82, 0xbe, 0x14, 0x6e, 0x7c, 0xbb, 0xa7, 0xd1, 0x81, 0xbd, 0x43, 0x35, 0x9e, 0xbe, 0xd0, 0x84, 0x5c, 0x3c, 0xa9, 0xa3, 0x01, 0xbc, 0xae, 0x2c, 0x0c, 0x3d, 0x21, 0xc3, 0x88, 0x3d, 0x97, 0x69, 0xd5, 0xbd, 0x0e, 0x91, 0xc0, 0x3d, 0xec, 0xa1, 0x94, 0x3e, 0x6d, 0x61, 0x7b, 0xbe, 0xfd, 0xe8, 0x78, 0x3e, 0x37, 0xf9, 0x2c, 0xbe, 0x80, 0x82, 0xca, 0x3e, 0x4c, 0x7c, 0x33, 0xbe, 0x34, 0xd3, 0x8f, 0xbe, 0xb6, 0xef, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0xc4, 0x40, 0x46, 0xbe, 0xe6, 0xe4, 0x75, 0x3d, 0x7a, 0xde, 0x91, 0x3e, 0x29, 0x76, 0xf7, 0x3d, 0x29, 0x4d, 0x84, 0x3d, 0x82, 0x06, 0x93, 0x3e, 0x67, 0x8b, 0x90, 0xbe, 0x33, 0x94, 0x5c, 0x3e, 0x50, 0xf5, 0x05, 0xbe, 0x06, 0x2f, 0xcc, 0xbd, 0x88, 0xb8, 0x63, 0xbe, 0x2d, 0x5e, 0x35, 0xbe, 0x9f, 0x2a, 0x0b, 0xbe, 0x72, 0xe1, 0x14, 0x3e, 0x32, 0xfd, 0xd4, 0xbc, 0x2f, 0xba, 0x1c, 0xbe, 0x3c, 0xbd, 0x18, 0x3e, 0x17, 0x8f, 0x53, 0x3e, 0x58, 0x72, 0x8f, 0xbd, 0x3b, 0x17, 0x1c, 0xbe, 0xa3, 0xfb, 0x86, 0xbd, 0xb5, 0xbd, 0x27, 0x3e, 0x94, 0xd7, 0x6d, 0xbe, 0x35, 0x4a, 0x57, 0x3e, 0x52, 0x93, 0x9b, 0x3d, 0x41, 0xf6, 0x2e, 0x3e, 0xb7, 0x09, 0x2c, 0xbe, 0x1e, 0x8d, 0xa2, 0xbe, 0xbb, 0x57, 0x16, 0xbd, 0x66, 0x76, 0xc1, 0xbb, 0xcc, 0xf7, 0xce, 0x3d, 0x85, 0x1e, 0x13, 0x3e, 0xc8, 0x37, 0x9a, 0x3e, 0xf7, 0xed, 0x24, 0xbd, 0x7f, 0x97, 0xa2, 0xbc, 0x0e, 0x1e, 0x42, 0xbe, 0x9b, 0x8b, 0x37, 0xbe, 0x7a, 0x0d, 0x91, 0x3d, 0x6b, 0x47, 0xe7, 0x3c, 0x01, 0x1b, 0x0d, 0xbd, 0xec, 0x6c, 0xda, 0x3d, 0x39, 0x1c, 0x2e, 0xbd, 0xff, 0xd2, 0x23, 0xbe, 0x0d, 0x0d, 0x66, 0xbc, 0x10, 0x78, 0x52, 0x3e, 0x07, 0x75, 0x92, 0xbe, 0xe0, 0xae, 0x4a, 0x3e, 0x78, 0x8c, 0x41, 0x3c, 0x2e, 0x19, 0xb3, 0xbd, 0xb9, 0xd9, 0x89, 0xbe, 0x58, 0x88, 0xf8, 0x3d, 0x05, 0x66, 0xd0, 0xbe, 0x20, 0x0f, 0x85, 0x3d, 0x47, 0x5f, 0x21, 0xbe, 0xc7, 0xad, 0x05, 0xbd, 0x2b, 0xa7, 0x1e, 0x3d, 0x99, 0xae, 0x11, 0xbd, 0x8c, 0x95, 0x09, 0x3e, 0xc6, 0xbc, 0x1e, 0xbe, 0xd3, 0x57, 0x1c, 0xbc, 0x89, 0x7a, 0xe7, 0xbd, 0x57, 0xdb, 0x8c, 0x3d, 0x08, 0xa4, 0x41, 0x3b, 0x80, 0x4c, 0x66, 0xb6, 0xd9, 0xfd, 0x56, 0xbd, 0xbf, 0x12, 0xa7, 0x3d, 0x84, 0x45, 0x31, 0xbe, 0xee, 0xc8, 0x7c, 0xbd, 0x30, 0xa8, 0xc4, 0xbd, 0x8b, 0x41, 0x7e, 0x3e, 0x72, 0x14, 0x0e, 0x3e, 0xc8, 0x69, 0xa6, 0xbb, 0xde, 0x85, 0x35, 0x3e, 0x12, 0xc8, 0x6b, 0x3d, 0xcf, 0x18, 0xbd, 0x3d, 0xb4, 0xe5, 0xd1, 0xbd, 0x49, 0xbf, 0x94, 0x3c, 0xc3, 0xec, 0xa3, 0xbd, 0x73, 0x57, 0x90, 0xbe, 0x48, 0xf3, 0xc9, 0x3a, 0x3d, 0xc5, 0x3d, 0xbe, 0xa0, 0xa3, 0xfe, 0xbd, 0x8f, 0x7a, 0x13, 0xbe, 0xaa, 0x78, 0x6a, 0xbd, 0x81, 0x2e, 0x15, 0xbe, 0x00, 0x45, 0x82, 0xbd, 0x06, 0xa0, 0xa9, 0x3a, 0x85, 0x89, 0xaa, 0x3d, 0x1c, 0xa4, 0xe9, 0xbc, 0x37, 0xcb, 0xd5, 0x3d, 0x92, 0x83, 0xdc, 0xbd, 0x03, 0xb2, 0xe0, 0xbe, 0xdb, 0x76, 0x96, 0xbd, 0x02, 0x3f, 0x79, 0x3c, 0x33, 0xa3, 0x4d, 0xbe, 0x33, 0x6a, 0x99, 0xbe, 0xa7, 0xb4, 0x50, 0x3e, 0xff, 0xa0, 0x80, 0x3e, 0x76, 0x34, 0x29, 0x3e, 0x64, 0x2e, 0xbf, 0xbd, 0x66, 0x1b, 0x12, 0x3e, 0xc3, 0x4a, 0x55, 0x3d, 0xd8, 0x1b, 0xcf, 0x3d, 0x68, 0x54, 0xc2, 0x3b, 0x33, 0x51, 0x14, 0xbe, 0x23, 0x9a, 0xab, 0xbd, 0x1a, 0x7c, 0xb8, 0x3d, 0x2d, 0xe3, 0xa0, 0xbd, 0x5a, 0x9d, 0x04, 0xbd, 0xa9, 0x39, 0x11, 0x3d, 0x9a, 0xd4, 0x75, 0xbd, 0xff, 0x7c, 0x90, 0x3e, 0x1e, 0xc9, 0x9a, 0x3d, 0x1e, 0xbd, 0xfd, 0x3c, 0xe2, 0x79, 0x89, 0xbd, 0xfc, 0x85, 0x11, 0xbc, 0x78, 0xb7, 0x28, 0xbe, 0xc9, 0x92, 0x61, 0x3e, 0x08, 0xb3, 0x03, 0xbe, 0xd9, 0xf1, 0x9c, 0xbd, 0xc9, 0x43, 0x34, 0x3e, 0x91, 0x77, 0x15, 0xbe, 0x10, 0x82, 0xd9, 0x3b, 0x26, 0x06, 0xe4, 0xbd, 0x89, 0xa5, 0x67, 0x3e, 0x0f, 0x87, 0xca, 0xbd, 0x8c, 0x13, 0x84, 0x3e, 0x2b, 0x52, 0xa7, 0x3c, 0x43, 0xca, 0x8e, 0xbe, 0x82, 0xa0, 0x9f, 0x3d, 0xfc, 0xc2, 0x3d, 0xbe, 0x0b, 0xb5, 0x5d, 0xbe, 0x54, 0xfc, 0x4a, 0xbd, 0xbb, 0x9f, 0x88, 0xbd, 0x6b, 0xbc, 0x9a, 0x3d, 0x0a, 0x14, 0xdc, 0xbd, 0xd5, 0x84, 0x57, 0x3e, 0xe1, 0xca, 0x67, 0x3e, 0x5a, 0x28, 0xd7, 0xbe, 0x88, 0xeb, 0x2f, 0x3e, 0x32, 0x95, 0x37, 0xbe, 0x5e, 0xb7, 0x64, 0xbd, 0xf4, 0xa5, 0xa2, 0xbe, 0x74, 0x2f, 0x86, 0x3d, 0x02, 0xf2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x4f, 0xc8, 0x41, 0xbe, 0x18, 0x1f, 0x65, 0xbe, 0xdc, 0x22, 0x0a, 0xbe, 0x03, 0xfb, 0xb6, 0xbe, 0x9e, 0xf0, 0x31, 0xbe, 0x90, 0x56, 0x4d, 0xbd, 0x89, 0x5f, 0xa7, 0xbe, 0x7a, 0xe6, 0xc5, 0x3d, 0x0d, 0x57, 0x52, 0x3e, 0x4f, 0x39, 0x7e, 0x3d, 0xad, 0x95, 0xdb, 0xbd, 0x2f, 0xd5, 0x4e, 0x3b, 0xa0, 0xbd, 0xae, 0xbe, 0xd0, 0x91, 0x66, 0x3e, 0x7e, 0xdc, 0x8a, 0x3d, 0x79, 0x92, 0x30, 0xbe, 0x9e, 0x7e, 0xba, 0x3e, 0x43, 0x77, 0x9b, 0x3e, 0x39, 0xca, 0xab, 0xbe, 0x13, 0x5c, 0xd2, 0x3e, 0x07, 0x58, 0x8d, 0x3e, 0x43, 0x30, 0x81, 0xbe, 0x19, 0x63, 0xad, 0x3e, 0xaf, 0x7b, 0x70, 0x3e, 0x22, 0xa2, 0x8a, 0xbe, 0xe6, 0x27, 0x1c, 0xbe, 0x17, 0x0c, 0x90, 0xbe, 0x3b, 0x36, 0x5a, 0x3e, 0xf2, 0x1c, 0x8a, 0xbe, 0xa9, 0xe0, 0x15, 0xbe, 0xf4, 0x0a, 0x1a, 0xbe, 0xc0, 0x30, 0x4b, 0x3e, 0x75, 0x28, 0xbd, 0xbd, 0xd3, 0x26, 0xbe, 0xbc, 0xfc, 0x62, 0xdc, 0xbd, 0x75, 0xe8, 0xb8, 0x3e, 0x9e, 0xf2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xb3, 0x16, 0xa3, 0xbe, 0xc2, 0x6b, 0x36, 0x3e, 0x09, 0xb5, 0x8f, 0x3e, 0xc3, 0x00, 0xb5, 0x3e, 0x2e, 0xe9, 0x27, 0xbe, 0x27, 0x39, 0xc1, 0xbe, 0x68, 0x88, 0x1e, 0xbe, 0xff, 0x37, 0x8e, 0xbd, 0x5f, 0x82, 0xd5, 0x3e, 0x10, 0xad, 0x08, 0xbd, 0xa1, 0x07, 0x31, 0x3e, 0xf4, 0x29, 0xcc, 0x3d, 0x54, 0xe6, 0x7b, 0x3e, 0x2a, 0x85, 0x83, 0x3e, 0x69, 0x29, 0x86, 0x3e, 0x13, 0x4c, 0x83, 0x3e, 0x1c, 0x66, 0x7d, 0xbe, 0x11, 0x1b, 0xa8, 0xbe, 0x71, 0xab, 0x82, 0xbe, 0x85, 0x8d, 0x96, 0x3c, 0xbe, 0x99, 0xb1, 0x3e, 0x6f, 0x18, 0x25, 0x3e, 0x41, 0x5a, 0x57, 0x3e, 0x95, 0x09, 0xc2, 0xbe, 0xbb, 0xa1, 0x21, 0x3b, 0x7c, 0x42, 0x80, 0x3e, 0xbb, 0x1a, 0x53, 0xbe, 0x5a, 0x5d, 0x98, 0xbe, 0x7e, 0x7f, 0x7d, 0x3e, 0xc2, 0x7d, 0x2a, 0xbe, 0x1e, 0x60, 0x1a, 0xbe, 0x50, 0xa4, 0x39, 0x3d, 0x58, 0x4d, 0xab, 0x3e, 0x82, 0xc6, 0x4a, 0xbe, 0x3a, 0xaf, 0x6c, 0x3e, 0x9a, 0x98, 0x99, 0x3e, 0x3a, 0xf3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x84, 0xd2, 0x1a, 0xbe, 0xc0, 0x52, 0x47, 0xbe, 0x91, 0x9a, 0x12, 0x3e, 0x73, 0x10, 0xd2, 0xbe, 0x85, 0x7e, 0x1e, 0xbe, 0x15, 0x8a, 0x30, 0xbe, 0x3c, 0x6e, 0x78, 0x3e, 0x48, 0x1c, 0xcc, 0xbe, 0x21, 0x94, 0xab, 0x3d, 0x87, 0x29, 0x54, 0x3e, 0x0f, 0x35, 0xc2, 0xbd, 0x5c, 0x92, 0xb4, 0xbc, 0xcd, 0xeb, 0x1e, 0xbd, 0xea, 0x50, 0xb6, 0x3e, 0xb5, 0x6c, 0x7b, 0xbe, 0xfd, 0x42, 0x86, 0x3d, 0x8c, 0xbd, 0xa5, 0x3e, 0x9d, 0x1a, 0x30, 0x3e, 0xd6, 0x10, 0xd6, 0x3d, 0x12, 0xf4, 0x8d, 0xbd, 0x2b, 0xce, 0xc8, 0x3c, 0x92, 0x78, 0x80, 0xbe, 0x21, 0x74, 0x0b, 0x3e, 0xe0, 0x3b, 0xd1, 0x3e, 0xa0, 0xba, 0xa1, 0x3d, 0xaa, 0x13, 0xa0, 0xbe, 0xb8, 0x5b, 0x55, 0xbe, 0xfb, 0xa2, 0xb1, 0xbe, 0xa6, 0x50, 0xa3, 0x3e, 0xad, 0x2c, 0x8e, 0xbe, 0x27, 0x14, 0x16, 0x3e, 0x94, 0xa6, 0xd8, 0x3d, 0xf0, 0x45, 0x13, 0xbd, 0xbc, 0xb5, 0xe4, 0x3d, 0x4f, 0x86, 0x23, 0xbc, 0xfe, 0x81, 0xd1, 0x3e, 0xd6, 0xf3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xec, 0x5f, 0xbb, 0xbe, 0xea, 0x37, 0x94, 0x3d, 0xa6, 0x93, 0xa9, 0x3e, 0x52, 0x61, 0x70, 0xbe, 0xcb, 0xe6, 0x23, 0xbc, 0xe4, 0x88, 0xdc, 0x3e, 0xb1, 0x42, 0xb2, 0x3e, 0x18, 0xfd, 0x90, 0xbe, 0x3c, 0x5f, 0x89, 0x3e, 0xf8, 0x71, 0x17, 0xbe, 0x26, 0xe5, 0x2d, 0xbd, 0xe2, 0x07, 0x69, 0xbe, 0x77, 0xf4, 0x9f, 0xbe, 0xd0, 0xbb, 0x97, 0x3e, 0x26, 0xfd, 0x03, 0x3e, 0xc9, 0x58, 0x0b, 0x3e, 0xf9, 0x3e, 0x86, 0x3e, 0x74, 0xb2, 0xae, 0x3d, 0x4e, 0x3e, 0x62, 0x3e, 0x98, 0x8c, 0x49, 0x3e, 0xf6, 0x02, 0xaf, 0x3e, 0xf7, 0x0e, 0x8b, 0xbc, 0x57, 0x55, 0x91, 0x3e, 0x5a, 0xd9, 0x12, 0xbe, 0xcc, 0xb7, 0x22, 0xbe, 0x01, 0xf6, 0x24, 0x3e, 0xc7, 0x23, 0x74, 0xbe, 0x71, 0x99, 0x73, 0xbe, 0xff, 0x4c, 0x85, 0x3c, 0xc2, 0x1c, 0x53, 0x3e, 0x14, 0x08, 0x92, 0x3e, 0x20, 0x61, 0x9a, 0xbe, 0x4e, 0x53, 0x28, 0xbe, 0x4e, 0x2d, 0xca, 0xbd, 0xd9, 0x5c, 0xb0, 0x3e, 0xc3, 0xae, 0xc0, 0x3d, 0x72, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xfb, 0xec, 0x52, 0x3d, 0xba, 0x64, 0xa0, 0x3d, 0xc8, 0x15, 0x1c, 0x3d, 0x16, 0x16, 0x89, 0x3d, 0xea, 0x87, 0x06, 0x3d, 0xf6, 0xa1, 0x81, 0x3d, 0x88, 0x49, 0x7c, 0x3d, 0x05, 0x7e, 0xbc, 0x3a, 0x44, 0x48, 0x01, 0x3d, 0x43, 0xcc, 0x73, 0x3d, 0xa1, 0x7a, 0x4e, 0x3d, 0x83, 0x79, 0x6f, 0x3d, 0xae, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa4, 0x96, 0x80, 0xbc, 0x59, 0x05, 0x49, 0x3a, 0x0e, 0xbd, 0x10, 0xba, 0x30, 0xac, 0x6e, 0x3d, 0x31, 0xd9, 0xde, 0xbc, 0x6f, 0xe0, 0x14, 0x3d, 0x24, 0x9d, 0x40, 0x3d, 0xd4, 0x97, 0xbb, 0xbc, 0xc1, 0x19, 0x18, 0x3d, 0x18, 0x33, 0x15, 0x3d, 0x84, 0x81, 0x69, 0x3c, 0x32, 0x65, 0x70, 0xbc, 0xea, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x39, 0x87, 0x85, 0x3f, 0xc7, 0x26, 0x89, 0x3f, 0x50, 0x1b, 0x84, 0x3f, 0xdf, 0xb4, 0x87, 0x3f, 0xf8, 0x8f, 0x84, 0x3f, 0x07, 0x1a, 0x89, 0x3f, 0x38, 0x88, 0x86, 0x3f, 0xe8, 0xb6, 0x80, 0x3f, 0xd5, 0xea, 0x84, 0x3f, 0x54, 0xd2, 0x87, 0x3f, 0x55, 0x42, 0x86, 0x3f, 0x91, 0xe2, 0x84, 0x3f, 0x26, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x8d, 0x72, 0x49, 0x3d, 0x4d, 0x9c, 0x69, 0x3d, 0x47, 0x08, 0xee, 0x3c, 0x07, 0xae, 0x7c, 0x3d, 0xef, 0xb1, 0xfe, 0x3c, 0x5b, 0x56, 0x86, 0x3d, 0x33, 0x6c, 0x64, 0x3d, 0x2a, 0x1c, 0x09, 0x3c, 0x52, 0x19, 0x04, 0x3d, 0x03, 0x72, 0x6d, 0x3d, 0x9d, 0x12, 0x63, 0x3d, 0xe1, 0x89, 0x20, 0x3d, 0x62, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x7d, 0x33, 0xc5, 0x3d, 0xc3, 0x1a, 0x8e, 0x3e, 0x7c, 0xed, 0x07, 0xbc, 0x51, 0xff, 0x12, 0xbe, 0x13, 0xee, 0xb9, 0xbd, 0x9b, 0x69, 0x2a, 0xbd, 0xc6, 0xa0, 0xe0, 0x3d, 0xc0, 0x0f, 0x76, 0x3d, 0x56, 0x9c, 0x3d, 0x3e, 0xc0, 0xef, 0x97, 0xbd, 0x26, 0xf8, 0x52, 0x3d, 0x6d, 0xfd, 0xe9, 0x3c, 0x8e, 0x08, 0x0b, 0xbe, 0x3a, 0x96, 0xb4, 0xbd, 0xc7, 0x5a, 0x3a, 0x3e, 0x32, 0x50, 0x06, 0x3e, 0x1e, 0xe5, 0x18, 0x3e, 0xdf, 0xd6, 0xc3, 0x3d, 0xc3, 0xba, 0x69, 0x3c, 0x73, 0x17, 0x9a, 0x3d, 0xc8, 0xf3, 0xe9, 0x3d, 0x6c, 0x34, 0xa1, 0xbd, 0x78, 0x2a, 0x27, 0x3d, 0x28, 0xbd, 0x23, 0x3e, 0xe4, 0x17, 0xfe, 0x3a, 0xe8, 0xe2, 0x44, 0x3c, 0x91, 0xb5, 0x89, 0xbd, 0x75, 0xa3, 0xfc, 0x3d, 0xeb, 0x07, 0x77, 0xbe, 0x40, 0x77, 0x04, 0x3d, 0xe2, 0x89, 0x66, 0xbd, 0xc2, 0x8c, 0x3b, 0xbd, 0x5e, 0x07, 0xa7, 0x3c, 0xd8, 0xd7, 0xda, 0xbd, 0x27, 0x79, 0x47, 0xbc, 0x15, 0xb3, 0x2d, 0xbe, 0x8e, 0x3a, 0x09, 0x3d, 0xf8, 0x5b, 0x53, 0x3d, 0xd4, 0xdc, 0xc8, 0xbd, 0xdc, 0xf0, 0x78, 0xbd, 0x26, 0x22, 0xba, 0xbe, 0x98, 0xc4, 0xa1, 0xbb, 0x96, 0x2d, 0xb7, 0xbd, 0xf9, 0x51, 0x69, 0xbd, 0xe2, 0xa3, 0x03, 0x3e, 0x37, 0x40, 0x6a, 0xbe, 0x68, 0xb7, 0x54, 0x3e, 0x61, 0x84, 0x60, 0x3e, 0x23, 0x51, 0x81, 0x3c, 0xbd, 0xfb, 0x4d, 0xbe, 0x27, 0xff, 0x9e, 0x3d, 0x02, 0x50, 0x57, 0x3e, 0x12, 0xd3, 0xad, 0xbd, 0x47, 0xc6, 0x7d, 0x3c, 0xcf, 0x7a, 0x79, 0xbe, 0x6f, 0x5a, 0x3d, 0xbe, 0x50, 0x6f, 0xa7, 0xbd, 0x8e, 0x63, 0x6d, 0x3e, 0xf1, 0x92, 0x3d, 0xbc, 0xac, 0x7a, 0x81, 0x3e, 0xb0, 0x94, 0x01, 0x3f, 0xcf, 0xbc, 0x0b, 0xbe, 0xd2, 0xff, 0x45, 0x3e, 0xe6, 0xe3, 0x63, 0x3d, 0xde, 0x89, 0x8b, 0x3d, 0xdd, 0x30, 0x78, 0x3c, 0x91, 0xe6, 0x35, 0x3d, 0xa7, 0x30, 0x09, 0xbd, 0xd9, 0x5f, 0xa0, 0x3e, 0x2e, 0xb5, 0x1c, 0x3e, 0x13, 0x93, 0x58, 0x3e, 0x5d, 0x86, 0x6c, 0xbd, 0x51, 0xd3, 0xa6, 0x3c, 0x5f, 0x76, 0xd3, 0xbd, 0x8d, 0xc8, 0x7e, 0x3e, 0xa0, 0x03, 0xdd, 0x3d, 0x4f, 0x9c, 0xae, 0xbd, 0x09, 0xdd, 0xe6, 0xbd, 0x10, 0x1e, 0xa9, 0x3d, 0x83, 0x0e, 0x9a, 0x3d, 0xef, 0xc0, 0x64, 0x3d, 0xe5, 0x48, 0x8c, 0xba, 0x7f, 0x13, 0x66, 0xbd, 0x98, 0xba, 0x4e, 0x3e, 0x8f, 0x71, 0x72, 0x3e, 0xdb, 0x55, 0x36, 0xbd, 0x62, 0x3a, 0x8a, 0xbe, 0x71, 0x4d, 0xac, 0xbd, 0xa6, 0x20, 0x80, 0x3e, 0x46, 0xbf, 0xaf, 0xbd, 0x10, 0x64, 0x54, 0xbd, 0x44, 0x36, 0x13, 0x3d, 0x01, 0x3a, 0xf2, 0x3d, 0xf0, 0x5e, 0xe4, 0x3d, 0x83, 0x03, 0x00, 0xbe, 0xa1, 0xce, 0x00, 0x3f, 0x91, 0x63, 0xd5, 0x3d, 0x80, 0x55, 0x55, 0xbe, 0xb1, 0xf5, 0xe7, 0xbd, 0x55, 0xf9, 0x66, 0x3e, 0xf5, 0xd3, 0xcb, 0xbd, 0xfc, 0xbf, 0x36, 0x3d, 0xf4, 0x28, 0x53, 0xbe, 0x30, 0x3b, 0x89, 0xbd, 0x31, 0x78, 0x38, 0xbd, 0x6e, 0x8e, 0xc5, 0xbd, 0xcc, 0x94, 0x29, 0xbe, 0x41, 0x44, 0xff, 0x3c, 0xc8, 0x1b, 0x51, 0xbd, 0xb3, 0x31, 0x75, 0xbe, 0x53, 0xd0, 0xf8, 0x3d, 0xb5, 0xc9, 0x94, 0x3e, 0x74, 0x94, 0x93, 0xbd, 0xce, 0x95, 0x67, 0xbd, 0x52, 0x6a, 0x93, 0x3d, 0x28, 0x00, 0x01, 0xbe, 0x9f, 0x85, 0xe3, 0x3d, 0x46, 0xf1, 0x0b, 0x3e, 0x5c, 0x95, 0x97, 0xbc, 0x6e, 0x99, 0x2f, 0x3e, 0xf6, 0x8e, 0xf8, 0xbd, 0xd9, 0xd0, 0x62, 0xbe, 0xd9, 0xbc, 0x74, 0xbd, 0x61, 0x00, 0x1a, 0xbe, 0x3a, 0xb3, 0x85, 0x3d, 0xc8, 0x32, 0x4d, 0xbd, 0xa9, 0xb6, 0x01, 0xbd, 0x07, 0x73, 0x47, 0x3e, 0x76, 0xde, 0xf4, 0x3d, 0x48, 0xd0, 0x58, 0x3c, 0xf0, 0xca, 0x7b, 0xbd, 0x62, 0xf1, 0xd8, 0xbd, 0x1a, 0x03, 0x78, 0x3e, 0xae, 0x47, 0x9a, 0xbe, 0xb2, 0xc6, 0x7b, 0x3e, 0x28, 0x8d, 0x65, 0xbe, 0xb2, 0xa4, 0x12, 0xbe, 0x1e, 0x2a, 0x74, 0xbe, 0xaa, 0xbb, 0x64, 0x3e, 0xa9, 0x8d, 0x02, 0xbe, 0x0b, 0x02, 0x43, 0x3e, 0xd6, 0xbe, 0x0f, 0xbc, 0x0d, 0x39, 0xd7, 0x3c, 0x2f, 0x99, 0x88, 0x3e, 0xae, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x52, 0xc6, 0x72, 0x3e, 0xbc, 0x9a, 0x57, 0xbe, 0xed, 0x47, 0xa0, 0x3c, 0x61, 0x06, 0x3b, 0xbe, 0x61, 0x2f, 0x55, 0x3e, 0xe0, 0xd2, 0xd9, 0xbd, 0x4e, 0x17, 0x5b, 0x3e, 0x2c, 0x4d, 0x87, 0x3c, 0x4c, 0x07, 0x63, 0xbd, 0xe4, 0x8e, 0x16, 0xbe, 0x42, 0xa9, 0xb1, 0x3e, 0x3f, 0x90, 0xaa, 0x3d, 0x10, 0x78, 0x36, 0xbd, 0x30, 0x44, 0x52, 0xbd, 0x63, 0xa4, 0xb8, 0x3d, 0xea, 0x6c, 0x88, 0x3d, 0x5f, 0xf7, 0x3f, 0xbd, 0x92, 0xf0, 0x8a, 0x3d, 0xf8, 0xe3, 0x60, 0x3e, 0x26, 0xaf, 0x00, 0x3e, 0x8c, 0x51, 0xb4, 0xbd, 0xfe, 0x3d, 0x8b, 0xbd, 0x2f, 0x0a, 0xcb, 0x3d, 0xda, 0x0e, 0x92, 0xbd, 0x5a, 0xdd, 0x4d, 0x3e, 0x73, 0x19, 0x91, 0x3d, 0x21, 0xa0, 0x94, 0x3d, 0x5a, 0xd7, 0xcc, 0x3c, 0xa1, 0x08, 0xf2, 0x3d, 0x79, 0xbf, 0xdc, 0xbb, 0x41, 0x89, 0xcd, 0x3d, 0x4d, 0xa4, 0x23, 0xbe, 0x8a, 0xf4, 0x49, 0x3e, 0x12, 0xcf, 0x66, 0x3e, 0x0a, 0x82, 0xbd, 0x3e, 0xb4, 0xc5, 0x46, 0x3e, 0x9e, 0xb4, 0x0a, 0x3e, 0x9f, 0x5f, 0x59, 0xbe, 0xa7, 0x7e, 0x2b, 0x3e, 0x97, 0x3c, 0x76, 0x3e, 0xea, 0xdc, 0x68, 0x3b, 0xce, 0x56, 0x0b, 0xbe, 0xe8, 0x6f, 0x98, 0xbc, 0x70, 0xaf, 0x03, 0x3e, 0x9c, 0x62, 0xa3, 0x3e, 0xe8, 0x66, 0x6e, 0x3d, 0xfc, 0xae, 0x33, 0x3e, 0x51, 0x84, 0x08, 0xba, 0x3c, 0x43, 0x59, 0xbd, 0xa9, 0x7d, 0x8c, 0x3d, 0xdd, 0xe4, 0x38, 0xbd, 0xd1, 0x05, 0x54, 0x3d, 0x7c, 0x16, 0x7b, 0xbc, 0x4a, 0x67, 0x4b, 0x3e, 0x5f, 0x2c, 0xb9, 0x3b, 0xbe, 0x63, 0xd6, 0x3d, 0xb4, 0x50, 0x78, 0xbe, 0x0c, 0x6c, 0xc3, 0xbd, 0x59, 0xfb, 0x2f, 0x3c, 0xf3, 0x33, 0x8b, 0xbd, 0x30, 0x06, 0xdb, 0x3d, 0x17, 0xd5, 0xfb, 0x3d, 0x8e, 0x53, 0x13, 0xbe, 0x6a, 0x06, 0x2f, 0x3e, 0x2c, 0xaf, 0xa0, 0xbc, 0xd0, 0x58, 0x16, 0x3e, 0x37, 0x32, 0x20, 0xbd, 0x20, 0x0f, 0x2f, 0x3e, 0x05, 0x52, 0xe6, 0x3d, 0x47, 0xed, 0x04, 0xbd, 0x57, 0xb5, 0x26, 0x3e, 0x7e, 0x48, 0xde, 0xbd, 0x2d, 0x00, 0x3b, 0x3d, 0x63, 0xaa, 0x68, 0xbd, 0x9a, 0x63, 0xf1, 0x3d, 0xa0, 0x20, 0x43, 0x3d, 0x7b, 0xc8, 0x27, 0xbe, 0x88, 0xcd, 0xa2, 0xbd, 0x6e, 0x3c, 0xee, 0xbd, 0x5e, 0x7e, 0x40, 0xbe, 0xfc, 0xdc, 0xad, 0x3d, 0x0d, 0x57, 0xda, 0xbb, 0xfa, 0xbe, 0xba, 0x3e, 0xa9, 0xb2, 0x93, 0xbc, 0x4b, 0x28, 0xc3, 0x3d, 0xb1, 0xac, 0xd4, 0x3d, 0xae, 0x66, 0x99, 0x3d, 0xfc, 0xf4, 0x5c, 0x3c, 0x8f, 0xd6, 0x95, 0x3d, 0x77, 0xf5, 0xa3, 0xbd, 0x6b, 0x16, 0xa7, 0xbd, 0xa3, 0x9b, 0xe6, 0xbc, 0x5a, 0x3d, 0x1c, 0x3e, 0xd6, 0x22, 0x36, 0xbd, 0xd3, 0xe2, 0x97, 0xbe, 0xfc, 0x20, 0x36, 0xbd, 0xea, 0x95, 0xe4, 0x3b, 0x48, 0x2e, 0xbb, 0x3d, 0x60, 0xaa, 0x19, 0x3e, 0x66, 0x5a, 0xdc, 0x3d, 0x51, 0x6a, 0xe7, 0xbd, 0x96, 0xf7, 0xb8, 0x3d, 0x7f, 0xeb, 0x60, 0x3e, 0xcc, 0xac, 0x71, 0xbe, 0x7d, 0x6f, 0x10, 0x3e, 0x6d, 0xfe, 0x11, 0x3d, 0xf6, 0xb8, 0xac, 0xbc, 0x4f, 0x91, 0x72, 0xbd, 0x33, 0xd0, 0x62, 0xbd, 0x1c, 0x06, 0xe7, 0xbd, 0x45, 0xb6, 0xaf, 0x3d, 0xd4, 0xb3, 0xd3, 0x3d, 0x83, 0x74, 0xb2, 0xbd, 0x62, 0xab, 0x84, 0x3e, 0xd6, 0xd9, 0xd0, 0x3d, 0xeb, 0xf4, 0x85, 0xbd, 0x33, 0x01, 0x26, 0x3e, 0x33, 0xc3, 0xb0, 0xbd, 0x92, 0x8a, 0x69, 0x3d, 0x59, 0x69, 0xfd, 0xbc, 0x5e, 0x0f, 0xa7, 0x3e, 0x2b, 0x63, 0x46, 0xbc, 0xc4, 0xcc, 0x40, 0x3e, 0x63, 0x6b, 0x00, 0x3e, 0xf0, 0xf7, 0x85, 0xbd, 0xb0, 0xc9, 0xd1, 0xbe, 0xe5, 0x7e, 0x00, 0x3e, 0x8d, 0x2d, 0x62, 0xbe, 0x0b, 0x04, 0x36, 0xbe, 0x02, 0x32, 0x33, 0x3e, 0xf3, 0xab, 0xe9, 0x3c, 0xac, 0x32, 0x1a, 0x3e, 0x7e, 0xee, 0x39, 0xbe, 0xfc, 0xc6, 0xc6, 0xbe, 0x16, 0x6a, 0x3e, 0x3e, 0x1c, 0x0f, 0x8f, 0xbc, 0xc9, 0x34, 0xaa, 0xbd, 0xce, 0x83, 0x85, 0xbe, 0x46, 0x09, 0x0c, 0x3e, 0x66, 0x05, 0x5b, 0x3d, 0xa8, 0xac, 0x5a, 0xbd, 0x71, 0x5f, 0x56, 0x3c, 0x9b, 0x35, 0xbb, 0x3e, 0xcc, 0x40, 0x9e, 0x3d, 0xfa, 0xf9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x31, 0x30, 0x51, 0xbd, 0x34, 0x40, 0xa6, 0xbd, 0x31, 0x47, 0x04, 0x3e, 0xe0, 0x80, 0x85, 0x3e, 0x05, 0x0b, 0xa0, 0x3d, 0x3f, 0xd0, 0x1c, 0x3e, 0x96, 0xd7, 0x67, 0xbe, 0x06, 0xf0, 0x44, 0xbe, 0x1d, 0x08, 0x9d, 0x3e, 0x58, 0xa9, 0x29, 0x3e, 0x98, 0x26, 0x06, 0x3e, 0xa0, 0x2a, 0x6b, 0x3d, 0xd0, 0xd5, 0x3e, 0x3e, 0x5e, 0x45, 0xc9, 0xbe, 0x24, 0xe1, 0x8d, 0x3e, 0x97, 0x08, 0x2c, 0xbe, 0x07, 0x20, 0x11, 0xbe, 0xa8, 0x37, 0x87, 0xbd, 0x95, 0xc0, 0x4d, 0x3e, 0x6d, 0x7c, 0xcf, 0xbe, 0xee, 0x9c, 0x6e, 0x3e, 0xb8, 0xf0, 0x19, 0x3e, 0xc0, 0x74, 0xb9, 0xbd, 0x91, 0x14, 0x36, 0xbe, 0x82, 0xcb, 0x80, 0x3e, 0x45, 0x35, 0xdb, 0x3d, 0x9d, 0x18, 0x82, 0x3e, 0x8e, 0xdd, 0xf1, 0xbd, 0x97, 0xf0, 0x70, 0xbe, 0xb5, 0x76, 0xeb, 0x3d, 0x20, 0x8f, 0xde, 0x3d, 0xba, 0x00, 0x5b, 0xbe, 0x20, 0xfb, 0x9c, 0xbd, 0x33, 0x36, 0x4e, 0xbe, 0x1b, 0x9a, 0x06, 0xbd, 0x88, 0xf0, 0x4e, 0x3e, 0x12, 0x74, 0xbb, 0x3d, 0x48, 0x04, 0x41, 0x3b, 0xee, 0xe3, 0xe2, 0x3e, 0xce, 0x0c, 0x50, 0xbc, 0x4f, 0xcc, 0x0c, 0x3e, 0xa2, 0x72, 0x56, 0xbe, 0x11, 0xf9, 0x29, 0xbe, 0xa2, 0x51, 0x29, 0x3e, 0xdb, 0x52, 0x88, 0x3d, 0x72, 0x16, 0x1f, 0xbe, 0x8a, 0xa0, 0xc8, 0x3d, 0xa0, 0x8e, 0x4c, 0x3c, 0x97, 0xce, 0x23, 0x3e, 0xb8, 0xa5, 0x8d, 0xbe, 0xf6, 0x40, 0xa6, 0xbd, 0x1c, 0x71, 0x79, 0x3e, 0x30, 0xce, 0x08, 0x3d, 0x6e, 0xe2, 0x61, 0xbb, 0xcc, 0x63, 0xa5, 0x3d, 0xc3, 0x9d, 0xe9, 0x3d, 0x68, 0xbc, 0xc9, 0xbd, 0xbe, 0xe3, 0xdc, 0xbc, 0x0a, 0xdf, 0xb7, 0xbd, 0x27, 0xf0, 0x29, 0x3d, 0x55, 0x85, 0x27, 0xbe, 0xb5, 0xce, 0x52, 0xbe, 0xa4, 0x71, 0x88, 0xbb, 0xbc, 0xb7, 0x36, 0x3c, 0x39, 0x1f, 0x38, 0xbd, 0xe8, 0xc3, 0xd0, 0xbe, 0xfd, 0xa8, 0x93, 0x3d, 0x71, 0x22, 0xdb, 0xbd, 0x9a, 0xc3, 0xa9, 0x3e, 0x44, 0x8b, 0x5f, 0x3e, 0x60, 0x8b, 0x04, 0x3b, 0xbd, 0xcb, 0xa3, 0x3e, 0xd4, 0x2d, 0x1d, 0xbc, 0xa8, 0x51, 0x09, 0xbe, 0x8c, 0xa9, 0x71, 0xbb, 0x32, 0x98, 0x16, 0xbb, 0xbf, 0x30, 0xee, 0xbd, 0xbf, 0x5a, 0x3c, 0x3e, 0xaa, 0xdb, 0xa2, 0x3e, 0x88, 0x84, 0x38, 0xbd, 0xa8, 0xc8, 0x45, 0x3e, 0xeb, 0xfa, 0xda, 0x3e, 0xf5, 0x48, 0x27, 0x3e, 0xbe, 0xa3, 0x83, 0x3e, 0x46, 0xcd, 0x42, 0x3e, 0x5b, 0xa1, 0xbe, 0xbe, 0x0d, 0xc8, 0xbb, 0x3c, 0xe6, 0xaf, 0xc4, 0x3c, 0xa0, 0x8d, 0x0d, 0xbe, 0xed, 0x36, 0xf1, 0xbd, 0xe6, 0x4e, 0xb9, 0x3c, 0x5f, 0x1d, 0x8a, 0x3b, 0xe7, 0x5e, 0xb8, 0x3d, 0xb4, 0x50, 0x0f, 0x3e, 0x15, 0x1d, 0x35, 0x3d, 0x95, 0xef, 0x22, 0xbe, 0xc1, 0x4e, 0x10, 0xbe, 0xe6, 0x2a, 0x88, 0x3d, 0x0b, 0xd7, 0xaf, 0x3d, 0xa9, 0x9f, 0x8b, 0xbd, 0xd0, 0x8c, 0x3e, 0xbe, 0xc2, 0xfc, 0x4c, 0x3e, 0x79, 0xe7, 0x50, 0x3d, 0x4c, 0xd7, 0xa2, 0x3d, 0x14, 0x1c, 0x2b, 0xbe, 0x44, 0x13, 0x86, 0x3e, 0x1c, 0x29, 0xef, 0xbb, 0x5e, 0x8d, 0xb9, 0xbd, 0xca, 0x05, 0xef, 0x3d, 0x17, 0x40, 0x8f, 0x3b, 0x98, 0x86, 0x23, 0x3d, 0xac, 0x5c, 0x43, 0x3e, 0x96, 0x2c, 0xbf, 0xbd, 0xf4, 0x1f, 0x33, 0xbd, 0x09, 0x3d, 0xc7, 0x3d, 0xc9, 0xd9, 0x33, 0x3e, 0xf8, 0xc5, 0x61, 0xba, 0x6f, 0xf7, 0x05, 0x3e, 0x2d, 0x1e, 0x8a, 0x3e, 0xad, 0x43, 0x79, 0xbd, 0xd6, 0x3a, 0xfb, 0xbd, 0x66, 0x46, 0x19, 0x3e, 0x6a, 0x75, 0x42, 0xbd, 0x05, 0xf0, 0x5f, 0x3e, 0x58, 0x6a, 0x40, 0xbe, 0x4d, 0x51, 0xb0, 0xbe, 0x95, 0x2e, 0x55, 0x3e, 0x6a, 0x35, 0x99, 0x3c, 0x0a, 0xf7, 0x70, 0x3e, 0xa2, 0x05, 0xe5, 0xbd, 0xf6, 0xd4, 0x05, 0x3e, 0xbb, 0x36, 0xba, 0x3d, 0x90, 0x97, 0x1c, 0x3e, 0x64, 0x9b, 0x81, 0xbe, 0xe3, 0x0b, 0x05, 0xbe, 0xfc, 0x40, 0x9f, 0x3d, 0xd8, 0x5d, 0x5a, 0xbe, 0xb2, 0x56, 0x73, 0x3d, 0xaa, 0xac, 0x23, 0x3e, 0x99, 0x8c, 0x22, 0xbe, 0xa3, 0x69, 0xfa, 0xbd, 0x66, 0x22, 0x02, 0xbe, 0x6f, 0xc5, 0x26, 0x3e, 0x1a, 0x13, 0x8b, 0x3e, 0x46, 0xfc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x75, 0x6e, 0x85, 0x3d, 0x9f, 0xce, 0x22, 0xbd, 0x18, 0x37, 0x11, 0x3e, 0x7d, 0x04, 0x82, 0x3e, 0xd6, 0x19, 0x14, 0xbe, 0x74, 0x87, 0xa8, 0x3d, 0x27, 0x01, 0xdf, 0x3e, 0xb8, 0xcb, 0x06, 0x3e, 0x2b, 0xd4, 0xec, 0x3e, 0x04, 0xc9, 0x14, 0xbe, 0x59, 0x95, 0xff, 0xbd, 0x07, 0xa1, 0x69, 0x3e, 0xcb, 0xec, 0x60, 0xbe, 0x74, 0x8f, 0x09, 0xbe, 0xec, 0x31, 0xe7, 0xbd, 0x07, 0x12, 0xc2, 0xbc, 0xee, 0xcd, 0xeb, 0xbc, 0x8f, 0x1f, 0x67, 0xbe, 0x4c, 0xcf, 0x49, 0x3e, 0x64, 0x93, 0x06, 0xbf, 0x5d, 0x1d, 0x17, 0x3e, 0x44, 0xa6, 0xc2, 0x3d, 0x53, 0xc0, 0x2f, 0x3e, 0x55, 0x8d, 0x9f, 0xbd, 0xf4, 0xa3, 0x06, 0xbd, 0xb7, 0xd2, 0xaf, 0xbe, 0x35, 0x71, 0xb5, 0xbc, 0xe1, 0x43, 0x2d, 0xbe, 0x98, 0xd1, 0x14, 0x3b, 0xdc, 0xd1, 0xef, 0xbc, 0x88, 0x06, 0x29, 0x3e, 0xf1, 0xf1, 0x55, 0x3d, 0x2f, 0xfa, 0x31, 0xbe, 0x0f, 0x73, 0xc7, 0xbc, 0x87, 0x13, 0x3d, 0xbd, 0x79, 0x1a, 0xf2, 0x3c, 0x38, 0xe7, 0x42, 0x3e, 0x88, 0x7f, 0x0e, 0xbd, 0x50, 0x35, 0x20, 0xbe, 0x04, 0x67, 0x80, 0x3e, 0x71, 0xaf, 0x73, 0x3d, 0xb6, 0x61, 0xac, 0xbe, 0x98, 0xac, 0x2f, 0x3e, 0x71, 0x37, 0x41, 0xbd, 0x3b, 0x7c, 0x7f, 0x3d, 0x09, 0x7d, 0x45, 0xbd, 0x77, 0xe8, 0x95, 0x3d, 0xa1, 0x26, 0x5b, 0xbd, 0x23, 0xec, 0x97, 0x3c, 0x6d, 0xc6, 0x7e, 0x3d, 0x63, 0x90, 0xde, 0xbc, 0x8c, 0x91, 0x0f, 0x3e, 0x6e, 0x4e, 0x82, 0xbd, 0x0f, 0x7c, 0x48, 0x3d, 0x3f, 0x05, 0x5f, 0x3e, 0xd1, 0xa9, 0x84, 0x3e, 0x72, 0x28, 0x5b, 0xbd, 0x7c, 0x67, 0x96, 0x3e, 0xe1, 0x8f, 0x91, 0xbd, 0x65, 0x92, 0x8d, 0x3d, 0xcc, 0xda, 0xa4, 0x3d, 0x1f, 0x93, 0xf6, 0xbd, 0x58, 0x7a, 0xa4, 0x3e, 0x11, 0x81, 0x95, 0x3e, 0x61, 0x2c, 0x50, 0xbe, 0x2a, 0xff, 0xc0, 0xbc, 0x75, 0x6c, 0xb5, 0x3d, 0xab, 0x2e, 0xbf, 0xbd, 0x87, 0xfe, 0x29, 0x3e, 0xc5, 0x6b, 0xc9, 0xbd, 0x8e, 0xc2, 0xe8, 0x3d, 0x5d, 0x5c, 0x41, 0x3e, 0x65, 0x5a, 0x02, 0x3e, 0xf4, 0x65, 0xe2, 0xbc, 0xbf, 0xb9, 0xa5, 0xbd, 0x63, 0x52, 0x1c, 0xbe, 0xb1, 0x93, 0xb6, 0xbe, 0x46, 0x94, 0xb8, 0xbd, 0xa6, 0x38, 0x99, 0xbd, 0x4f, 0xea, 0xa3, 0x3d, 0x05, 0xb3, 0x7a, 0x3e, 0x01, 0x14, 0xea, 0x3d, 0x44, 0xab, 0x07, 0x3e, 0xc3, 0x1d, 0x75, 0xbc, 0x3d, 0xa6, 0x1d, 0xbd, 0x43, 0x0e, 0x84, 0xbe, 0xdb, 0xff, 0xc8, 0xbd, 0xfe, 0x57, 0x9a, 0x3d, 0xc9, 0x1e, 0xa6, 0x3e, 0x35, 0x03, 0xfa, 0xbb, 0x0e, 0xde, 0xc5, 0x3d, 0x09, 0xf6, 0x6d, 0xbe, 0x62, 0xc6, 0x35, 0x3d, 0x01, 0xef, 0xa7, 0xbe, 0x0a, 0x7b, 0x96, 0x3d, 0x7d, 0xf5, 0xd9, 0x3d, 0x29, 0x30, 0x8a, 0x3d, 0x62, 0x6b, 0x6d, 0xbe, 0x08, 0x33, 0x72, 0x3c, 0x8c, 0xce, 0x8d, 0xbd, 0x02, 0xe0, 0x43, 0xbe, 0x2a, 0x82, 0x15, 0x3d, 0x30, 0xe8, 0xc5, 0xbd, 0x50, 0x35, 0xcd, 0x3d, 0x18, 0x57, 0x81, 0x3d, 0xf5, 0x97, 0xd6, 0x3d, 0x21, 0xcb, 0x1b, 0x3e, 0xaa, 0xa7, 0x2f, 0x3e, 0xd1, 0x21, 0xb1, 0xbc, 0x2b, 0x32, 0x1b, 0x3e, 0xff, 0x49, 0xf5, 0x3d, 0x13, 0x27, 0x13, 0x3d, 0x68, 0x83, 0x40, 0x3e, 0x22, 0xd9, 0x40, 0xbd, 0x22, 0x7c, 0xa8, 0x3e, 0x7f, 0x97, 0x81, 0xbd, 0xae, 0x5c, 0x89, 0xbd, 0x25, 0x7d, 0xbf, 0x3c, 0x66, 0xe9, 0x8e, 0x3d, 0x6e, 0x5a, 0xdc, 0xbd, 0x30, 0x53, 0x1f, 0xbe, 0xb9, 0x99, 0xbb, 0x3d, 0xb8, 0x94, 0x5b, 0x3e, 0x66, 0xdb, 0x77, 0xbd, 0xd2, 0x2c, 0xce, 0x3d, 0xbb, 0x96, 0xef, 0x3c, 0xbf, 0xe3, 0x96, 0xbd, 0xab, 0x89, 0x1d, 0xbd, 0xff, 0xd4, 0xa0, 0xbd, 0x6c, 0xaa, 0x87, 0xbd, 0x66, 0x67, 0x82, 0x3e, 0xfc, 0x8d, 0x83, 0x3e, 0xf7, 0x28, 0x54, 0xbd, 0x32, 0xdc, 0xc6, 0xbc, 0x50, 0xec, 0xdb, 0x3e, 0x6a, 0x90, 0xa1, 0x3b, 0xdc, 0xd8, 0x9b, 0xbd, 0x03, 0xa5, 0x42, 0xbe, 0x8c, 0xfb, 0xa5, 0x3d, 0x53, 0x80, 0x40, 0xbd, 0x7e, 0xe5, 0xab, 0xbc, 0xa2, 0xac, 0xc2, 0x3d, 0xbf, 0x8b, 0x0b, 0xbd, 0xcf, 0x98, 0x2d, 0x3e, 0x92, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xea, 0xcf, 0x53, 0x3d, 0x55, 0xf5, 0xf6, 0xbc, 0xca, 0x78, 0x27, 0xbd, 0xaa, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2f, 0x83, 0x79, 0x3d, 0xa9, 0x1f, 0xdf, 0xbc, 0x59, 0xb0, 0x13, 0xbd, 0xcc, 0xd7, 0xb3, 0xbc, 0xd0, 0x51, 0x74, 0x3d, 0xbf, 0x2b, 0x7c, 0x3d, 0xce, 0xce, 0x85, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xab, 0x18, 0x5c, 0x3d, 0x23, 0xfb, 0xa6, 0x3d, 0xec, 0x71, 0xdf, 0xbc, 0x94, 0xc5, 0xb0, 0x3c, 0x83, 0x97, 0x1e, 0x3c, 0x85, 0x78, 0xe5, 0xbc, 0xca, 0x47, 0x49, 0xbc, 0xd3, 0x67, 0x3c, 0x3d, 0x1a, 0xb9, 0x5e, 0x3d, 0x24, 0x40, 0x42, 0x3d, 0x80, 0x87, 0x60, 0xbc, 0x89, 0x4a, 0x12, 0xbd, 0x31, 0xa7, 0xc0, 0x3d, 0x35, 0x2c, 0xa4, 0x3d, 0x90, 0xaa, 0x15, 0x3d, 0xc0, 0xdd, 0xb8, 0x3d, 0x37, 0x49, 0xb4, 0x3d, 0x4b, 0xb3, 0xb2, 0x3d, 0xec, 0x2c, 0x83, 0x3c, 0xb6, 0x4e, 0x54, 0x3d, 0x3f, 0xf4, 0x68, 0xbd, 0x3d, 0x5b, 0x7b, 0x3b, 0x8e, 0x4a, 0xa4, 0xbc, 0x81, 0x37, 0x20, 0x3b, 0x36, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xf1, 0xff, 0xff, 0x30, 0xf1, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf0, 0xf1, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xdc, 0x0b, 0x00, 0x00, 0x7c, 0x0b, 0x00, 0x00, 0x08, 0x0b, 0x00, 0x00, 0xac, 0x0a, 0x00, 0x00, 0x6c, 0x0a, 0x00, 0x00, 0x2c, 0x0a, 0x00, 0x00, 0xec, 0x09, 0x00, 0x00, 0xac, 0x09, 0x00, 0x00, 0x70, 0x09, 0x00, 0x00, 0x34, 0x09, 0x00, 0x00, 0xf8, 0x08, 0x00, 0x00, 0xbc, 0x08, 0x00, 0x00, 0x7c, 0x08, 0x00, 0x00, 0x3c, 0x08, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00, 0xe8, 0x06, 0x00, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0xa4, 0x05, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x94, 0x04, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe2, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xcc, 0xf4, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x14, 0xf5, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x64, 0x5f, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x56, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0xf6, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x75, 0x6e, 0x69, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5f, 0x6c, 0x73, 0x74, 0x6d, 0x31, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x90, 0xf6, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x5f, 0x31, 0x32, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x4a, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xd4, 0xf6, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x5f, 0x31, 0x32, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x32, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0xf7, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x75, 0x6e, 0x69, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5f, 0x6c, 0x73, 0x74, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xe2, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x6c, 0xf7, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x5f, 0x31, 0x32, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0xb8, 0xf7, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0xf8, 0xf7, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x50, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa2, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x8c, 0xf8, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xee, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xd8, 0xf8, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x64, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xba, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa4, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xfa, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xe4, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x76, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xb2, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9c, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xee, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd8, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2a, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6a, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x54, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xaa, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x94, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xea, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd4, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x54, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xaa, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x39, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd0, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x38, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x37, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5a, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x44, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x92, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x7c, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xca, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb4, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xec, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x28, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x64, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xdc, 0xfe, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x36, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x5f, 0x31, 0x32, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x78, 0x3a, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c };
@@ -24,7 +24,8 @@ void setup() {
     // replace with your own model!
     camera.pinout.freenove_s3();
     camera.brownout.disable();
-    // only works on 96x96 (yolo) grayscale images
+    // 96x96 (yolo) grayscale is fastest, but any resolution
+    // and grayscale/RGB565 pixel format works
     camera.resolution.yolo();
     camera.pixformat.gray();
 
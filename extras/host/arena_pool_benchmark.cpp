@@ -0,0 +1,95 @@
+/**
+ * Benchmark the cost of sharing one arena between the
+ * LSTM gesture model and the person detection model,
+ * run in turn, against giving each its own arena.
+ * Every switch re-plans the incoming model's tensors.
+ * Usage: arena_pool_benchmark [iterations]
+ */
+#include <Arduino.h>
+#include "tfModel.h"
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include <eloquent_tinyml/zoo/person_detection_model.h>
+
+#define LSTM_ARENA_SIZE 30000
+#define PERSON_ARENA_SIZE 90000
+
+using Eloquent::TF::Sequential;
+using Eloquent::TF::PooledSequential;
+using eloq::tinyml::zoo::personDetectionModel;
+
+
+/**
+ * Register person detection ops and init model
+ */
+template<typename TF>
+Exception& beginPerson(TF& tf) {
+    tf.setNumInputs(96 * 96);
+    tf.setNumOutputs(3);
+    tf.resolver.AddDepthwiseConv2D();
+    tf.resolver.AddConv2D();
+    tf.resolver.AddAveragePool2D();
+    tf.resolver.AddReshape();
+    tf.resolver.AddSoftmax();
+
+    return tf.begin(personDetectionModel);
+}
+
+
+int main(int argc, char **argv) {
+    const uint16_t iterations = argc > 1 ? atoi(argv[1]) : 100;
+    static Eloquent::TF::Arena::StaticPool<PERSON_ARENA_SIZE> pool;
+    static Sequential<TF_NUM_OPS, LSTM_ARENA_SIZE> lstm;
+    static Sequential<5, PERSON_ARENA_SIZE> person;
+    static PooledSequential<TF_NUM_OPS> pooledLstm;
+    static PooledSequential<5> pooledPerson;
+    static int8_t frame[96 * 96];
+    Eloquent::Extra::Time::StatBenchmark<1000> stats;
+
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+        frame[i] = (int8_t) (i * 31);
+
+    pooledLstm.arena.use(pool);
+    pooledPerson.arena.use(pool);
+    registerNetworkOps(lstm);
+    registerNetworkOps(pooledLstm);
+
+    if (!lstm.begin(tfModel).isOk() || !pooledLstm.begin(tfModel).isOk()) {
+        printf("lstm: %s / %s\n", lstm.exception.toCString(), pooledLstm.exception.toCString());
+        return 1;
+    }
+
+    if (!beginPerson(person).isOk() || !beginPerson(pooledPerson).isOk()) {
+        printf("person: %s / %s\n", person.exception.toCString(), pooledPerson.exception.toCString());
+        return 1;
+    }
+
+    stats.run([&]() {
+        lstm.predict(idle);
+        person.predict(frame);
+    }, iterations);
+
+    printf("private arenas (%u bytes)  lstm + person ", LSTM_ARENA_SIZE + PERSON_ARENA_SIZE);
+    stats.print(Serial);
+
+    pool.switches = 0;
+    stats.run([&]() {
+        pooledLstm.predict(idle);
+        pooledPerson.predict(frame);
+    }, iterations);
+
+    printf("shared pool (%u bytes)     lstm + person ", PERSON_ARENA_SIZE);
+    stats.print(Serial);
+    printf("switches per pair: %.1f\n", ((float) pool.switches) / (iterations + 5));
+
+    // each model alone keeps the pool: no re-plan
+    stats.run([&]() { pooledLstm.predict(idle); }, iterations);
+    printf("shared pool, lstm only                ");
+    stats.print(Serial);
+
+    stats.run([&]() { pooledPerson.predict(frame); }, iterations);
+    printf("shared pool, person only              ");
+    stats.print(Serial);
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+#ifndef ELOQUENTTINYML_HOST_ARDUINO_H
+#define ELOQUENTTINYML_HOST_ARDUINO_H
+
+/**
+ * Minimal Arduino API for running the library
+ * (and the examples) on a Linux host.
+ * Only what the library and the examples use is implemented
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include <string>
+#include <type_traits>
+
+
+/**
+ * Arduino String, backed by std::string
+ */
+class String {
+public:
+
+    /**
+     * Constructor
+     */
+    String(const char *s = "") :
+        _s(s == nullptr ? "" : s) {
+
+    }
+
+    /**
+     * Constructor
+     */
+    String(const std::string& s) :
+        _s(s) {
+
+    }
+
+    /**
+     * Construct from integer
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    String(T value) :
+        _s(std::to_string(value)) {
+
+    }
+
+    /**
+     * Construct from float (with given decimal places, like Arduino)
+     */
+    String(double value, uint8_t decimals = 2) {
+        char buffer[32];
+
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        _s = buffer;
+    }
+
+    /**
+     * Concatenate
+     */
+    template<typename T>
+    String operator+(const T& other) const {
+        return String(_s + String(other)._s);
+    }
+
+    /**
+     * Concatenate C string
+     */
+    String operator+(const char *other) const {
+        return String(_s + other);
+    }
+
+    /**
+     * Append
+     */
+    template<typename T>
+    String& operator+=(const T& other) {
+        _s += String(other)._s;
+
+        return *this;
+    }
+
+    /**
+     * Compare
+     */
+    bool operator==(const char *other) const {
+        return _s == other;
+    }
+
+    /**
+     * Test prefix
+     */
+    bool startsWith(const char *prefix) const {
+        return _s.compare(0, strlen(prefix), prefix) == 0;
+    }
+
+    /**
+     * Get C string
+     */
+    inline const char* c_str() const {
+        return _s.c_str();
+    }
+
+    /**
+     * Get length
+     */
+    inline size_t length() const {
+        return _s.size();
+    }
+
+protected:
+    std::string _s;
+};
+
+
+/**
+ * Micros since first call
+ */
+inline unsigned long micros() {
+    static struct timespec start = { 0, 0 };
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    if (start.tv_sec == 0 && start.tv_nsec == 0)
+        start = now;
+
+    return (now.tv_sec - start.tv_sec) * 1000000UL + (now.tv_nsec - start.tv_nsec) / 1000;
+}
+
+/**
+ * Millis since first call
+ */
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+/**
+ * Examples sleep to pace Serial output: skip it on host
+ */
+inline void delay(unsigned long) {
+}
+
+
+/**
+ * Serial, printing to stdout
+ */
+class HostSerial {
+public:
+
+    void begin(unsigned long) {
+    }
+
+    void print(const char *s) {
+        fputs(s, stdout);
+    }
+
+    void print(const String& s) {
+        print(s.c_str());
+    }
+
+    void print(char c) {
+        fputc(c, stdout);
+    }
+
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    void print(T value) {
+        print(String(value));
+    }
+
+    void print(double value, uint8_t decimals = 2) {
+        print(String(value, decimals));
+    }
+
+    template<typename T>
+    void println(const T& value) {
+        print(value);
+        println();
+    }
+
+    void println(double value, uint8_t decimals) {
+        print(value, decimals);
+        println();
+    }
+
+    void println() {
+        fputc('\n', stdout);
+        fflush(stdout);
+    }
+
+    operator bool() const {
+        return true;
+    }
+};
+
+inline HostSerial Serial;
+
+#endif //ELOQUENTTINYML_HOST_ARDUINO_H
@@ -0,0 +1,2 @@
+// lets the examples compile unchanged on host
+#include "tflm_host.h"
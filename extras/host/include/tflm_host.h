@@ -0,0 +1,19 @@
+#ifndef ELOQUENTTINYML_TFLM_HOST_H
+#define ELOQUENTTINYML_TFLM_HOST_H
+
+/**
+ * TensorFlow Lite for Microcontrollers runtime for Linux hosts,
+ * counterpart of <tflm_esp32.h> and <tflm_cortexm.h>
+ */
+
+#include <Arduino.h>
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define ELOQUENT_TFLM
+
+using namespace tflite;
+
+#endif //ELOQUENTTINYML_TFLM_HOST_H
@@ -0,0 +1,68 @@
+/**
+ * Benchmark the input copy of predict(x) against
+ * writing straight into the input view and calling invoke(),
+ * for the LSTM window (450 floats) and the person
+ * detection frame (9216 int8).
+ * Usage: input_copy_benchmark [iterations]
+ */
+#include <Arduino.h>
+#include "tfModel.h"
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include <eloquent_tinyml/zoo/person_detection.h>
+
+using eloq::tinyml::zoo::personDetection;
+
+
+/**
+ * Time predict(x), invoke() on a filled input view
+ * and the bare copy predict(x) does
+ */
+template<typename TF, typename T>
+void compare(const char *name, TF& tf, T *x, uint16_t iterations) {
+    Eloquent::Extra::Time::StatBenchmark<1000> stats;
+    static T scratch[96 * 96];
+    auto input = tf.template input<T>();
+
+    if (!input) {
+        printf("%-7s %s\n", name, tf.exception.toCString());
+        return;
+    }
+
+    stats.run([&]() { tf.predict(x); }, iterations);
+    printf("%-7s predict(x)      ", name);
+    stats.print(Serial);
+
+    memcpy(input.data(), x, sizeof(T) * input.length());
+    stats.run([&]() { tf.invoke(); }, iterations);
+    printf("%-7s view + invoke() ", name);
+    stats.print(Serial);
+
+    stats.run([&]() { memcpy(scratch, x, sizeof(T) * input.length()); }, iterations);
+    printf("%-7s memcpy only     ", name);
+    stats.print(Serial);
+}
+
+
+int main(int argc, char **argv) {
+    const uint16_t iterations = argc > 1 ? atoi(argv[1]) : 100;
+    static Eloquent::TF::Sequential<TF_NUM_OPS, 30000, TF_NUM_INPUTS, TF_NUM_OUTPUTS> lstm;
+    static int8_t frame[96 * 96];
+
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+        frame[i] = (int8_t) (i * 31);
+
+    registerNetworkOps(lstm);
+
+    if (lstm.begin(tfModel).isOk())
+        compare("lstm", lstm, idle, iterations);
+    else
+        printf("lstm    %s\n", lstm.exception.toCString());
+
+    if (personDetection.begin().isOk())
+        compare("person", personDetection.tf, frame, iterations);
+    else
+        printf("person  %s\n", personDetection.exception.toCString());
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+/**
+ * Run an Arduino sketch on Linux host:
+ * call setup() once, then loop() as many times
+ * as the first command line argument (default 1)
+ */
+#include <Arduino.h>
+#include SKETCH
+
+
+int main(int argc, char **argv) {
+    const int iterations = argc > 1 ? atoi(argv[1]) : 1;
+
+    setup();
+
+    for (int i = 0; i < iterations; i++)
+        loop();
+
+    return 0;
+}
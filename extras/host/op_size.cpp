@@ -0,0 +1,73 @@
+/**
+ * Smallest program that runs one model with one way of
+ * registering ops, to compare the binary size of each.
+ * Build all the combinations and print their sizes with
+ *   cmake --build build --target op_size
+ *
+ * OP_SIZE_MODEL: 1 = Iris, 2 = LSTM, 3 = person detection
+ * OP_SIZE_MODE:  1 = resolver.AddXxx() calls into MicroMutableOpResolver
+ *                2 = compile-time OpList (TF_OPS)
+ *                3 = TF_AUTO_OPS without TF_OPS (every known op)
+ */
+#include <Arduino.h>
+
+#if OP_SIZE_MODEL == 1
+#include "irisModel.h"
+#define OP_SIZE_DATA irisModel
+#define OP_SIZE_OPS Eloquent::TF::Op::FullyConnected, Eloquent::TF::Op::Softmax
+#elif OP_SIZE_MODEL == 2
+#include "tfModel.h"
+#define OP_SIZE_DATA tfModel
+#define OP_SIZE_OPS \
+    Eloquent::TF::Op::StridedSlice, Eloquent::TF::Op::Fill, Eloquent::TF::Op::Tanh, \
+    Eloquent::TF::Op::While, Eloquent::TF::Op::Slice, Eloquent::TF::Op::Maximum, \
+    Eloquent::TF::Op::Softmax, Eloquent::TF::Op::UnidirectionalSequenceLSTM, Eloquent::TF::Op::Pack, \
+    Eloquent::TF::Op::Gather, Eloquent::TF::Op::Less, Eloquent::TF::Op::Transpose, \
+    Eloquent::TF::Op::Shape, Eloquent::TF::Op::FullyConnected, Eloquent::TF::Op::Add, \
+    Eloquent::TF::Op::Reshape, Eloquent::TF::Op::Split, Eloquent::TF::Op::Relu, \
+    Eloquent::TF::Op::Concatenation, Eloquent::TF::Op::Mul, Eloquent::TF::Op::Minimum
+#else
+#include <eloquent_tinyml/zoo/person_detection_model.h>
+#define OP_SIZE_DATA eloq::tinyml::zoo::personDetectionModel
+#define OP_SIZE_OPS \
+    Eloquent::TF::Op::DepthwiseConv2D, Eloquent::TF::Op::Conv2D, Eloquent::TF::Op::AveragePool2D, \
+    Eloquent::TF::Op::Reshape, Eloquent::TF::Op::Softmax
+#endif
+
+#if OP_SIZE_MODE == 2
+#define TF_OPS OP_SIZE_OPS
+#elif OP_SIZE_MODE == 3
+#define TF_AUTO_OPS
+#endif
+
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+
+#define ARENA_SIZE 100000
+
+
+int main() {
+    static Eloquent::TF::Sequential<Eloquent::TF::OpList<OP_SIZE_OPS>::size, ARENA_SIZE> tf;
+
+#if OP_SIZE_MODE == 1 && OP_SIZE_MODEL == 2
+    registerNetworkOps(tf);
+#elif OP_SIZE_MODE == 1 && OP_SIZE_MODEL == 3
+    tf.resolver.AddDepthwiseConv2D();
+    tf.resolver.AddConv2D();
+    tf.resolver.AddAveragePool2D();
+    tf.resolver.AddReshape();
+    tf.resolver.AddSoftmax();
+#endif
+
+#if OP_SIZE_MODEL == 3
+    tf.setNumInputs(96 * 96);
+    tf.setNumOutputs(3);
+#endif
+
+    if (!tf.begin(OP_SIZE_DATA).isOk()) {
+        printf("%s\n", tf.exception.toCString());
+        return 1;
+    }
+
+    return tf.invoke().isOk() ? 0 : 1;
+}
@@ -0,0 +1,51 @@
+/**
+ * Run person detection on Linux host.
+ * Usage: person_detection [frame.raw] [iterations]
+ * frame.raw is a 96x96 8-bit grayscale image (9216 bytes).
+ * Without a frame, a flat gray image is used
+ */
+#include <Arduino.h>
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include <eloquent_tinyml/zoo/person_detection.h>
+
+using eloq::tinyml::zoo::personDetection;
+
+
+int main(int argc, char **argv) {
+    static uint8_t frame[96 * 96];
+    const int iterations = argc > 2 ? atoi(argv[2]) : 1;
+
+    memset(frame, 128, sizeof(frame));
+
+    if (argc > 1) {
+        FILE *f = fopen(argv[1], "rb");
+
+        if (f == nullptr || fread(frame, 1, sizeof(frame), f) != sizeof(frame)) {
+            fprintf(stderr, "Cannot read 96x96 frame from %s\n", argv[1]);
+            return 1;
+        }
+
+        fclose(f);
+    }
+
+    if (!personDetection.begin().isOk()) {
+        fprintf(stderr, "%s\n", personDetection.exception.toCString());
+        return 1;
+    }
+
+    for (int i = 0; i < iterations; i++) {
+        if (!personDetection.run(frame).isOk()) {
+            fprintf(stderr, "%s\n", personDetection.exception.toCString());
+            return 1;
+        }
+
+        printf("person=%d, not person=%d, detected=%d, %luus\n",
+               personDetection.personScore(),
+               personDetection.notPersonScore(),
+               (bool) personDetection,
+               (unsigned long) personDetection.tf.benchmark.microseconds());
+    }
+
+    return 0;
+}
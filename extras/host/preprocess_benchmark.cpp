@@ -0,0 +1,56 @@
+/**
+ * Benchmark the person detection front end
+ * (crop/letterbox + downscale + grayscale) on Linux host,
+ * for common camera resolutions.
+ * Usage: preprocess_benchmark [iterations]
+ */
+#include <Arduino.h>
+#include <vector>
+#include <eloquent_tinyml/benchmark.h>
+#include <eloquent_tinyml/image.h>
+
+using namespace Eloquent::TF::Image;
+
+
+int main(int argc, char **argv) {
+    const uint16_t iterations = argc > 1 ? atoi(argv[1]) : 100;
+    const struct { const char *name; uint16_t width; uint16_t height; } resolutions[] = {
+        { "96x96", 96, 96 },
+        { "QQVGA", 160, 120 },
+        { "QVGA", 320, 240 },
+        { "VGA", 640, 480 },
+        { "SVGA", 800, 600 },
+    };
+    const struct { const char *name; PixelFormat format; } formats[] = {
+        { "gray", PixelFormat::GRAY },
+        { "rgb565", PixelFormat::RGB565 },
+    };
+    const struct { const char *name; Fit fit; Interpolation interpolation; } modes[] = {
+        { "crop+area", Fit::CROP, Interpolation::AREA },
+        { "crop+bilinear", Fit::CROP, Interpolation::BILINEAR },
+        { "letterbox+area", Fit::LETTERBOX, Interpolation::AREA },
+    };
+    static int8_t tensor[96 * 96];
+
+    for (auto& resolution : resolutions) {
+        for (auto& format : formats) {
+            std::vector<uint8_t> frame((size_t) resolution.width * resolution.height * bytesPerPixel(format.format));
+
+            for (size_t i = 0; i < frame.size(); i++)
+                frame[i] = (i * 31) & 0xFF;
+
+            for (auto& mode : modes) {
+                Eloquent::Extra::Time::StatBenchmark<1000> stats;
+
+                stats.run([&]() {
+                    toGrayInt8(frame.data(), resolution.width, resolution.height, format.format, tensor, 96, 96, mode.fit, mode.interpolation);
+                }, iterations);
+
+                printf("%-6s %-7s %-15s ", resolution.name, format.name, mode.name);
+                stats.print(Serial);
+            }
+        }
+    }
+
+    return 0;
+}
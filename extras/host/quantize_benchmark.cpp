@@ -0,0 +1,53 @@
+/**
+ * Benchmark float to int8 quantization of one LSTM window
+ * (450 floats): exact per-element division (quantizePortable)
+ * against the reciprocal, pairwise-saturating quantizeSIMD.
+ * On host, saturatePair() runs its C fallback: only SIMD32
+ * cores (e.g. Cortex-M4) get SSAT16 / UXTB16.
+ * Usage: quantize_benchmark [iterations]
+ */
+#include <Arduino.h>
+#include <eloquent_tinyml/benchmark.h>
+#include <eloquent_tinyml/quantize.h>
+
+#define WINDOW 450
+
+using namespace Eloquent::TF;
+
+
+int main(int argc, char **argv) {
+    const uint16_t iterations = argc > 1 ? atoi(argv[1]) : 1000;
+    const float scale = 0.0235f;
+    const int32_t zeroPoint = -3;
+    static float x[WINDOW];
+    alignas(4) static int8_t y[WINDOW];
+    Eloquent::Extra::Time::StatBenchmark<1000> stats;
+
+    for (uint16_t i = 0; i < WINDOW; i++)
+        x[i] = ((i * 37) % 600 - 300) * 0.01f;
+
+    stats.run([&]() {
+        Kernels::quantizePortable(x, y, WINDOW, scale, zeroPoint);
+    }, iterations);
+
+    printf("portable (x / scale)   ");
+    stats.print(Serial);
+
+    stats.run([&]() {
+        const size_t done = Kernels::quantizeSIMD(x, y, WINDOW, scale, zeroPoint);
+
+        Kernels::quantizePortable(x + done, y + done, WINDOW - done, scale, zeroPoint);
+    }, iterations);
+
+    printf("simd (x * 1 / scale)   ");
+    stats.print(Serial);
+
+    stats.run([&]() {
+        Kernels::quantize(x, y, WINDOW, scale, zeroPoint);
+    }, iterations);
+
+    printf("quantize() dispatch    ");
+    stats.print(Serial);
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * Automatic op registration regression.
+ * Own translation unit: TF_AUTO_OPS and TF_OPS change
+ * how Sequential registers ops.
+ * With both defined, begin() must register only the listed
+ * ops the model uses, so numOps can be smaller than TF_OPS
+ */
+#include <Arduino.h>
+
+// iris.cpp includes it too: keep its samples out of the global namespace
+namespace iris {
+#include "irisModel.h"
+}
+
+using iris::irisModel;
+using iris::x0;
+
+// let begin() do all the registration
+#undef TF_OP_FULLYCONNECTED
+#undef TF_OP_SOFTMAX
+
+#define TF_AUTO_OPS
+#define TF_OPS \
+    Eloquent::TF::Op::FullyConnected, Eloquent::TF::Op::Softmax, \
+    Eloquent::TF::Op::Conv2D, Eloquent::TF::Op::Relu, Eloquent::TF::Op::Reshape
+
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include "suite.h"
+
+// not iris.cpp's 2000: Sequential's body depends on TF_AUTO_OPS / TF_OPS,
+// so the two translation units must not share an instantiation
+#define ARENA_SIZE 2048
+
+
+void regressAutoOps(Suite& suite) {
+    // 2 slots for the 2 ops Iris uses, out of the 5 listed
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE> tf;
+
+    if (!tf.begin(irisModel).isOk())
+        return suite.fail("ops.auto", tf.exception.toString());
+
+    suite.expect("ops.auto.count", tf.resolver.GetRegistrationLength() == 2, String("registered ") + tf.resolver.GetRegistrationLength() + " ops, Iris uses 2");
+    suite.expect("ops.auto.predict", tf.predict(x0).isOk(), tf.exception.toString());
+
+    // list FULLY_CONNECTED twice (as for two op versions):
+    // it still takes a single resolver slot
+    alignas(16) static unsigned char patched[sizeof(irisModel)];
+
+    memcpy(patched, irisModel, sizeof(irisModel));
+
+    const tflite::Model *model = tflite::GetModel(patched);
+    // generated tables inherit privately from flatbuffers::Table
+    flatbuffers::Table *softmax = (flatbuffers::Table*) model->operator_codes()->Get(1);
+    uint8_t *deprecated = softmax->GetAddressOf(tflite::OperatorCode::VT_DEPRECATED_BUILTIN_CODE);
+    uint8_t *builtin = softmax->GetAddressOf(tflite::OperatorCode::VT_BUILTIN_CODE);
+    const int32_t fullyConnected = tflite::BuiltinOperator_FULLY_CONNECTED;
+
+    if (deprecated != nullptr)
+        *deprecated = (uint8_t) fullyConnected;
+
+    if (builtin != nullptr)
+        memcpy(builtin, &fullyConnected, sizeof(fullyConnected));
+
+    suite.expect("ops.auto.distinct", Eloquent::TF::Ops::count(model) == 1, String("FULLY_CONNECTED listed twice counts as ") + Eloquent::TF::Ops::count(model) + " ops");
+}
@@ -0,0 +1,85 @@
+/**
+ * Iris regression: one translation unit per model,
+ * since model headers define TF_NUM_* / TF_OP_* macros
+ */
+#include <Arduino.h>
+#include "irisModel.h"
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include "suite.h"
+
+#define ARENA_SIZE 2000
+
+
+void regressIris(Suite& suite) {
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE, TF_NUM_INPUTS, TF_NUM_OUTPUTS> tf;
+    Eloquent::Extra::Time::StatBenchmark<100> stats;
+    float *samples[] = { x0, x1, x2 };
+    const char *names[] = { "iris.x0", "iris.x1", "iris.x2" };
+
+    if (!tf.begin(irisModel).isOk())
+        return suite.fail("iris", tf.exception.toString());
+
+    for (uint8_t i = 0; i < 3; i++) {
+        float y[TF_NUM_OUTPUTS];
+
+        if (!tf.predict(samples[i]).isOk())
+            return suite.fail(names[i], tf.exception.toString());
+
+        tf.copyOutputs(y);
+        suite.expectClass(names[i], i, tf.classification);
+        suite.expectOutputs(names[i], y, TF_NUM_OUTPUTS);
+    }
+
+    // Iris has no state: reset() is a no-op that must not break predict()
+    suite.expect("iris.reset", tf.reset().isOk() && tf.predict(x0).isOk(), "reset() on a live model must succeed");
+
+    stats.run(tf, x0);
+    suite.expectLatency("iris.latency", stats);
+
+    // one array per input tensor: Iris has a single one
+    suite.expect("iris.multiInput", !tf.predict(x0, x1).isOk() && tf.exception.code() == Eloquent::Error::ErrorCode::SHAPE, "predict(x0, x1) on a single-input model must fail with SHAPE");
+
+    // numOutputs can't exceed the output tensor
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE> oversized;
+
+    oversized.setNumOutputs(TF_NUM_OUTPUTS + 2);
+    suite.expect("iris.numOutputs", !oversized.begin(irisModel).isOk() && oversized.exception.code() == Eloquent::Error::ErrorCode::SHAPE, "begin() must reject numOutputs larger than the output tensor");
+
+    // nothing may run on a released arena
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE, TF_NUM_INPUTS, TF_NUM_OUTPUTS, float, float, Eloquent::TF::Arena::Heap> heap;
+
+    if (!heap.begin(irisModel).isOk())
+        return suite.fail("iris.end", heap.exception.toString());
+
+    heap.end();
+    suite.expect("iris.end.input", !heap.input<float>() && heap.exception.code() == Eloquent::Error::ErrorCode::NOT_READY, "input() after end() must fail with NOT_READY");
+    suite.expect("iris.end.reset", !heap.reset().isOk() && heap.exception.code() == Eloquent::Error::ErrorCode::NOT_READY, "reset() after end() must fail with NOT_READY");
+    suite.expect("iris.end.predict", !heap.predict(x0).isOk() && heap.exception.code() == Eloquent::Error::ErrorCode::NOT_READY, "predict() after end() must fail with NOT_READY");
+    suite.expect("iris.end.begin", heap.begin(irisModel).isOk() && heap.predict(x0).isOk(), "begin() after end() must work again");
+
+    // a destroyed pool user must give the pool back,
+    // so the next claim doesn't evict a dead object
+    static Eloquent::TF::Arena::StaticPool<ARENA_SIZE> pool;
+    static Eloquent::TF::PooledSequential<TF_NUM_OPS> survivor;
+
+    {
+        Eloquent::TF::PooledSequential<TF_NUM_OPS> scoped;
+
+        scoped.arena.use(pool);
+        scoped.setNumInputs(TF_NUM_INPUTS);
+        scoped.setNumOutputs(TF_NUM_OUTPUTS);
+
+        if (!scoped.begin(irisModel).isOk())
+            return suite.fail("iris.pool", scoped.exception.toString());
+    }
+
+    survivor.arena.use(pool);
+    // a pool smaller than its alignment skip is empty, not huge
+    alignas(16) static uint8_t tiny[2];
+    Eloquent::TF::Arena::Pool empty(tiny + 1, 1);
+
+    suite.expect("iris.pool.tiny", empty.data() == nullptr && empty.size() == 0, String("1 byte misaligned pool has size ") + empty.size());
+
+    suite.expect("iris.pool.destroyed", survivor.begin(irisModel).isOk() && survivor.predict(x0).isOk() && survivor.predict(x1).isOk(), survivor.exception.toString());
+}
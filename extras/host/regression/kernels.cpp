@@ -0,0 +1,150 @@
+/**
+ * Kernel checks: no model needed, no goldens.
+ * Quantization is compared with the reference
+ * clamp(round(x / scale) + zeroPoint) at the edges.
+ * Op registration must report a full resolver,
+ * ModelLoader failures must carry their error code
+ */
+#include <Arduino.h>
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include <eloquent_tinyml/motion_gate.h>
+#include "suite.h"
+
+using namespace Eloquent::TF;
+
+
+/**
+ * Reference quantization (float division, as TFLM's quantize kernel),
+ * NaN maps to zero point
+ */
+static int8_t referenceQuantize(float x, float scale, int32_t zeroPoint) {
+    if (x != x)
+        return zeroPoint;
+
+    const float q = roundf(x / scale) + zeroPoint;
+
+    return q < -128 ? -128 : (q > 127 ? 127 : (int8_t) q);
+}
+
+
+/**
+ * Both quantize paths against the reference.
+ * The SIMD path multiplies by 1 / scale, so it may be off by
+ * one at exact ties, but must saturate exactly
+ */
+static void regressQuantize(Suite& suite) {
+    const float scales[] = { 1.0f, 0.5f, 1.0f / 255, 0.0039215686f, 3.7f };
+    const int32_t zeroPoints[] = { -128, -1, 0, 5, 127 };
+    float x[64];
+    alignas(4) int8_t simd[64];
+    int8_t portable[64];
+
+    for (float scale : scales) {
+        for (int32_t zeroPoint : zeroPoints) {
+            uint8_t n = 0;
+
+            // exact ties, just around the clamp bounds, far out of range, non finite
+            x[n++] = 0;
+            x[n++] = 0.5f * scale;
+            x[n++] = -0.5f * scale;
+            x[n++] = 1.5f * scale;
+            x[n++] = -2.5f * scale;
+            x[n++] = (127 - zeroPoint) * scale;
+            x[n++] = (127.49f - zeroPoint) * scale;
+            x[n++] = (127.51f - zeroPoint) * scale;
+            x[n++] = (-128 - zeroPoint) * scale;
+            x[n++] = (-128.49f - zeroPoint) * scale;
+            x[n++] = (-128.51f - zeroPoint) * scale;
+            x[n++] = 1e10f;
+            x[n++] = -1e10f;
+            x[n++] = 3e38f;
+            x[n++] = INFINITY;
+            x[n++] = -INFINITY;
+            x[n++] = NAN;
+
+            while (n < 64) {
+                x[n] = (n * 37 % 300 - 150) * scale * 1.01f;
+                n++;
+            }
+
+            const size_t done = Kernels::quantizeSIMD(x, simd, 61, scale, zeroPoint);
+
+            Kernels::quantizePortable(x + done, simd + done, 61 - done, scale, zeroPoint);
+            Kernels::quantizePortable(x, portable, 61, scale, zeroPoint);
+
+            for (uint8_t i = 0; i < 61; i++) {
+                const int8_t expected = referenceQuantize(x[i], scale, zeroPoint);
+                const bool saturated = expected == -128 || expected == 127;
+                const int16_t error = simd[i] - expected;
+
+                if (portable[i] != expected || error < -1 || error > 1 || (saturated && error)) {
+                    suite.fail("kernels.quantize", String("x=") + String(x[i], 4) + " scale=" + String(scale, 6) + " zp=" + zeroPoint + ": expected " + expected + ", simd " + simd[i] + ", portable " + portable[i]);
+                    return;
+                }
+            }
+        }
+    }
+
+    suite.expect("kernels.quantize", true, "");
+}
+
+
+/**
+ * OpList registration and lookup
+ */
+static void regressOps(Suite& suite) {
+    using Ops = OpList<Op::FullyConnected, Op::Softmax>;
+    tflite::MicroMutableOpResolver<1> small;
+    tflite::MicroMutableOpResolver<2> fits;
+
+    suite.expect("ops.contains", Ops::contains(tflite::BuiltinOperator_SOFTMAX) && !Ops::contains(tflite::BuiltinOperator_CONV_2D), "OpList::contains() doesn't match its ops");
+    suite.expect("ops.full", Ops::registerIn(small) != kTfLiteOk, "registerIn() must fail when the resolver is full");
+    suite.expect("ops.fits", Ops::registerIn(fits) == kTfLiteOk, "registerIn() must succeed when the resolver has room");
+    suite.expect("ops.unlisted", Ops::add(fits, tflite::BuiltinOperator_CONV_2D) != kTfLiteOk, "OpList::add() must reject unlisted ops");
+}
+
+
+/**
+ * ModelLoader error codes
+ */
+static void regressLoader(Suite& suite) {
+    using Eloquent::Error::ErrorCode;
+    ModelLoader loader;
+    alignas(TF_ARENA_ALIGNMENT) static const uint8_t garbage[16] = { 0 };
+
+    suite.expect("loader.missing", !loader.fromPath("/nonexistent/model.tflite").isOk() && loader.exception.code() == ErrorCode::IO, "missing file must fail with IO");
+    suite.expect("loader.invalid", !loader.fromMemory(garbage, sizeof(garbage)).isOk() && loader.exception.code() == ErrorCode::MODEL, "non .tflite data must fail with MODEL");
+}
+
+
+/**
+ * MotionGate only counts frames whose inference ran
+ */
+static void regressMotionGate(Suite& suite) {
+    using namespace Eloquent::TF::Image;
+    MotionGate<8, 8> gate;
+    static uint8_t frame[16 * 16];
+
+    memset(frame, 128, sizeof(frame));
+
+    if (!gate.enable(4, 0))
+        return suite.fail("motion", "enable() can't allocate frames");
+
+    // inference failed: not executed, next frame runs again
+    const bool first = gate.update(frame, 16, 16, PixelFormat::GRAY);
+    const bool retry = gate.update(frame, 16, 16, PixelFormat::GRAY);
+
+    suite.expect("motion.failed", first && retry && gate.executed == 0, "a frame whose inference failed must not count as executed");
+
+    gate.ran();
+    suite.expect("motion.skip", !gate.update(frame, 16, 16, PixelFormat::GRAY) && gate.executed == 1 && gate.skipped == 1, "a static frame after a successful inference must be skipped");
+}
+
+
+void regressKernels(Suite& suite) {
+    regressQuantize(suite);
+    regressOps(suite);
+    regressLoader(suite);
+    regressMotionGate(suite);
+}
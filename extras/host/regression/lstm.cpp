@@ -0,0 +1,38 @@
+/**
+ * LSTM gesture regression
+ */
+#include <Arduino.h>
+#include "tfModel.h"
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include "suite.h"
+
+#define ARENA_SIZE 30000
+
+
+void regressLstm(Suite& suite) {
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE, TF_NUM_INPUTS, TF_NUM_OUTPUTS> tf;
+    Eloquent::Extra::Time::StatBenchmark<100> stats;
+    float *samples[] = { idle, horizontal, vertical };
+    const char *names[] = { "lstm.idle", "lstm.horizontal", "lstm.vertical" };
+
+    registerNetworkOps(tf);
+
+    if (!tf.begin(tfModel).isOk())
+        return suite.fail("lstm", tf.exception.toString());
+
+    for (uint8_t i = 0; i < 3; i++) {
+        float y[TF_NUM_OUTPUTS];
+
+        // independent windows: LSTM state must not leak across them
+        if (!tf.reset().isOk() || !tf.predict(samples[i]).isOk())
+            return suite.fail(names[i], tf.exception.toString());
+
+        tf.copyOutputs(y);
+        suite.expectClass(names[i], i, tf.classification);
+        suite.expectOutputs(names[i], y, TF_NUM_OUTPUTS);
+    }
+
+    stats.run(tf, idle);
+    suite.expectLatency("lstm.latency", stats);
+}
@@ -0,0 +1,66 @@
+/**
+ * Golden-output and latency regression suite.
+ * Usage: regression [--record] [--strict] [--tolerance=1e-3] [--threshold=0.2]
+ *                   [--goldens=path] [--baseline=path]
+ *
+ * Without --record, checks each model's predicted classes,
+ * compares outputs against the goldens file within tolerance
+ * and fails if median/p95/p99 latency is more than threshold
+ * (relative) slower than the baseline file.
+ * Checks missing from goldens/baseline are skipped, or failed with --strict.
+ * With --record, overwrites goldens and baseline with current values.
+ * Exits non-zero on any failure
+ */
+#include <Arduino.h>
+#include "suite.h"
+
+void regressKernels(Suite& suite);
+void regressIris(Suite& suite);
+void regressAutoOps(Suite& suite);
+void regressLstm(Suite& suite);
+void regressPersonDetection(Suite& suite);
+
+
+int main(int argc, char **argv) {
+    Suite suite;
+    String goldens = REGRESSION_DIR "/goldens.txt";
+    String baseline = REGRESSION_DIR "/baseline.txt";
+
+    for (int i = 1; i < argc; i++) {
+        const String arg(argv[i]);
+
+        if (arg == "--record")
+            suite.record = true;
+        else if (arg == "--strict")
+            suite.strict = true;
+        else if (arg.startsWith("--tolerance="))
+            suite.tolerance = atof(argv[i] + 12);
+        else if (arg.startsWith("--threshold="))
+            suite.threshold = atof(argv[i] + 12);
+        else if (arg.startsWith("--goldens="))
+            goldens = argv[i] + 10;
+        else if (arg.startsWith("--baseline="))
+            baseline = argv[i] + 11;
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    suite.load(goldens.c_str(), baseline.c_str());
+    regressKernels(suite);
+    regressIris(suite);
+    regressAutoOps(suite);
+    regressLstm(suite);
+    regressPersonDetection(suite);
+    suite.save();
+
+    if (suite.record) {
+        printf("Recorded %s and %s\n", goldens.c_str(), baseline.c_str());
+        return suite.failures > 0;
+    }
+
+    printf("%u failure(s), %u skipped\n", suite.failures, suite.skipped);
+
+    return suite.failures > 0;
+}
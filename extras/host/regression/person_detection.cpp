@@ -0,0 +1,103 @@
+/**
+ * Person detection regression.
+ * Two real frames (person_frames.h) with a known label,
+ * plus a flat gray frame and a horizontal gradient
+ */
+#include <Arduino.h>
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+#include <eloquent_tinyml/zoo/person_detection.h>
+#include "suite.h"
+#include "person_frames.h"
+
+using eloq::tinyml::zoo::personDetection;
+
+
+void regressPersonDetection(Suite& suite) {
+    static uint8_t flat[96 * 96];
+    static uint8_t gradient[96 * 96];
+    const uint8_t *frames[] = { flat, gradient, astronaut, coffee };
+    const char *names[] = { "person.flat", "person.gradient", "person.astronaut", "person.coffee" };
+    // 1 = person
+    const uint8_t labels[] = { 0, 0, 1, 0 };
+    Eloquent::Extra::Time::StatBenchmark<20> stats;
+
+    memset(flat, 128, sizeof(flat));
+
+    for (uint16_t i = 0; i < sizeof(gradient); i++)
+        gradient[i] = (i % 96) * 255 / 95;
+
+    // failures of the model reach personDetection.exception
+    personDetection.run(flat);
+    suite.expect("person.notReady", personDetection.exception.code() == Eloquent::Error::ErrorCode::NOT_READY, "run() before begin() didn't fail");
+
+    // search() buffers only exist between the first search() and end()
+    const bool unallocated = personDetection.tiles == nullptr;
+
+    personDetection.search(flat, 96, 96);
+    suite.expect("person.search.alloc", unallocated && personDetection.tiles != nullptr && personDetection.exception.code() == Eloquent::Error::ErrorCode::NOT_READY, "search() must allocate its tiles, then fail before begin()");
+    personDetection.end();
+    suite.expect("person.search.free", personDetection.tiles == nullptr && personDetection.heatmap == nullptr, "end() must release search() buffers");
+
+    if (!personDetection.begin().isOk())
+        return suite.fail("person", personDetection.exception.toString());
+
+    for (uint8_t i = 0; i < 4; i++) {
+        Eloquent::Error::Exception& exception = personDetection.run(frames[i], 96, 96);
+
+        if (!exception.isOk())
+            return suite.fail(names[i], exception.toString());
+
+        const float y[] = { (float) personDetection.personScore(), (float) personDetection.notPersonScore() };
+
+        suite.expectClass(names[i], labels[i], (bool) personDetection);
+        suite.expectOutputs(names[i], y, 2);
+    }
+
+    stats.run([]() { personDetection.run(flat); });
+    suite.expectLatency("person.latency", stats);
+
+    // predictInt8() must match quantizing by hand into the input tensor,
+    // and its outputs the reference's (goldens.txt)
+    static float x[96 * 96];
+    auto& tf = personDetection.tf;
+    const float scale = tf.in->params.scale;
+    const int32_t zeroPoint = tf.in->params.zero_point;
+    float expected[2];
+    float y[2];
+
+    // some values fall out of the int8 range, to exercise clamping
+    for (uint16_t i = 0; i < sizeof(x) / sizeof(float); i++)
+        x[i] = ((i * 37) % 301 - 150) / 100.0f;
+
+    auto input = tf.input<int8_t>();
+
+    if (!input)
+        return suite.fail("person.predictInt8", tf.exception.toString());
+
+    // not Kernels::quantize(): that's what predictInt8() runs
+    for (uint16_t i = 0; i < input.length(); i++) {
+        const float q = roundf(x[i] / scale) + zeroPoint;
+
+        input[i] = q < -128 ? -128 : (q > 127 ? 127 : (int8_t) q);
+    }
+
+    if (!tf.invoke().isOk())
+        return suite.fail("person.predictInt8", tf.exception.toString());
+
+    for (uint8_t i = 0; i < 2; i++)
+        expected[i] = tf.outputs()[i];
+
+    if (!tf.predictInt8(x).isOk())
+        return suite.fail("person.predictInt8", tf.exception.toString());
+
+    bool same = true;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        y[i] = tf.outputs()[i];
+        same = same && y[i] == expected[i];
+    }
+
+    suite.expect("person.predictInt8.quantize", same, "predictInt8() differs from roundf(x / scale) + zero point + invoke()");
+    suite.expectOutputs("person.predictInt8", y, 2);
+}
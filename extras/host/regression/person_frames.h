@@ -0,0 +1,1171 @@
+/**
+ * 96x96 grayscale test frames for the person detection regression.
+ * astronaut: scikit-image data/astronaut.png (Eileen Collins, NASA, public domain)
+ * coffee: scikit-image data/coffee.png (Rachel Michetti, CC0)
+ * Converted to grayscale (PIL "L"), center-cropped to a square
+ * and downscaled with PIL's BOX filter
+ */
+#ifndef ELOQUENTTINYML_HOST_REGRESSION_PERSON_FRAMES_H
+#define ELOQUENTTINYML_HOST_REGRESSION_PERSON_FRAMES_H
+
+#include <stdint.h>
+
+static const uint8_t astronaut[96 * 96] = {
+    0xa4, 0x9c, 0x1a, 0x04, 0x10, 0x15, 0x4e, 0x36, 0x98, 0xa1, 0xa2, 0xa1, 0xa3, 0xa6, 0xa8, 0xa9,
+    0xac, 0xad, 0xaf, 0xb1, 0xb1, 0xad, 0xa8, 0xa7, 0xa9, 0xad, 0xb4, 0xb9, 0xbb, 0xbc, 0xbb, 0xb8,
+    0xb4, 0xb8, 0xc2, 0xc6, 0xc8, 0xc4, 0xc0, 0xc1, 0xbf, 0xbc, 0xbc, 0xbb, 0xbe, 0xc3, 0xca, 0xcd,
+    0xcb, 0xca, 0xc8, 0xc6, 0xc8, 0xc9, 0xc7, 0xc7, 0xc7, 0xc5, 0xc4, 0xc0, 0xbf, 0xc1, 0xc3, 0xc6,
+    0xca, 0xcf, 0xd3, 0xd1, 0xcb, 0xc4, 0xbf, 0xb8, 0xb5, 0xb4, 0xae, 0xa3, 0x63, 0x51, 0x3f, 0x3f,
+    0x9a, 0xa3, 0xa3, 0x9f, 0x9d, 0x9b, 0x99, 0x96, 0x90, 0x87, 0x82, 0x80, 0x7d, 0x7c, 0x7a, 0x77,
+    0xde, 0x84, 0x11, 0x03, 0x0e, 0x13, 0x76, 0x57, 0x97, 0xa8, 0xa8, 0xa7, 0xa8, 0xaa, 0xaa, 0xaa,
+    0xad, 0xaf, 0xb0, 0xb2, 0xb1, 0xae, 0xab, 0xab, 0xac, 0xb0, 0xb6, 0xb9, 0xbb, 0xbc, 0xbe, 0xbf,
+    0xbd, 0xc0, 0xc4, 0xc7, 0xc7, 0xc1, 0xbc, 0xbe, 0xbe, 0xbc, 0xbc, 0xbf, 0xc3, 0xc8, 0xcc, 0xcd,
+    0xcd, 0xca, 0xc6, 0xc5, 0xc4, 0xc6, 0xc4, 0xc1, 0xc2, 0xc3, 0xc4, 0xc3, 0xc2, 0xc4, 0xc6, 0xc6,
+    0xc8, 0xcc, 0xcf, 0xd3, 0xcf, 0xc8, 0xc4, 0xc1, 0xc0, 0xbc, 0xb6, 0x8b, 0x53, 0x4c, 0x42, 0x2a,
+    0x66, 0xa2, 0xa4, 0xa3, 0xa1, 0x9f, 0x9e, 0x9d, 0x97, 0x8e, 0x87, 0x83, 0x7f, 0x7b, 0x79, 0x77,
+    0xd7, 0xb0, 0x32, 0x03, 0x1b, 0x55, 0x9a, 0x8e, 0x84, 0xaf, 0xae, 0xac, 0xac, 0xad, 0xae, 0xad,
+    0xaf, 0xb1, 0xb3, 0xb2, 0xb1, 0xad, 0xab, 0xac, 0xac, 0xb1, 0xb9, 0xbb, 0xba, 0xbb, 0xbf, 0xc4,
+    0xc4, 0xc3, 0xc3, 0xc4, 0xc0, 0xbc, 0xbb, 0xbd, 0xbd, 0xba, 0xba, 0xba, 0xc5, 0xca, 0xcd, 0xcd,
+    0xcd, 0xca, 0xc6, 0xc5, 0xc3, 0xc2, 0xbf, 0xbe, 0xc0, 0xc2, 0xc2, 0xc4, 0xc5, 0xc1, 0xc0, 0xc0,
+    0xc3, 0xc8, 0xd0, 0xd5, 0xd2, 0xce, 0xcc, 0xca, 0xc8, 0xc1, 0xb7, 0x69, 0x52, 0x4a, 0x41, 0x2e,
+    0x2d, 0x9a, 0xa8, 0xa8, 0xa7, 0xa6, 0xa3, 0xa2, 0x9d, 0x97, 0x8f, 0x88, 0x83, 0x7e, 0x7b, 0x77,
+    0x84, 0x48, 0x36, 0x06, 0x21, 0x5e, 0x96, 0x9c, 0x73, 0xb0, 0xb2, 0xb0, 0xad, 0xae, 0xb1, 0xb1,
+    0xb0, 0xb1, 0xb3, 0xb3, 0xaf, 0xac, 0xab, 0xab, 0xae, 0xb6, 0xbc, 0xbc, 0xbb, 0xbc, 0xc1, 0xc5,
+    0xc5, 0xc4, 0xc3, 0xc2, 0xbf, 0xbd, 0xb9, 0xb4, 0xa3, 0x81, 0x7d, 0x89, 0x9f, 0xa2, 0xa3, 0xc2,
+    0xd0, 0xcd, 0xc7, 0xc4, 0xc2, 0xc1, 0xc1, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xbf, 0xbc, 0xbf, 0xc0,
+    0xc2, 0xc8, 0xd0, 0xd3, 0xcf, 0xd1, 0xd1, 0xd1, 0xce, 0xc8, 0xab, 0x58, 0x52, 0x4a, 0x41, 0x30,
+    0x1e, 0x76, 0xac, 0xab, 0xa9, 0xa8, 0xa5, 0xa2, 0x9f, 0x9c, 0x96, 0x8e, 0x88, 0x82, 0x7c, 0x78,
+    0x37, 0x28, 0x15, 0x07, 0x08, 0x11, 0x60, 0x6e, 0x50, 0xa9, 0xb7, 0xb5, 0xb1, 0xb1, 0xb2, 0xb2,
+    0xb1, 0xb2, 0xb3, 0xb4, 0xb2, 0xaf, 0xae, 0xb0, 0xb4, 0xba, 0xbd, 0xbc, 0xbd, 0xbf, 0xc1, 0xc3,
+    0xc3, 0xc3, 0xc1, 0xc1, 0xbb, 0x99, 0x71, 0x69, 0x7c, 0x9e, 0xb4, 0xbe, 0xb7, 0xa4, 0x7f, 0x75,
+    0x85, 0xaf, 0xc3, 0xc1, 0xc2, 0xc2, 0xc3, 0xc3, 0xc2, 0xc4, 0xc5, 0xc5, 0xbf, 0xbe, 0xc4, 0xc4,
+    0xc5, 0xc9, 0xcf, 0xd2, 0xd1, 0xd3, 0xd7, 0xd6, 0xd3, 0xd1, 0x97, 0x55, 0x54, 0x4c, 0x41, 0x30,
+    0x20, 0x45, 0xad, 0xae, 0xac, 0xa9, 0xa8, 0xa7, 0xa4, 0x9f, 0x9b, 0x98, 0x92, 0x8a, 0x80, 0x7b,
+    0x20, 0x2c, 0x16, 0x09, 0x05, 0x13, 0x39, 0x2b, 0x15, 0x8f, 0xbc, 0xba, 0xb8, 0xb5, 0xb4, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb5, 0xb8, 0xbb, 0xbf, 0xc0, 0xc1, 0xc5, 0xc5, 0xc2, 0xc0,
+    0xc0, 0xc2, 0xbf, 0xb3, 0x60, 0x5e, 0x89, 0x8d, 0x7b, 0x89, 0xa6, 0xb5, 0xad, 0xa3, 0x90, 0x75,
+    0x69, 0x62, 0x7d, 0xa5, 0xc3, 0xc4, 0xc4, 0xc3, 0xc2, 0xc2, 0xc5, 0xc6, 0xc5, 0xc7, 0xc8, 0xc8,
+    0xc7, 0xc9, 0xcf, 0xd2, 0xd2, 0xd4, 0xd6, 0xd6, 0xd3, 0xcf, 0x80, 0x5d, 0x5c, 0x76, 0x47, 0x31,
+    0x20, 0x28, 0xa8, 0xb2, 0xae, 0xab, 0xad, 0xaa, 0xa7, 0xa3, 0x9f, 0x9b, 0x95, 0x8a, 0x82, 0x7f,
+    0x20, 0x2d, 0x1a, 0x0b, 0x03, 0x10, 0x14, 0x12, 0x11, 0x65, 0xbb, 0xbb, 0xb7, 0xb6, 0xb4, 0xb3,
+    0xb3, 0xb2, 0xb1, 0xb1, 0xb3, 0xb6, 0xbb, 0xbf, 0xc1, 0xc3, 0xc4, 0xc6, 0xc9, 0xc9, 0xc7, 0xc4,
+    0xc3, 0xc1, 0xba, 0x75, 0x1b, 0x4f, 0x67, 0x72, 0x8c, 0x97, 0xac, 0xbe, 0xbb, 0xaa, 0x91, 0x83,
+    0x71, 0x64, 0x5f, 0x6c, 0xa2, 0xc5, 0xc6, 0xc4, 0xc3, 0xc2, 0xc4, 0xc8, 0xc8, 0xc7, 0xc8, 0xc7,
+    0xc6, 0xc5, 0xc7, 0xcc, 0xcf, 0xd1, 0xd4, 0xd4, 0xd1, 0xc8, 0x73, 0xa0, 0xa1, 0xd4, 0x5f, 0x33,
+    0x22, 0x1c, 0x9f, 0xb4, 0xae, 0xad, 0xae, 0xab, 0xa9, 0xa7, 0xa4, 0x9f, 0x99, 0x8e, 0x83, 0x7e,
+    0x21, 0x2d, 0x1f, 0x0d, 0x02, 0x0e, 0x13, 0x13, 0x12, 0x39, 0xb4, 0xba, 0xb8, 0xb8, 0xb6, 0xb3,
+    0xb1, 0xaf, 0xae, 0xaf, 0xb2, 0xb6, 0xbc, 0xbf, 0xc1, 0xc2, 0xc3, 0xc5, 0xc7, 0xc8, 0xc7, 0xc4,
+    0xb8, 0xa6, 0x8b, 0x4b, 0x11, 0x32, 0x73, 0x87, 0x99, 0xa0, 0xad, 0x9d, 0x8b, 0x62, 0x5e, 0x70,
+    0x77, 0x76, 0x5b, 0x69, 0x6e, 0x84, 0xc5, 0xc8, 0xc6, 0xc4, 0xc6, 0xca, 0xca, 0xca, 0xc8, 0xc7,
+    0xc4, 0xc2, 0xc2, 0xc6, 0xc9, 0xcd, 0xd3, 0xd2, 0xce, 0xc0, 0x6c, 0x80, 0x82, 0xc6, 0x60, 0x36,
+    0x26, 0x1a, 0x98, 0xbb, 0xae, 0xac, 0xab, 0xab, 0xad, 0xae, 0xa9, 0xa2, 0x9b, 0x91, 0x86, 0x80,
+    0x22, 0x2e, 0x25, 0x10, 0x03, 0x0a, 0x12, 0x12, 0x12, 0x1b, 0xa2, 0xbb, 0xb7, 0xb5, 0xb2, 0xaf,
+    0xad, 0xac, 0xad, 0xad, 0xb1, 0xb3, 0xb7, 0xbb, 0xbd, 0xbd, 0xbe, 0xbe, 0xc1, 0xc3, 0xc1, 0xaa,
+    0x7e, 0x86, 0x95, 0x57, 0x2f, 0x77, 0x71, 0x74, 0x83, 0x94, 0xa2, 0xa2, 0x93, 0x9c, 0x83, 0x7b,
+    0x77, 0x5f, 0x48, 0x67, 0x66, 0x4f, 0x98, 0xcb, 0xca, 0xc6, 0xc6, 0xc7, 0xca, 0xcc, 0xcb, 0xc8,
+    0xc1, 0xbe, 0xc2, 0xc5, 0xc5, 0xc9, 0xcd, 0xcd, 0xda, 0xb7, 0x6a, 0x5f, 0x5f, 0x75, 0x53, 0x36,
+    0x2d, 0x1c, 0xa1, 0xca, 0xa8, 0xae, 0xa8, 0xa8, 0xad, 0xaf, 0xa8, 0x9e, 0x9a, 0x92, 0x89, 0x81,
+    0x39, 0x5a, 0x29, 0x13, 0x03, 0x17, 0x19, 0x13, 0x15, 0x12, 0x82, 0xb8, 0xb7, 0xb4, 0xb2, 0xad,
+    0xaa, 0xaa, 0xab, 0xac, 0xae, 0xb1, 0xb5, 0xb9, 0xb9, 0xb9, 0xba, 0xbb, 0xbc, 0xbc, 0xa7, 0x74,
+    0x64, 0x6b, 0x82, 0x6e, 0x68, 0x73, 0x8d, 0x92, 0x92, 0x9c, 0x91, 0x87, 0x6f, 0x7c, 0x86, 0x96,
+    0x89, 0x5c, 0x4f, 0x57, 0x5a, 0x48, 0x50, 0xcb, 0xcd, 0xc9, 0xc7, 0xc6, 0xc7, 0xcb, 0xce, 0xcd,
+    0xc1, 0xbe, 0xc3, 0xc3, 0xc2, 0xc4, 0xc8, 0xcb, 0xe3, 0xb2, 0x65, 0x5c, 0x5a, 0x59, 0x50, 0x38,
+    0x33, 0x20, 0xb1, 0xcf, 0xa0, 0xb0, 0xae, 0xae, 0xab, 0xa9, 0xa5, 0x9f, 0x9b, 0x94, 0x8e, 0x88,
+    0xc0, 0x5e, 0x2b, 0x15, 0x05, 0x2f, 0x5b, 0x35, 0x51, 0x17, 0x57, 0xb6, 0xb7, 0xb5, 0xb0, 0xab,
+    0xa8, 0xa8, 0xaa, 0xad, 0xad, 0xb0, 0xb4, 0xb6, 0xb7, 0xb7, 0xb8, 0xb8, 0xba, 0x9e, 0x71, 0x5e,
+    0x4e, 0x5a, 0x84, 0x8b, 0x7f, 0x61, 0x6d, 0x6d, 0x7c, 0x8c, 0x99, 0x9a, 0x96, 0x8e, 0x81, 0x7b,
+    0x72, 0x5e, 0x33, 0x2f, 0x50, 0x49, 0x37, 0x9d, 0xd1, 0xcf, 0xcb, 0xc8, 0xc8, 0xc9, 0xcc, 0xcc,
+    0xc3, 0xbe, 0xbf, 0xbf, 0xc0, 0xc3, 0xc5, 0xcf, 0xe2, 0xbd, 0x66, 0x6c, 0x72, 0x76, 0x4f, 0x39,
+    0x39, 0x3b, 0xcd, 0xd0, 0x9b, 0xb0, 0xb2, 0xb2, 0xae, 0xaa, 0xa6, 0xa2, 0x9c, 0x97, 0x92, 0x90,
+    0xca, 0x46, 0x2c, 0x18, 0x07, 0x36, 0x9f, 0x9f, 0x45, 0x14, 0x30, 0xa9, 0xb4, 0xb4, 0xb0, 0xad,
+    0xab, 0xa9, 0xac, 0xae, 0xb0, 0xb2, 0xb4, 0xb5, 0xb3, 0xb3, 0xb4, 0xb6, 0xb3, 0x68, 0x71, 0x56,
+    0x4d, 0x63, 0x7a, 0x72, 0x70, 0x5f, 0x4c, 0x67, 0x6c, 0x76, 0x8d, 0x99, 0x93, 0x97, 0xb6, 0xa5,
+    0x67, 0x48, 0x27, 0x1c, 0x47, 0x4a, 0x27, 0x65, 0xd0, 0xd1, 0xd2, 0xd1, 0xd0, 0xcd, 0xcc, 0xcc,
+    0xc5, 0xc0, 0xbe, 0xbd, 0xbd, 0xc1, 0xc3, 0xd8, 0xea, 0xc7, 0x6a, 0x60, 0x63, 0x6a, 0x51, 0x3b,
+    0x3f, 0x71, 0xe4, 0xd3, 0x9b, 0xa8, 0xb3, 0xb4, 0xb1, 0xac, 0xa7, 0xa3, 0x9f, 0x9b, 0x98, 0x93,
+    0xbc, 0x8d, 0x34, 0x1b, 0x0b, 0x50, 0x97, 0xa8, 0x40, 0x13, 0x19, 0x95, 0xaf, 0xb2, 0xaf, 0xaf,
+    0xad, 0xaa, 0xab, 0xae, 0xaf, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb4, 0x9f, 0x5f, 0x70, 0x60,
+    0x5f, 0x6a, 0x66, 0x83, 0x8e, 0x80, 0x64, 0x64, 0x66, 0x81, 0x8e, 0x95, 0x9a, 0x92, 0x94, 0x9b,
+    0x82, 0x38, 0x2a, 0x2a, 0x3e, 0x41, 0x34, 0x61, 0xd1, 0xd3, 0xd4, 0xd3, 0xd2, 0xd0, 0xcb, 0xcb,
+    0xc8, 0xc6, 0xc1, 0xbe, 0xbd, 0xc0, 0xc2, 0xdd, 0xea, 0xca, 0x6c, 0x5b, 0x5c, 0x56, 0x4f, 0x3c,
+    0x43, 0x8a, 0xe6, 0xd1, 0x99, 0xa1, 0xb6, 0xb2, 0xb1, 0xac, 0xa7, 0xa5, 0xa2, 0x9e, 0x9c, 0x98,
+    0x35, 0x40, 0x32, 0x1d, 0x0c, 0x0e, 0x7c, 0x7a, 0x73, 0x26, 0x11, 0x72, 0xb0, 0xb3, 0xb4, 0xb1,
+    0xac, 0xa9, 0xa8, 0xaa, 0xb1, 0xb4, 0xb2, 0xb1, 0xb1, 0xb0, 0xb3, 0xb4, 0x98, 0x52, 0x5e, 0x7d,
+    0x7d, 0x5b, 0x48, 0x80, 0x71, 0x6e, 0x72, 0x69, 0x6e, 0x79, 0x82, 0x80, 0x7a, 0x87, 0x7b, 0x6f,
+    0x5a, 0x3c, 0x30, 0x4f, 0x47, 0x42, 0x48, 0x41, 0xc5, 0xcf, 0xd1, 0xd0, 0xcc, 0xcb, 0xca, 0xc8,
+    0xc6, 0xc5, 0xc1, 0xbe, 0xc0, 0xc2, 0xc3, 0xdd, 0xe8, 0xc7, 0x6a, 0x5c, 0x5f, 0x58, 0x4f, 0x3d,
+    0x42, 0x8c, 0xe5, 0xcf, 0xa2, 0xa8, 0xb7, 0xb4, 0xb3, 0xaf, 0xab, 0xa6, 0xa2, 0xa0, 0x9f, 0x9e,
+    0x2b, 0x2a, 0x2a, 0x1f, 0x0f, 0x03, 0x4d, 0x1c, 0x13, 0x14, 0x11, 0x4b, 0xad, 0xb5, 0xb6, 0xb0,
+    0xa9, 0xa8, 0xa8, 0xaa, 0xb1, 0xb5, 0xb4, 0xb2, 0xb2, 0xb1, 0xb2, 0xb4, 0xa1, 0x4a, 0x57, 0x6e,
+    0x88, 0x40, 0x45, 0xa1, 0x98, 0x6f, 0x78, 0x79, 0x73, 0x70, 0x72, 0x6d, 0x52, 0x5f, 0x5a, 0x44,
+    0x2e, 0x33, 0x33, 0x2f, 0x3f, 0x46, 0x46, 0x32, 0xaa, 0xcb, 0xcd, 0xc9, 0xc6, 0xc8, 0xca, 0xc6,
+    0xc3, 0xbf, 0xb9, 0xb9, 0xbe, 0xc2, 0xc3, 0xdb, 0xe6, 0x75, 0x17, 0x43, 0x4d, 0x48, 0x49, 0x3c,
+    0x42, 0x8d, 0xe5, 0xcd, 0xa6, 0xa9, 0xb8, 0xb7, 0xb5, 0xb1, 0xab, 0xa8, 0xa5, 0xa5, 0xa3, 0xa0,
+    0x2a, 0x27, 0x27, 0x20, 0x12, 0x02, 0x10, 0x0e, 0x10, 0x11, 0x14, 0x2e, 0xa5, 0xb5, 0xb6, 0xaf,
+    0xa8, 0xa7, 0xa9, 0xad, 0xb2, 0xb5, 0xb6, 0xb6, 0xb4, 0xb3, 0xb2, 0xb3, 0xad, 0x61, 0x50, 0x67,
+    0x60, 0x36, 0x50, 0xb4, 0xc8, 0xbc, 0xb6, 0xb2, 0xbe, 0xb1, 0xaa, 0xa1, 0x7f, 0x6b, 0x4e, 0x2b,
+    0x1a, 0x25, 0x2d, 0x37, 0x3a, 0x3b, 0x40, 0x25, 0x87, 0xcc, 0xcd, 0xc4, 0xc2, 0xc7, 0xc8, 0xc7,
+    0xc2, 0xbb, 0xb4, 0xb5, 0xb9, 0xc0, 0xc3, 0xda, 0xd8, 0x48, 0x0b, 0x16, 0x29, 0x3c, 0x3d, 0x37,
+    0x3f, 0x8c, 0xe4, 0xcb, 0x9c, 0xa5, 0xba, 0xba, 0xb8, 0xb4, 0xad, 0xaa, 0xa8, 0xa7, 0xa3, 0x9e,
+    0x2d, 0x23, 0x23, 0x22, 0x14, 0x03, 0x06, 0x0b, 0x11, 0x12, 0x14, 0x25, 0x9b, 0xb3, 0xb1, 0xad,
+    0xaa, 0xa8, 0xa9, 0xad, 0xb4, 0xb7, 0xb8, 0xb7, 0xb7, 0xb6, 0xb4, 0xb4, 0xaa, 0x57, 0x56, 0x59,
+    0x44, 0x2d, 0x62, 0xb1, 0xb5, 0xb9, 0xc1, 0xd2, 0xe4, 0xe1, 0xdd, 0xdd, 0xd2, 0xc5, 0xb1, 0x80,
+    0x45, 0x26, 0x16, 0x1e, 0x32, 0x32, 0x3f, 0x3f, 0x77, 0xcd, 0xca, 0xc4, 0xc2, 0xc6, 0xc7, 0xc5,
+    0xbf, 0xbd, 0xb9, 0xb7, 0xb7, 0xbc, 0xc1, 0xd7, 0xd8, 0xb7, 0xb3, 0x45, 0x15, 0x36, 0x3a, 0x34,
+    0x38, 0x86, 0xe3, 0xcc, 0x9c, 0xaa, 0xbe, 0xbc, 0xb9, 0xb5, 0xaf, 0xac, 0xa9, 0xa6, 0xa0, 0x9c,
+    0x30, 0x22, 0x22, 0x21, 0x16, 0x05, 0x05, 0x09, 0x11, 0x11, 0x20, 0x76, 0xa3, 0xaf, 0xac, 0xac,
+    0xad, 0xac, 0xac, 0xb0, 0xb5, 0xb8, 0xb8, 0xb8, 0xb8, 0xb7, 0xb7, 0xb5, 0xac, 0x43, 0x37, 0x3e,
+    0x42, 0x39, 0x75, 0xb0, 0xce, 0xd8, 0xc9, 0xb3, 0xc3, 0xda, 0xdb, 0xd2, 0xbf, 0xac, 0xae, 0x9c,
+    0x6d, 0x59, 0x24, 0x06, 0x23, 0x2c, 0x31, 0x33, 0x95, 0xcc, 0xc5, 0xc2, 0xc0, 0xc2, 0xc3, 0xc3,
+    0xc1, 0xc0, 0xc0, 0xbe, 0xbc, 0xbc, 0xbb, 0xd1, 0xd5, 0xc8, 0xbf, 0x54, 0x0d, 0x2d, 0x34, 0x2f,
+    0x2e, 0x7e, 0xe4, 0xcb, 0x9a, 0xad, 0xc1, 0xbc, 0xb9, 0xb5, 0xb3, 0xb1, 0xab, 0xa6, 0xa1, 0x9e,
+    0x39, 0x22, 0x1f, 0x23, 0x19, 0x07, 0x03, 0x07, 0x11, 0x18, 0x75, 0xa5, 0xa2, 0xaa, 0xac, 0xae,
+    0xb0, 0xb1, 0xb1, 0xb3, 0xb6, 0xb7, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb7, 0xb7, 0x3d, 0x26, 0x28,
+    0x3b, 0x3c, 0x8f, 0xaf, 0x7c, 0x60, 0x52, 0x8d, 0xae, 0xd3, 0xd6, 0xb4, 0x90, 0x8a, 0x81, 0x96,
+    0x99, 0x67, 0x33, 0x0b, 0x23, 0x32, 0x2f, 0x30, 0xb5, 0xc0, 0xba, 0xbb, 0xbd, 0xbd, 0xbf, 0xc0,
+    0xc2, 0xc1, 0xc1, 0xc1, 0xbf, 0xbd, 0xb9, 0xcd, 0xde, 0xe5, 0xd9, 0x71, 0x0e, 0x28, 0x38, 0x32,
+    0x2c, 0x71, 0xe2, 0xca, 0x9a, 0xb0, 0xc4, 0xbf, 0xbc, 0xb9, 0xb7, 0xb4, 0xad, 0xa9, 0xa5, 0xa0,
+    0x9e, 0x2b, 0x1e, 0x26, 0x1b, 0x0b, 0x03, 0x07, 0x19, 0x6a, 0xa5, 0xab, 0xa6, 0xa8, 0xae, 0xb0,
+    0xb3, 0xb3, 0xb4, 0xb5, 0xb5, 0xb4, 0xb5, 0xb7, 0xb8, 0xb9, 0xb9, 0xba, 0xbb, 0x6f, 0x37, 0x23,
+    0x25, 0x41, 0xa7, 0xb6, 0xa2, 0x9a, 0x81, 0xa5, 0xae, 0xcd, 0xcb, 0x92, 0x95, 0x8c, 0x4d, 0x7c,
+    0x61, 0x76, 0x42, 0x0f, 0x21, 0x48, 0x31, 0x59, 0xbf, 0xbb, 0xb6, 0xb8, 0xbb, 0xbd, 0xbf, 0xbf,
+    0xc0, 0xc2, 0xc3, 0xc4, 0xc4, 0xc2, 0xc0, 0xba, 0x85, 0x93, 0xc1, 0x7f, 0x16, 0x1c, 0x35, 0x30,
+    0x2a, 0x63, 0xde, 0xc9, 0x98, 0xb3, 0xc8, 0xc4, 0xbf, 0xbd, 0xbc, 0xb7, 0xb2, 0xac, 0xa8, 0xa2,
+    0x89, 0x23, 0x1b, 0x27, 0x1c, 0x0d, 0x04, 0x0d, 0x65, 0xa3, 0xab, 0xae, 0xaa, 0xa7, 0xae, 0xb1,
+    0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb5, 0xb7, 0xb8, 0xb9, 0xba, 0xbc, 0xbe, 0xb9, 0x58, 0x1e,
+    0x26, 0x4b, 0xaf, 0xcd, 0xd4, 0xd0, 0xc4, 0xbe, 0xbe, 0xcc, 0xc1, 0x93, 0xba, 0xc0, 0xae, 0x9b,
+    0x81, 0x95, 0x58, 0x14, 0x20, 0x50, 0x18, 0x77, 0xc1, 0xbe, 0xbc, 0xbc, 0xbc, 0xbd, 0xbc, 0xbc,
+    0xbf, 0xc1, 0xc2, 0xc4, 0xc5, 0xc5, 0xc6, 0xd8, 0xf3, 0xb3, 0x9f, 0x91, 0x47, 0x12, 0x31, 0x2e,
+    0x28, 0x5a, 0xd4, 0xc7, 0x95, 0xb5, 0xcb, 0xc8, 0xc2, 0xbe, 0xbb, 0xb8, 0xb3, 0xaf, 0xa9, 0xa3,
+    0xa8, 0x2b, 0x1a, 0x26, 0x1f, 0x10, 0x05, 0x24, 0x94, 0xa6, 0xac, 0xaf, 0xad, 0xa6, 0xb1, 0xb2,
+    0xb3, 0xb3, 0xb2, 0xb1, 0xb1, 0xb3, 0xb5, 0xb7, 0xb9, 0xbb, 0xbb, 0xbd, 0xbf, 0xc1, 0xb9, 0x59,
+    0x35, 0x61, 0xb2, 0xd1, 0xde, 0xdb, 0xda, 0xd5, 0xbf, 0xc8, 0xba, 0x94, 0xb8, 0xc8, 0xc8, 0xc0,
+    0xad, 0x9b, 0x64, 0x18, 0x25, 0x43, 0x34, 0xc1, 0xc5, 0xc2, 0xc1, 0xc1, 0xc1, 0xbf, 0xbe, 0xbf,
+    0xc0, 0xc2, 0xc2, 0xc1, 0xc1, 0xc3, 0xc8, 0xe0, 0xe1, 0xdc, 0xc4, 0x99, 0x6e, 0x0c, 0x2c, 0x2d,
+    0x27, 0x57, 0xc8, 0xc6, 0x94, 0xb2, 0xc9, 0xc7, 0xc2, 0xbd, 0xb9, 0xb6, 0xb4, 0xb0, 0xaa, 0xa5,
+    0x9e, 0x4c, 0x17, 0x21, 0x21, 0x0f, 0x09, 0x1f, 0x79, 0xa4, 0xad, 0xb0, 0xae, 0xa7, 0xb0, 0xb3,
+    0xb2, 0xb0, 0xb1, 0xb1, 0xb2, 0xb3, 0xb6, 0xb8, 0xba, 0xbb, 0xbb, 0xbe, 0xc0, 0xc5, 0xc9, 0xb7,
+    0x8b, 0x87, 0xb0, 0xcd, 0xdc, 0xe3, 0xd1, 0xc8, 0xc0, 0xc1, 0xbb, 0x95, 0xa6, 0xc7, 0xc9, 0xc7,
+    0xb4, 0x90, 0x5a, 0x19, 0x1e, 0x3f, 0xae, 0xcc, 0xca, 0xc8, 0xc6, 0xc6, 0xc5, 0xc4, 0xc3, 0xc5,
+    0xc3, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc8, 0xde, 0xdc, 0xe2, 0xc5, 0x95, 0x6c, 0x09, 0x24, 0x2b,
+    0x25, 0x56, 0xbb, 0xc5, 0x92, 0xae, 0xc5, 0xc3, 0xc1, 0xbe, 0xba, 0xb8, 0xb3, 0xae, 0xab, 0xa7,
+    0x35, 0x2a, 0x19, 0x1e, 0x22, 0x0f, 0x16, 0x1f, 0x3b, 0x92, 0xac, 0xb0, 0xaf, 0xaa, 0xae, 0xb2,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb5, 0xb7, 0xba, 0xbb, 0xba, 0xbc, 0xbe, 0xc2, 0xc8, 0xcd, 0xcd,
+    0xc0, 0xbe, 0xb0, 0xc7, 0xd4, 0xcf, 0xa5, 0xb8, 0xc1, 0xc7, 0xc6, 0x95, 0x8a, 0xb2, 0xcb, 0xcf,
+    0xaf, 0x84, 0x53, 0x1d, 0x39, 0xbc, 0xcd, 0xcd, 0xcc, 0xcb, 0xcc, 0xcd, 0xcd, 0xca, 0xc9, 0xc8,
+    0xc6, 0xc5, 0xc5, 0xc5, 0xc6, 0xc3, 0xc9, 0xea, 0xe8, 0xe7, 0xd0, 0x98, 0x68, 0x07, 0x1a, 0x29,
+    0x24, 0x53, 0xb2, 0xc1, 0x90, 0xb1, 0xc5, 0xc3, 0xc1, 0xbf, 0xbd, 0xb9, 0xb3, 0xb0, 0xac, 0xa9,
+    0x32, 0x2b, 0x19, 0x1c, 0x1b, 0x1c, 0x20, 0x20, 0x25, 0x55, 0xa2, 0xaf, 0xaf, 0xac, 0xaa, 0xb1,
+    0xb4, 0xb6, 0xb6, 0xb6, 0xb7, 0xb7, 0xb9, 0xbc, 0xbc, 0xbe, 0xc0, 0xc1, 0xc4, 0xca, 0xce, 0xce,
+    0xcb, 0xbf, 0xa7, 0xb7, 0xba, 0xa0, 0xb0, 0xbb, 0xa6, 0xaf, 0xa7, 0x7c, 0x7c, 0x8d, 0xb7, 0xbe,
+    0xa5, 0x7b, 0x6f, 0x63, 0xb4, 0xd0, 0xcf, 0xce, 0xcd, 0xcc, 0xcc, 0xcf, 0xd1, 0xd0, 0xcc, 0xcb,
+    0xcc, 0xcb, 0xcb, 0xcc, 0xca, 0xc7, 0xca, 0xeb, 0xe7, 0xe7, 0xd0, 0x96, 0x64, 0x07, 0x12, 0x27,
+    0x22, 0x50, 0xab, 0xbb, 0x8e, 0xb5, 0xc9, 0xc5, 0xc2, 0xc0, 0xbe, 0xba, 0xb6, 0xb1, 0xae, 0xaa,
+    0x30, 0x2b, 0x17, 0x18, 0x1f, 0x2c, 0x21, 0x22, 0x22, 0x2d, 0x71, 0xab, 0xb0, 0xae, 0xa6, 0xb3,
+    0xb7, 0xb8, 0xb9, 0xb8, 0xb9, 0xba, 0xbb, 0xbd, 0xbf, 0xc1, 0xc2, 0xc3, 0xc6, 0xcf, 0xd1, 0xd2,
+    0xd3, 0xd3, 0xae, 0xb4, 0xb2, 0xab, 0xc4, 0xc6, 0xca, 0xc3, 0xa6, 0x96, 0x8d, 0x98, 0xa2, 0xb1,
+    0x8d, 0x77, 0x99, 0xba, 0xd7, 0xd3, 0xd0, 0xd0, 0xcd, 0xcd, 0xcc, 0xce, 0xcf, 0xd0, 0xcf, 0xd0,
+    0xd2, 0xd2, 0xd3, 0xd0, 0xcd, 0xcb, 0xcf, 0xed, 0xe8, 0xe9, 0xd0, 0x95, 0x60, 0x05, 0x0b, 0x24,
+    0x21, 0x4f, 0xa7, 0xb7, 0x8c, 0xb2, 0xc8, 0xc6, 0xc4, 0xc2, 0xbf, 0xba, 0xb6, 0xb3, 0xb1, 0xac,
+    0x2f, 0x2b, 0x16, 0x22, 0x29, 0x2e, 0x20, 0x23, 0x1f, 0x2b, 0x38, 0x8c, 0xad, 0xad, 0xa6, 0xb3,
+    0xba, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xbd, 0xbd, 0xc0, 0xc3, 0xc4, 0xc4, 0xc8, 0xd3, 0xd7, 0xd8,
+    0xd6, 0xd5, 0xb1, 0xbe, 0xcf, 0xca, 0x79, 0xa9, 0xb2, 0xb9, 0xaf, 0x95, 0x70, 0x64, 0xb2, 0xb6,
+    0x88, 0x7f, 0xdb, 0xdc, 0xd7, 0xd3, 0xd2, 0xd2, 0xd0, 0xcf, 0xce, 0xcd, 0xd0, 0xd2, 0xd3, 0xd3,
+    0xd4, 0xd6, 0xd6, 0xd2, 0xce, 0xcc, 0xd1, 0xed, 0xe8, 0xe9, 0xd1, 0x92, 0x5d, 0x05, 0x06, 0x20,
+    0x20, 0x4c, 0xa4, 0xb3, 0x8c, 0xb2, 0xca, 0xc7, 0xc5, 0xc4, 0xc1, 0xbc, 0xb6, 0xb4, 0xb3, 0xae,
+    0x30, 0x3e, 0x3e, 0x2b, 0x29, 0x2f, 0x21, 0x23, 0x1f, 0x29, 0x2d, 0x4d, 0x9e, 0xab, 0xa6, 0xb0,
+    0xba, 0xbd, 0xbf, 0xbd, 0xbb, 0xbb, 0xbc, 0xbd, 0xc1, 0xc4, 0xc7, 0xc9, 0xcc, 0xd3, 0xd7, 0xd1,
+    0xc9, 0xc7, 0xb3, 0xbd, 0xd0, 0xd5, 0xc1, 0xb6, 0xdd, 0xe4, 0xdc, 0xbd, 0x82, 0xa9, 0xcf, 0xb5,
+    0x87, 0x90, 0xdb, 0xda, 0xd5, 0xd2, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd0, 0xd1, 0xd4, 0xd6, 0xd6,
+    0xd7, 0xd7, 0xd7, 0xd5, 0xd1, 0xce, 0xd2, 0xed, 0xe9, 0xea, 0xd1, 0x92, 0x5b, 0x05, 0x03, 0x1b,
+    0x20, 0x49, 0xa2, 0xac, 0x8a, 0xb3, 0xcc, 0xc8, 0xc6, 0xc5, 0xc3, 0xbe, 0xb8, 0xb5, 0xb3, 0xb0,
+    0x3d, 0xa4, 0x9a, 0x43, 0x29, 0x30, 0x24, 0x24, 0x1f, 0x27, 0x2d, 0x2e, 0x63, 0xa4, 0xa7, 0xac,
+    0xbb, 0xc0, 0xc2, 0xc1, 0xbd, 0xbc, 0xbd, 0xc0, 0xc4, 0xc8, 0xcb, 0xc4, 0xa8, 0x8e, 0x77, 0x5c,
+    0x49, 0x43, 0x5b, 0xb1, 0xc6, 0xd2, 0xc9, 0xbe, 0xc9, 0xc5, 0xb4, 0x9f, 0x94, 0xb3, 0xc9, 0x9d,
+    0x83, 0xad, 0xd6, 0xd5, 0xd3, 0xd1, 0xd3, 0xd4, 0xd5, 0xd6, 0xd6, 0xd3, 0xd1, 0xd2, 0xd5, 0xd6,
+    0xd7, 0xd6, 0xd6, 0xd4, 0xd0, 0xcc, 0xd2, 0xed, 0xe9, 0xea, 0xd4, 0x92, 0x5a, 0x05, 0x02, 0x14,
+    0x1e, 0x46, 0xa0, 0xa7, 0x88, 0xb4, 0xcd, 0xc9, 0xc7, 0xc4, 0xc3, 0xbf, 0xbb, 0xb7, 0xb5, 0xb0,
+    0x84, 0xcb, 0xb0, 0x89, 0x32, 0x31, 0x26, 0x24, 0x21, 0x24, 0x2d, 0x2d, 0x31, 0x7d, 0xa6, 0xaa,
+    0xbe, 0xc2, 0xc4, 0xc4, 0xc1, 0xc0, 0xc1, 0xc5, 0xc8, 0xca, 0xa7, 0x85, 0x56, 0x21, 0x06, 0x00,
+    0x00, 0x01, 0x25, 0xa5, 0xb9, 0xcc, 0xcf, 0xc8, 0xc6, 0xbd, 0xb3, 0xa4, 0xa7, 0xb7, 0xab, 0x8f,
+    0x87, 0xd1, 0xd3, 0xd2, 0xd3, 0xd3, 0xd3, 0xd5, 0xd6, 0xd7, 0xd4, 0xd2, 0xd1, 0xd1, 0xd3, 0xd5,
+    0xd6, 0xd4, 0xd1, 0xcf, 0xcd, 0xcb, 0xd2, 0xed, 0xe8, 0xea, 0xd5, 0x93, 0x59, 0x06, 0x01, 0x0d,
+    0x1d, 0x44, 0x9c, 0xa3, 0x87, 0xb4, 0xce, 0xcb, 0xc8, 0xc6, 0xc2, 0xbf, 0xbd, 0xbc, 0xb6, 0xb0,
+    0xc8, 0xce, 0xb3, 0xa5, 0x5f, 0x30, 0x28, 0x25, 0x22, 0x23, 0x2d, 0x2d, 0x2e, 0x44, 0x97, 0xa4,
+    0xbf, 0xc3, 0xc5, 0xc5, 0xc4, 0xc2, 0xc4, 0xc8, 0xcb, 0xa7, 0x79, 0x2d, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x23, 0xb7, 0xa6, 0xbe, 0xcf, 0xd0, 0xd6, 0xc8, 0xbf, 0xb8, 0xb0, 0xa1, 0x92, 0x7b,
+    0xb4, 0xd2, 0xd2, 0xd5, 0xd5, 0xd2, 0xd3, 0xd6, 0xd8, 0xd6, 0xd4, 0xd2, 0xd0, 0xd0, 0xd3, 0xd4,
+    0xd4, 0xd1, 0xd0, 0xce, 0xcb, 0xcb, 0xd2, 0xec, 0xe8, 0xea, 0xd6, 0x93, 0x5d, 0x08, 0x07, 0x0b,
+    0x1b, 0x42, 0x9b, 0xa0, 0x86, 0xb5, 0xd0, 0xce, 0xc9, 0xc7, 0xc4, 0xc3, 0xc2, 0xbf, 0xb8, 0xb0,
+    0xd7, 0xd0, 0xb4, 0xa8, 0x93, 0x42, 0x2a, 0x26, 0x23, 0x21, 0x2c, 0x2d, 0x2e, 0x2e, 0x61, 0x96,
+    0xbb, 0xc3, 0xc5, 0xc6, 0xc6, 0xc9, 0xcb, 0xcb, 0xbe, 0x7c, 0x18, 0x00, 0x00, 0x02, 0x06, 0x08,
+    0x0c, 0x0b, 0x28, 0xb9, 0xbe, 0xa4, 0xc3, 0xd4, 0xdc, 0xd0, 0xc8, 0xbc, 0x9b, 0x84, 0x79, 0x75,
+    0xcc, 0xd7, 0xd5, 0xd6, 0xd6, 0xd3, 0xd2, 0xd5, 0xd7, 0xd6, 0xd5, 0xd0, 0xce, 0xcd, 0xd0, 0xd3,
+    0xd3, 0xd0, 0xcc, 0xca, 0xca, 0xca, 0xd0, 0xeb, 0xe8, 0xea, 0xd6, 0x93, 0x5e, 0x0a, 0x17, 0x18,
+    0x16, 0x3e, 0x97, 0x9d, 0x85, 0xb6, 0xd2, 0xcf, 0xcb, 0xc6, 0xc1, 0xc3, 0xc3, 0xbe, 0xb8, 0xb4,
+    0xd9, 0xd1, 0xb5, 0xa8, 0x9d, 0x82, 0x31, 0x27, 0x25, 0x20, 0x2b, 0x2d, 0x2e, 0x30, 0x33, 0x79,
+    0xb6, 0xc4, 0xc6, 0xc8, 0xca, 0xcd, 0xce, 0xca, 0x8d, 0x3f, 0x00, 0x01, 0x03, 0x2d, 0x44, 0x0d,
+    0x07, 0x05, 0x23, 0xb8, 0xd4, 0xbf, 0x9a, 0xae, 0xc1, 0xc2, 0xb9, 0x9a, 0x6f, 0x68, 0x73, 0x7b,
+    0xcd, 0xdd, 0xdc, 0xda, 0xd7, 0xd4, 0xd3, 0xd4, 0xd6, 0xd6, 0xd5, 0xd0, 0xcd, 0xcd, 0xcf, 0xd4,
+    0xd2, 0xcd, 0xca, 0xc8, 0xc9, 0xca, 0xce, 0xea, 0xe8, 0xea, 0xd6, 0x95, 0x55, 0x0a, 0x15, 0x34,
+    0x10, 0x3b, 0x95, 0x9a, 0x82, 0xb4, 0xd2, 0xce, 0xc8, 0xc2, 0xbc, 0xbb, 0xbd, 0xbb, 0xb9, 0xb6,
+    0xd9, 0xd2, 0xb5, 0xa6, 0x9d, 0xa2, 0x63, 0x28, 0x26, 0x1f, 0x2b, 0x2e, 0x2e, 0x32, 0x2d, 0x48,
+    0xae, 0xc3, 0xc7, 0xcb, 0xce, 0xd0, 0xca, 0xa0, 0x7c, 0x1b, 0x07, 0x0a, 0x27, 0x6d, 0x24, 0x05,
+    0x02, 0x00, 0x10, 0xa7, 0xd5, 0xd4, 0xbb, 0x8d, 0x72, 0x65, 0x61, 0x5d, 0x6c, 0x75, 0x7a, 0x5e,
+    0x76, 0xba, 0xde, 0xdd, 0xd9, 0xd7, 0xd5, 0xd5, 0xd4, 0xd5, 0xd3, 0xd0, 0xcf, 0xd0, 0xd0, 0xd1,
+    0xce, 0xcb, 0xcb, 0xcc, 0xcb, 0xcd, 0xd1, 0xea, 0xe8, 0xe9, 0xd7, 0x99, 0x6c, 0x6b, 0x71, 0x8c,
+    0x18, 0x34, 0x92, 0x98, 0x82, 0xb4, 0xd0, 0xc9, 0xc1, 0xbd, 0xb8, 0xb6, 0xb7, 0xbb, 0xba, 0xb2,
+    0xd7, 0xd2, 0xb5, 0x9f, 0xa0, 0xa7, 0x9a, 0x41, 0x27, 0x1f, 0x2a, 0x2e, 0x2f, 0x35, 0x2e, 0x2d,
+    0x9b, 0xc4, 0xc9, 0xcc, 0xce, 0xcc, 0x9b, 0x92, 0x78, 0x0c, 0x1b, 0x37, 0x92, 0x34, 0x11, 0x01,
+    0x00, 0x03, 0x0c, 0x20, 0x76, 0xa4, 0xb2, 0xba, 0xb7, 0xa1, 0x82, 0x86, 0x82, 0x7e, 0x77, 0x28,
+    0x09, 0x54, 0xa1, 0xd7, 0xda, 0xd8, 0xd6, 0xd4, 0xd4, 0xd6, 0xd7, 0xd5, 0xd4, 0xd5, 0xd2, 0xd0,
+    0xcd, 0xc8, 0xc8, 0xcc, 0xcd, 0xcd, 0xcc, 0xe9, 0xe8, 0xe9, 0xd7, 0x9d, 0x7f, 0xaf, 0xb3, 0xc5,
+    0x67, 0x2e, 0x8c, 0x95, 0x80, 0xb1, 0xcb, 0xc1, 0xba, 0xb7, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xad,
+    0xd2, 0xd1, 0xb4, 0x9c, 0xa0, 0xa7, 0xa2, 0x7a, 0x2a, 0x20, 0x2a, 0x2e, 0x2e, 0x37, 0x30, 0x29,
+    0x7c, 0xc4, 0xc8, 0xcc, 0xcf, 0xa3, 0x90, 0x8e, 0x77, 0x3a, 0x3c, 0xb0, 0x7c, 0x1e, 0x05, 0x01,
+    0x05, 0x0a, 0x0b, 0x09, 0x12, 0x14, 0x16, 0x16, 0x20, 0x38, 0x50, 0x68, 0x5b, 0x38, 0x11, 0x01,
+    0x00, 0x01, 0x42, 0x86, 0xd2, 0xd9, 0xd6, 0xd6, 0xd8, 0xda, 0xdc, 0xdd, 0xdd, 0xdd, 0xd8, 0xd2,
+    0xcd, 0xc8, 0xc6, 0xc8, 0xc9, 0xc7, 0xe2, 0xeb, 0xe8, 0xe7, 0xd6, 0x9f, 0x7e, 0xaa, 0xb2, 0xd7,
+    0xb0, 0x66, 0x76, 0x91, 0x7d, 0xad, 0xc9, 0xc0, 0xb8, 0xb0, 0xab, 0xaf, 0xaf, 0xad, 0xac, 0xa6,
+    0xd0, 0xd1, 0xb6, 0x9a, 0x9f, 0xa7, 0xa1, 0x9a, 0x4e, 0x23, 0x29, 0x2d, 0x2e, 0x37, 0x32, 0x2b,
+    0x5d, 0xbf, 0xc7, 0xce, 0xd2, 0xa6, 0x76, 0x78, 0x73, 0x58, 0x8c, 0xbb, 0x68, 0x0d, 0x0e, 0x10,
+    0x0d, 0x0c, 0x06, 0x03, 0x0c, 0x0f, 0x0f, 0x11, 0x10, 0x0d, 0x09, 0x04, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x05, 0x3e, 0x89, 0xdc, 0xdc, 0xd9, 0xda, 0xde, 0xdf, 0xe0, 0xe0, 0xdf, 0xd9, 0xd4,
+    0xcf, 0xca, 0xc8, 0xc6, 0xc5, 0xdb, 0xf0, 0xeb, 0xe8, 0xe7, 0xd8, 0xa1, 0x81, 0xa9, 0xaf, 0xdc,
+    0xdb, 0xab, 0x71, 0x81, 0x7c, 0xab, 0xca, 0xc1, 0xb8, 0xb1, 0xab, 0xa9, 0xa9, 0xa8, 0xa5, 0xa0,
+    0xd0, 0xd0, 0xb9, 0x9b, 0x9e, 0xa6, 0xa2, 0x9f, 0x8a, 0x32, 0x29, 0x2d, 0x2e, 0x35, 0x33, 0x2c,
+    0x39, 0xad, 0xcb, 0xd2, 0xd7, 0x87, 0x8d, 0x36, 0x80, 0x70, 0xb2, 0xc2, 0x4f, 0x50, 0x17, 0x0d,
+    0x07, 0x08, 0x09, 0x00, 0x08, 0x0b, 0x0c, 0x0b, 0x0b, 0x07, 0x05, 0x05, 0x03, 0x03, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x02, 0x4d, 0x90, 0xdd, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xe0, 0xdc, 0xd7, 0xd3,
+    0xd0, 0xcd, 0xcc, 0xc8, 0xd9, 0xef, 0xee, 0xeb, 0xe9, 0xe7, 0xd9, 0xa3, 0x82, 0xa4, 0xab, 0xd6,
+    0xe0, 0xd9, 0xa4, 0x6c, 0x6c, 0xa7, 0xc9, 0xc0, 0xb9, 0xb3, 0xae, 0xa8, 0xa5, 0xa2, 0x9e, 0x9b,
+    0xd2, 0xcf, 0xbe, 0x9b, 0x9d, 0xa6, 0xa5, 0xa2, 0x9e, 0x62, 0x29, 0x2a, 0x2e, 0x33, 0x35, 0x2e,
+    0x2d, 0x82, 0xcc, 0xd4, 0xcc, 0x4b, 0x66, 0x2a, 0x6a, 0x72, 0x99, 0xaa, 0x80, 0x50, 0x2b, 0x07,
+    0x04, 0x0b, 0x0b, 0x00, 0x04, 0x09, 0x0a, 0x0a, 0x0a, 0x06, 0x03, 0x03, 0x05, 0x03, 0x01, 0x00,
+    0x00, 0x0a, 0x09, 0x00, 0x0f, 0x6a, 0x97, 0xe1, 0xdf, 0xde, 0xdd, 0xdf, 0xde, 0xda, 0xd5, 0xd3,
+    0xd2, 0xd0, 0xce, 0xd2, 0xee, 0xee, 0xeb, 0xea, 0xe8, 0xe6, 0xda, 0xa3, 0x7c, 0x9d, 0xa8, 0xcb,
+    0xde, 0xdd, 0xd4, 0x99, 0x5d, 0x9d, 0xc5, 0xbd, 0xb8, 0xb6, 0xb0, 0xa6, 0xa1, 0x9f, 0x9d, 0x9a,
+    0xcc, 0xcb, 0xc2, 0x9e, 0x9b, 0xa6, 0xa6, 0xa7, 0xa4, 0x88, 0x37, 0x2a, 0x2e, 0x31, 0x36, 0x2f,
+    0x2e, 0x5c, 0xcb, 0xd4, 0xa0, 0x44, 0x35, 0x3b, 0x31, 0x78, 0x85, 0xa0, 0xb7, 0xbc, 0x3f, 0x1e,
+    0x0d, 0x10, 0x07, 0x00, 0x03, 0x08, 0x09, 0x0a, 0x0a, 0x07, 0x05, 0x03, 0x04, 0x03, 0x01, 0x00,
+    0x00, 0x02, 0x18, 0x0a, 0x04, 0x31, 0x73, 0xbf, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9, 0xd8, 0xd6,
+    0xd5, 0xd3, 0xcc, 0xe5, 0xeb, 0xcb, 0xd0, 0xe5, 0xe8, 0xe3, 0xd8, 0xa3, 0x7d, 0x98, 0xa8, 0xb9,
+    0xd6, 0xd8, 0xd9, 0xcc, 0x8a, 0x97, 0xbf, 0xbc, 0xb7, 0xb5, 0xaf, 0xa9, 0xa3, 0x9f, 0x9d, 0x98,
+    0xb5, 0xc9, 0xc7, 0xa2, 0x99, 0xa6, 0xa7, 0xa9, 0xab, 0x8c, 0x67, 0x2c, 0x2e, 0x30, 0x36, 0x30,
+    0x30, 0x41, 0xb9, 0xb1, 0xa4, 0x64, 0x36, 0x49, 0x2f, 0x5d, 0x6e, 0x8f, 0xab, 0xbe, 0xb9, 0x4c,
+    0x39, 0x0f, 0x04, 0x00, 0x02, 0x09, 0x09, 0x09, 0x0a, 0x05, 0x04, 0x03, 0x04, 0x02, 0x00, 0x00,
+    0x00, 0x03, 0x1e, 0x27, 0x0c, 0x10, 0x5d, 0x81, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd7,
+    0xd6, 0xd5, 0xcb, 0xe7, 0xe9, 0xd2, 0xca, 0xe1, 0xd3, 0xdb, 0xd3, 0xa2, 0x81, 0x93, 0xa7, 0x92,
+    0xb5, 0xb8, 0xd6, 0xd5, 0xb4, 0x9d, 0xba, 0xb9, 0xb5, 0xb1, 0xad, 0xaa, 0xa8, 0xa2, 0x9e, 0x96,
+    0x66, 0xbe, 0xc9, 0xa8, 0x98, 0xa6, 0xa5, 0xa7, 0xad, 0x8a, 0x8d, 0x4c, 0x2d, 0x2f, 0x36, 0x31,
+    0x31, 0x42, 0xa0, 0xa7, 0xa6, 0x88, 0x4d, 0x73, 0x6d, 0x22, 0x6a, 0x6c, 0x94, 0x80, 0x72, 0x9b,
+    0x26, 0x0a, 0x01, 0x00, 0x01, 0x0b, 0x0c, 0x0b, 0x0b, 0x06, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0x11, 0x2c, 0x37, 0x12, 0x2c, 0x74, 0xb6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7,
+    0xd7, 0xd7, 0xad, 0x92, 0x96, 0x9a, 0xb4, 0xea, 0x9a, 0xc3, 0xde, 0xae, 0x82, 0x86, 0x96, 0x91,
+    0xc2, 0xc5, 0xc4, 0xc0, 0xb0, 0x90, 0xb6, 0xb4, 0xb0, 0xab, 0xa9, 0xa6, 0xa3, 0x9c, 0x97, 0x93,
+    0x34, 0x87, 0xc3, 0xb0, 0x99, 0xa6, 0xa5, 0xa6, 0xad, 0x8c, 0x8e, 0x86, 0x38, 0x2f, 0x35, 0x33,
+    0x4e, 0x99, 0xa8, 0xac, 0x9f, 0x8c, 0x68, 0x4b, 0x8f, 0x34, 0x32, 0x67, 0x68, 0x8e, 0x6a, 0xa6,
+    0x54, 0x16, 0x00, 0x00, 0x02, 0x0d, 0x0f, 0x0c, 0x09, 0x08, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x0c, 0x39, 0x32, 0x31, 0x21, 0x6a, 0x87, 0xd7, 0xd7, 0xd7, 0xd6, 0xd7, 0xd6, 0xd6,
+    0xd8, 0xd8, 0xcf, 0xd8, 0xd5, 0xc2, 0xc8, 0xcb, 0x91, 0xbb, 0xde, 0xb1, 0x7b, 0x71, 0x39, 0x37,
+    0x54, 0x70, 0x6c, 0x71, 0x6e, 0x7d, 0xb2, 0xaf, 0xad, 0xaa, 0xa7, 0xa3, 0x9c, 0x96, 0x92, 0x91,
+    0x2f, 0x44, 0x96, 0xae, 0x9c, 0xa5, 0xa4, 0xa7, 0xb0, 0x90, 0x8b, 0x99, 0x7d, 0x35, 0x3d, 0x73,
+    0xa4, 0xa7, 0xa7, 0xa5, 0xa4, 0x96, 0x7f, 0x54, 0x6c, 0x68, 0x53, 0x3f, 0x64, 0x65, 0x8a, 0x86,
+    0x40, 0x0b, 0x02, 0x02, 0x05, 0x0c, 0x0b, 0x0a, 0x07, 0x04, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00,
+    0x00, 0x23, 0x44, 0x45, 0x41, 0x58, 0x38, 0x66, 0x66, 0xd2, 0xd6, 0xd6, 0xd5, 0xd5, 0xd4, 0xd6,
+    0xd9, 0xd9, 0xd5, 0xd5, 0xd6, 0xd3, 0xda, 0x9a, 0x8f, 0xb0, 0xd8, 0xb0, 0x6e, 0x5d, 0x69, 0x90,
+    0x9d, 0xcf, 0xbd, 0xb6, 0xa2, 0x98, 0xaf, 0xad, 0xac, 0xac, 0xaa, 0xa0, 0x98, 0x94, 0x92, 0x90,
+    0x30, 0x37, 0x41, 0x93, 0x9b, 0xa0, 0xa3, 0xaa, 0xb1, 0x94, 0x84, 0x96, 0xa9, 0x6b, 0x96, 0x9f,
+    0x9f, 0xaa, 0xa5, 0xa2, 0x9c, 0x98, 0x86, 0x7b, 0x44, 0x57, 0x2a, 0x3e, 0x54, 0x76, 0x5a, 0x82,
+    0x98, 0x33, 0x10, 0x05, 0x0b, 0x0f, 0x0e, 0x0b, 0x07, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00,
+    0x04, 0x5b, 0x52, 0x41, 0x5c, 0x51, 0x72, 0x6e, 0x58, 0x93, 0xc7, 0xd6, 0xd5, 0xd4, 0xd4, 0xd8,
+    0xda, 0xd8, 0xd6, 0xd3, 0xd0, 0xce, 0xb8, 0x7e, 0x81, 0x80, 0xd1, 0xae, 0x63, 0x31, 0x2e, 0x59,
+    0xa1, 0xa7, 0x58, 0x54, 0x46, 0x7d, 0xad, 0xac, 0xab, 0xa9, 0xa5, 0x9b, 0x96, 0x92, 0x8f, 0x8b,
+    0x31, 0x35, 0x2f, 0x4f, 0x90, 0x9d, 0xa4, 0xac, 0xb2, 0x96, 0x80, 0x94, 0xaa, 0xa3, 0x9f, 0x9e,
+    0xa3, 0x97, 0xaa, 0x9e, 0x9c, 0x95, 0x91, 0x7c, 0x78, 0x4d, 0x4b, 0x20, 0x35, 0x4d, 0x7d, 0x4e,
+    0x75, 0x88, 0x27, 0x1d, 0x12, 0x13, 0x2b, 0x3b, 0x22, 0x01, 0x00, 0x02, 0x04, 0x04, 0x03, 0x00,
+    0x03, 0x26, 0x58, 0x4d, 0x66, 0x53, 0x98, 0x6d, 0x55, 0x7b, 0x8d, 0xa8, 0xd0, 0xd3, 0xd5, 0xda,
+    0xdb, 0xd9, 0xd5, 0xd2, 0xcd, 0xcb, 0x92, 0x76, 0x69, 0x6e, 0x67, 0x6c, 0x61, 0x00, 0x00, 0x1e,
+    0xa8, 0xa6, 0x76, 0x72, 0x63, 0x82, 0xac, 0xab, 0xa9, 0xa4, 0x9f, 0x9a, 0x95, 0x8e, 0x8c, 0x8c,
+    0x2e, 0x35, 0x30, 0x32, 0x5c, 0x99, 0xa4, 0xaa, 0xb2, 0x96, 0x80, 0x91, 0xa4, 0xa6, 0xa3, 0xa1,
+    0xa2, 0x93, 0x9c, 0xa5, 0x9c, 0x8c, 0x95, 0x8d, 0x71, 0x61, 0x5e, 0x28, 0x1b, 0x29, 0x38, 0x60,
+    0x4d, 0x4d, 0x62, 0x67, 0x45, 0x84, 0x68, 0x37, 0x1a, 0x03, 0x0b, 0x29, 0x2c, 0x23, 0x23, 0x03,
+    0x0c, 0x6b, 0x6a, 0x67, 0x72, 0x4b, 0x9c, 0x67, 0x4e, 0x72, 0x89, 0x89, 0x9f, 0xce, 0xd6, 0xda,
+    0xda, 0xd8, 0xd6, 0xd3, 0xce, 0xbd, 0x78, 0x53, 0x64, 0x3e, 0x03, 0x1c, 0x49, 0x01, 0x00, 0x1b,
+    0xa5, 0xa7, 0x74, 0x71, 0x63, 0x7f, 0xaa, 0xa6, 0xa3, 0xa0, 0x9c, 0x99, 0x97, 0x91, 0x8b, 0x87,
+    0x2e, 0x34, 0x31, 0x35, 0x2f, 0x77, 0xa0, 0xa4, 0xab, 0x96, 0x81, 0x8d, 0xa3, 0xa4, 0xa4, 0xaa,
+    0xa5, 0x9d, 0x8a, 0x9e, 0xa1, 0x91, 0x90, 0x87, 0x68, 0x57, 0x6f, 0x33, 0x4b, 0x1b, 0x17, 0x2a,
+    0x3f, 0x4d, 0x30, 0x5e, 0xbd, 0xd8, 0xcb, 0xa5, 0x62, 0x5d, 0x6d, 0x54, 0x34, 0x32, 0x3b, 0x0b,
+    0x09, 0x56, 0x61, 0x76, 0x6c, 0x45, 0x77, 0x58, 0x3f, 0x73, 0x8a, 0x87, 0x96, 0xa2, 0xc9, 0xd9,
+    0xda, 0xd8, 0xd5, 0xd2, 0xcc, 0x95, 0x63, 0x51, 0x9a, 0x6c, 0x31, 0x36, 0x04, 0x44, 0x02, 0x18,
+    0xa1, 0x99, 0x72, 0x77, 0x64, 0x71, 0xa4, 0xa4, 0xa2, 0x9d, 0x9b, 0x97, 0x95, 0x92, 0x8e, 0x89,
+    0x2e, 0x31, 0x32, 0x36, 0x2c, 0x3d, 0x91, 0xa3, 0xa5, 0x96, 0x87, 0x87, 0x9a, 0x8c, 0x85, 0x95,
+    0xa6, 0x9d, 0x8f, 0x8d, 0xa2, 0x9f, 0x82, 0x8f, 0x82, 0x76, 0x72, 0x6c, 0x3e, 0x46, 0x11, 0x17,
+    0x17, 0x22, 0x29, 0x35, 0x33, 0x69, 0xa3, 0x94, 0x7f, 0x97, 0xc9, 0xc5, 0x92, 0x9d, 0x89, 0x55,
+    0x20, 0x53, 0x69, 0x7d, 0x33, 0x53, 0x58, 0x3f, 0x48, 0x7e, 0x82, 0x89, 0x96, 0x9b, 0x9c, 0xc5,
+    0xd6, 0xd3, 0xd1, 0xcf, 0xc0, 0x74, 0x4f, 0x86, 0xc4, 0xba, 0x82, 0x62, 0x2e, 0x78, 0x04, 0x16,
+    0x9d, 0x7c, 0x6c, 0x6d, 0x5d, 0x52, 0x97, 0xa5, 0xa2, 0x9e, 0x99, 0x96, 0x92, 0x8f, 0x8d, 0x88,
+    0x2e, 0x2f, 0x35, 0x34, 0x2b, 0x24, 0x5f, 0xa1, 0xa2, 0x9b, 0x8c, 0x8b, 0x8f, 0x8b, 0x85, 0x7e,
+    0x92, 0xa5, 0x95, 0x85, 0x8c, 0x9c, 0x89, 0x93, 0x8f, 0x8c, 0x6f, 0x6d, 0x7c, 0x45, 0x31, 0x21,
+    0x0c, 0x0d, 0x05, 0x14, 0x30, 0x33, 0x30, 0x37, 0x54, 0x74, 0x92, 0x8c, 0x88, 0xa7, 0xa9, 0x94,
+    0x6a, 0x65, 0x60, 0x40, 0x3b, 0x4f, 0x3a, 0x20, 0x36, 0x67, 0x7f, 0x8c, 0x95, 0x98, 0x8b, 0x83,
+    0xc9, 0xd0, 0xd0, 0xcd, 0xad, 0x5c, 0x73, 0xc0, 0xc5, 0x9c, 0x52, 0x28, 0x88, 0x8e, 0x07, 0x13,
+    0x9e, 0x9f, 0x71, 0x51, 0x45, 0x60, 0x92, 0xa1, 0xa0, 0x9e, 0x9b, 0x96, 0x8f, 0x8b, 0x89, 0x86,
+    0x2f, 0x30, 0x38, 0x34, 0x2b, 0x20, 0x2e, 0x81, 0xa0, 0x9d, 0x9b, 0x9d, 0xa0, 0x9d, 0x9a, 0x94,
+    0x92, 0xa1, 0x9d, 0x8f, 0x80, 0x8f, 0x93, 0x90, 0x95, 0x91, 0x89, 0x6a, 0x73, 0x8c, 0x6c, 0x31,
+    0x2b, 0x13, 0x04, 0x07, 0x0f, 0x1f, 0x2c, 0x32, 0x37, 0x3c, 0x2b, 0x3c, 0x4c, 0x56, 0x60, 0x5d,
+    0x52, 0x49, 0x46, 0x49, 0x44, 0x2b, 0x0f, 0x20, 0x2a, 0x68, 0x78, 0x88, 0x95, 0x91, 0x7c, 0x6f,
+    0xa2, 0xcf, 0xce, 0xcb, 0xa9, 0x56, 0xb0, 0xb9, 0xac, 0x77, 0x58, 0x3c, 0x7b, 0x7a, 0x0c, 0x09,
+    0x76, 0x8c, 0x62, 0x25, 0x03, 0x68, 0x95, 0x91, 0x8f, 0x8f, 0x90, 0x8c, 0x87, 0x84, 0x82, 0x80,
+    0x31, 0x31, 0x3b, 0x32, 0x2b, 0x1e, 0x29, 0x46, 0x95, 0x8d, 0x90, 0x95, 0x95, 0x92, 0x93, 0x8e,
+    0x8f, 0x91, 0x97, 0x8e, 0x8c, 0x81, 0x90, 0x96, 0x8b, 0x94, 0x8e, 0x74, 0x74, 0x7d, 0x84, 0x77,
+    0x2c, 0x23, 0x2b, 0x13, 0x05, 0x06, 0x0a, 0x11, 0x18, 0x18, 0x37, 0x4d, 0x55, 0x4b, 0x4f, 0x4b,
+    0x48, 0x44, 0x3d, 0x37, 0x22, 0x08, 0x19, 0x23, 0x39, 0x69, 0x77, 0x7b, 0x91, 0x8a, 0x7e, 0x68,
+    0x92, 0xce, 0xcd, 0xca, 0xbc, 0x8d, 0x8a, 0x82, 0x7c, 0x5c, 0x4e, 0x56, 0x6c, 0x59, 0x11, 0x04,
+    0x48, 0x72, 0x75, 0x57, 0x3b, 0x54, 0x76, 0x6f, 0x44, 0x24, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
+    0x31, 0x33, 0x3b, 0x30, 0x2b, 0x1e, 0x2b, 0x2e, 0x6d, 0x8b, 0x8f, 0x8b, 0x8d, 0x94, 0x98, 0x96,
+    0x88, 0x87, 0x9c, 0x99, 0x86, 0x88, 0x8b, 0x8e, 0x81, 0x8f, 0x90, 0x85, 0x72, 0x87, 0x7a, 0x72,
+    0x6a, 0x35, 0x16, 0x1f, 0x23, 0x25, 0x15, 0x07, 0x07, 0x0a, 0x14, 0x2c, 0x2b, 0x23, 0x29, 0x36,
+    0x2a, 0x18, 0x11, 0x08, 0x06, 0x12, 0x1e, 0x2e, 0x5a, 0x5e, 0x79, 0x83, 0x89, 0x86, 0x75, 0x6d,
+    0x96, 0xc4, 0xcc, 0xc9, 0xb4, 0x5b, 0x44, 0x4e, 0x55, 0x37, 0x1f, 0x12, 0x4f, 0x55, 0x10, 0x0a,
+    0x5e, 0x68, 0x66, 0x63, 0x5f, 0x57, 0x48, 0x34, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x36, 0x3b, 0x2f, 0x2a, 0x1e, 0x2b, 0x30, 0x81, 0x8e, 0x82, 0x7f, 0x7f, 0x87, 0x94, 0x98,
+    0x94, 0x90, 0xa0, 0x98, 0x7f, 0x89, 0x88, 0x8a, 0x7e, 0x90, 0x8d, 0x89, 0x80, 0x7f, 0x55, 0x53,
+    0x62, 0x68, 0x45, 0x20, 0x14, 0x13, 0x21, 0x34, 0x35, 0x26, 0x23, 0x1e, 0x0e, 0x10, 0x20, 0x20,
+    0x0b, 0x05, 0x0a, 0x0b, 0x14, 0x38, 0x4b, 0x5a, 0x52, 0x6d, 0x7d, 0x87, 0x87, 0x85, 0x68, 0x75,
+    0x93, 0xaf, 0xc4, 0xc4, 0xb1, 0x5c, 0x21, 0x1e, 0x2f, 0x45, 0x32, 0x16, 0x11, 0x0f, 0x02, 0x01,
+    0x0e, 0x0e, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x3b, 0x39, 0x2f, 0x2b, 0x1e, 0x2a, 0x41, 0x84, 0x7f, 0x7b, 0x7c, 0x7d, 0x7e, 0x87, 0x8e,
+    0x93, 0x9f, 0xa2, 0x9b, 0x7e, 0x7d, 0x86, 0x8b, 0x80, 0x8a, 0x8e, 0x89, 0x83, 0x88, 0x8a, 0x83,
+    0x86, 0x7c, 0x65, 0x56, 0x42, 0x16, 0x14, 0x12, 0x11, 0x1a, 0x23, 0x2d, 0x37, 0x3a, 0x38, 0x2d,
+    0x18, 0x0f, 0x09, 0x12, 0x59, 0x5e, 0x52, 0x53, 0x63, 0x77, 0x87, 0x87, 0x88, 0x8a, 0x5d, 0x74,
+    0x92, 0x95, 0xb9, 0xc1, 0xbe, 0x91, 0x0c, 0x09, 0x1b, 0x31, 0x2a, 0x1e, 0x0e, 0x07, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0x3e, 0x36, 0x30, 0x2a, 0x1f, 0x2b, 0x56, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7d, 0x81, 0x82,
+    0x8b, 0x98, 0x9f, 0x9f, 0x7e, 0x7b, 0x85, 0x8a, 0x86, 0x82, 0x8d, 0x8a, 0x7d, 0x83, 0x8c, 0x90,
+    0x94, 0x8d, 0x85, 0x6f, 0x78, 0x6a, 0x43, 0x38, 0x29, 0x24, 0x19, 0x29, 0x28, 0x19, 0x2c, 0x1d,
+    0x23, 0x1d, 0x37, 0x5e, 0x4d, 0x51, 0x5e, 0x6c, 0x75, 0x80, 0x8e, 0x84, 0x8a, 0x8f, 0x5e, 0x75,
+    0x94, 0x85, 0xad, 0xc0, 0xbb, 0x4a, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6c, 0x3e, 0x34, 0x31, 0x2b, 0x1f, 0x2c, 0x57, 0x87, 0x91, 0x90, 0x93, 0x92, 0x80, 0x88, 0x8e,
+    0x8e, 0x93, 0x97, 0x9f, 0x8f, 0x75, 0x86, 0x85, 0x8c, 0x7a, 0x8f, 0x8e, 0x82, 0x7e, 0x80, 0x8a,
+    0x85, 0x84, 0x82, 0x7b, 0x75, 0x77, 0x72, 0x6b, 0x71, 0x80, 0x5c, 0x95, 0xac, 0x73, 0x84, 0x4d,
+    0x35, 0x55, 0x54, 0x58, 0x66, 0x6d, 0x78, 0x62, 0x86, 0x74, 0x91, 0x82, 0x8a, 0x91, 0x67, 0x6a,
+    0x89, 0x91, 0x96, 0xbe, 0xad, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb6, 0x50, 0x32, 0x32, 0x2b, 0x20, 0x2c, 0x80, 0xa2, 0xa5, 0x74, 0x95, 0x93, 0x8d, 0x85, 0x9c,
+    0xa1, 0xa1, 0x9b, 0x9c, 0x9b, 0x89, 0x81, 0x7e, 0x8e, 0x79, 0x8f, 0x91, 0x88, 0x85, 0x7f, 0x72,
+    0x86, 0x8a, 0x87, 0x78, 0x6c, 0x76, 0x76, 0x63, 0x7d, 0x85, 0x7e, 0x95, 0xcb, 0x71, 0x78, 0x53,
+    0x68, 0x60, 0x6a, 0x7e, 0x72, 0x7a, 0x72, 0x61, 0x85, 0x74, 0x90, 0x7a, 0x87, 0x92, 0x73, 0x62,
+    0x85, 0x99, 0x7b, 0xb9, 0x94, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0x97, 0x37, 0x34, 0x2d, 0x21, 0x47, 0x9c, 0x9a, 0x94, 0x5d, 0x89, 0x95, 0x9f, 0x8f, 0x8e,
+    0x96, 0xa0, 0xa1, 0xa0, 0x9e, 0x94, 0x77, 0x7e, 0x8f, 0x79, 0x8b, 0x94, 0x91, 0x80, 0x8c, 0x82,
+    0x6e, 0x7e, 0x8c, 0x8a, 0x73, 0x79, 0x71, 0x63, 0x71, 0x7d, 0x82, 0x6e, 0x62, 0x6a, 0x5e, 0x44,
+    0x6a, 0x7d, 0x7d, 0x7d, 0x75, 0x75, 0x5e, 0x66, 0x6f, 0x7e, 0x8d, 0x77, 0x87, 0x93, 0x7a, 0x56,
+    0x84, 0x97, 0x7f, 0xb5, 0x85, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd4, 0xc5, 0x6c, 0x32, 0x2d, 0x22, 0x64, 0x8b, 0x92, 0x72, 0x65, 0x7f, 0x7c, 0x8a, 0x7c, 0x73,
+    0x75, 0x8a, 0x97, 0x99, 0x9d, 0x97, 0x79, 0x6b, 0x90, 0x7b, 0x88, 0x95, 0x96, 0x8a, 0x84, 0x8f,
+    0x89, 0x71, 0x7a, 0x8a, 0x8a, 0x7c, 0x6f, 0x5b, 0x6d, 0x73, 0x71, 0x6a, 0x50, 0x68, 0x54, 0x64,
+    0x85, 0x89, 0x8d, 0x88, 0x6d, 0x51, 0x41, 0x7e, 0x67, 0x83, 0x88, 0x74, 0x86, 0x94, 0x78, 0x4e,
+    0x68, 0x80, 0x89, 0xb4, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd3, 0xcd, 0xa6, 0x4d, 0x2d, 0x24, 0x78, 0x99, 0x8c, 0x62, 0x7f, 0x7e, 0x7e, 0x78, 0x72, 0x76,
+    0x72, 0x7b, 0x8d, 0x95, 0x97, 0x9a, 0x84, 0x4a, 0x91, 0x7c, 0x86, 0x95, 0x97, 0x91, 0x86, 0x8c,
+    0x8e, 0x8c, 0x76, 0x7c, 0x8a, 0x89, 0x76, 0x5c, 0x71, 0x72, 0x6b, 0x5d, 0x60, 0x76, 0x54, 0x6b,
+    0x86, 0x8a, 0x8e, 0x8e, 0x5a, 0x4a, 0x77, 0x71, 0x6f, 0x85, 0x81, 0x73, 0x86, 0x95, 0x73, 0x52,
+    0x6c, 0x7b, 0x86, 0xa9, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd3, 0xcc, 0xb9, 0x9a, 0x37, 0x3e, 0x98, 0x97, 0x77, 0x74, 0x86, 0x7c, 0x80, 0x7b, 0x80, 0x81,
+    0x79, 0x6e, 0x7a, 0x8e, 0x92, 0x97, 0x85, 0x3a, 0x91, 0x7e, 0x87, 0x93, 0x97, 0x95, 0x8e, 0x8c,
+    0x8c, 0x8a, 0x8b, 0x79, 0x77, 0x89, 0x84, 0x63, 0x6c, 0x73, 0x70, 0x79, 0x60, 0x5a, 0x76, 0x6c,
+    0x68, 0x80, 0x88, 0x8d, 0x55, 0x6a, 0x80, 0x66, 0x77, 0x7c, 0x7e, 0x76, 0x85, 0x96, 0x72, 0x51,
+    0x56, 0x73, 0x84, 0x8f, 0x8a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd2, 0xca, 0xbd, 0xba, 0x69, 0x55, 0x76, 0x76, 0x6f, 0x8b, 0x7f, 0x89, 0x98, 0x99, 0x97, 0x94,
+    0x8f, 0x7f, 0x6e, 0x7d, 0x8b, 0x91, 0x8a, 0x3a, 0x8e, 0x7e, 0x89, 0x92, 0x96, 0x97, 0x93, 0x90,
+    0x8c, 0x88, 0x87, 0x8e, 0x82, 0x7d, 0x8a, 0x7d, 0x75, 0x7f, 0x7d, 0x85, 0x3e, 0x50, 0x70, 0x96,
+    0x5b, 0x56, 0x85, 0x88, 0x51, 0x85, 0x6b, 0x6b, 0x77, 0x7a, 0x7d, 0x78, 0x84, 0x96, 0x71, 0x56,
+    0x4f, 0x6b, 0x84, 0x77, 0x72, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd2, 0xc9, 0xbf, 0xbf, 0x92, 0x90, 0x89, 0x6a, 0x87, 0x9e, 0x79, 0x94, 0x99, 0x98, 0x95, 0x93,
+    0x8f, 0x8f, 0x83, 0x71, 0x7f, 0x86, 0x63, 0x3f, 0x8a, 0x80, 0x8d, 0x94, 0x96, 0x95, 0x94, 0x92,
+    0x92, 0x8e, 0x8b, 0x8a, 0x89, 0x81, 0x8a, 0x88, 0x7b, 0x7e, 0x7f, 0x6f, 0x49, 0x6c, 0x68, 0xc8,
+    0xe2, 0x89, 0x68, 0x66, 0x8e, 0x87, 0x65, 0x73, 0x7e, 0x7e, 0x7e, 0x7c, 0x83, 0x97, 0x6e, 0x56,
+    0x47, 0x60, 0x89, 0x8b, 0x52, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd3, 0xc8, 0xc1, 0xbf, 0xa2, 0xa9, 0xa0, 0x90, 0x9d, 0x93, 0x87, 0x95, 0x95, 0x97, 0x97, 0x96,
+    0x8e, 0x8a, 0x8a, 0x80, 0x72, 0x7a, 0x5c, 0x41, 0x88, 0x84, 0x92, 0x95, 0x94, 0x91, 0x8d, 0x8d,
+    0x8b, 0x8c, 0x8d, 0x8b, 0x86, 0x87, 0x81, 0x8b, 0x82, 0x78, 0x7a, 0x58, 0x5e, 0xa4, 0x6d, 0xba,
+    0xf7, 0xe2, 0x3e, 0x51, 0x91, 0x6f, 0x88, 0x8e, 0xb0, 0x9c, 0x9d, 0xa4, 0xa5, 0x9b, 0x69, 0x49,
+    0x3b, 0x62, 0x8f, 0x76, 0x2f, 0x02, 0x11, 0x3f, 0x5f, 0x7e, 0x93, 0x87, 0x79, 0x67, 0x4b, 0x10,
+    0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd4, 0xc7, 0xc4, 0xbc, 0xa4, 0xa7, 0xa0, 0xaa, 0xa9, 0x91, 0x8c, 0x9b, 0x97, 0x95, 0x93, 0x93,
+    0x8e, 0x89, 0x81, 0x83, 0x76, 0x72, 0x5e, 0x4a, 0x8d, 0x89, 0x93, 0x8e, 0x88, 0x77, 0x67, 0x5c,
+    0x5a, 0x60, 0x76, 0x84, 0x86, 0x8b, 0x82, 0x89, 0x85, 0x79, 0x69, 0x57, 0x6c, 0xbd, 0x9d, 0xc3,
+    0xf6, 0xf8, 0x6a, 0x5a, 0x64, 0x32, 0x41, 0x57, 0xa7, 0x82, 0x44, 0x43, 0x53, 0x9e, 0x65, 0x3e,
+    0x33, 0x6b, 0x8e, 0x67, 0x7e, 0xb4, 0xf2, 0xfd, 0xfd, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfb, 0xef,
+    0xad, 0x57, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd4, 0xc7, 0xc4, 0xba, 0xa4, 0xaa, 0x98, 0xa1, 0xa9, 0x8d, 0x85, 0x91, 0x9b, 0x9b, 0x98, 0x92,
+    0x8c, 0x87, 0x83, 0x7b, 0x81, 0x70, 0x60, 0x5d, 0x8d, 0x8b, 0x89, 0x7c, 0x5d, 0x5f, 0x91, 0x80,
+    0x8e, 0x93, 0x62, 0x5c, 0x7b, 0x89, 0x8a, 0x85, 0x88, 0x79, 0x57, 0x5c, 0x72, 0xc2, 0xd8, 0xdf,
+    0xf3, 0xf8, 0x9e, 0x60, 0x87, 0x45, 0xa9, 0xad, 0xb5, 0xa4, 0x5f, 0x47, 0x4b, 0x87, 0x58, 0x33,
+    0x33, 0x53, 0x65, 0x69, 0x62, 0x60, 0x63, 0x76, 0x8f, 0xb7, 0xd7, 0xf4, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfd, 0xfa, 0xd1, 0x53, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd3, 0xc7, 0xc4, 0xb7, 0xa3, 0xb7, 0xa5, 0xb8, 0xb1, 0x92, 0x88, 0x81, 0x80, 0x93, 0x8f, 0x83,
+    0x82, 0x81, 0x82, 0x80, 0x7a, 0x76, 0x67, 0x52, 0x87, 0x83, 0x73, 0x5d, 0x8a, 0x70, 0x4e, 0x43,
+    0x46, 0x4f, 0x89, 0x7d, 0x65, 0x75, 0x89, 0x86, 0x89, 0x78, 0x51, 0x5f, 0x75, 0xc5, 0xdd, 0xd2,
+    0xe9, 0xf8, 0xca, 0x5e, 0x89, 0x3d, 0x67, 0xb2, 0xa6, 0xaa, 0xcd, 0xdb, 0x61, 0x7a, 0x49, 0x2f,
+    0x21, 0x25, 0x25, 0x19, 0x18, 0x4c, 0xbb, 0xe1, 0xf2, 0xf8, 0xf5, 0x80, 0x86, 0xbd, 0xf2, 0xfe,
+    0xfe, 0xfe, 0xfd, 0xf5, 0xbb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd3, 0xc5, 0xc3, 0xb4, 0xa1, 0xb2, 0xb3, 0xa8, 0xae, 0x99, 0x92, 0x86, 0x89, 0x7f, 0x92, 0x80,
+    0x7f, 0x7d, 0x79, 0x7c, 0x7e, 0x7f, 0x72, 0x45, 0x7a, 0x76, 0x51, 0x5c, 0x6e, 0x67, 0xb6, 0x99,
+    0x7d, 0x98, 0xb5, 0xa3, 0x87, 0x62, 0x78, 0x8a, 0x89, 0x77, 0x4e, 0x5c, 0x73, 0xc9, 0xde, 0xa7,
+    0xe0, 0xf7, 0xe8, 0x58, 0x7c, 0x53, 0x3d, 0x49, 0x89, 0xa7, 0x87, 0x48, 0x45, 0x37, 0x1f, 0x0a,
+    0x02, 0x05, 0x09, 0x0a, 0x1e, 0xca, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0x58, 0x4a, 0x4c, 0x58, 0xaa,
+    0xf8, 0xfe, 0xfe, 0xfd, 0xf6, 0xe4, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xce, 0xc4, 0xc2, 0xb2, 0xa3, 0xa9, 0xa9, 0xae, 0xab, 0x91, 0x8e, 0x91, 0x8c, 0x84, 0x8d, 0x8b,
+    0x7a, 0x79, 0x7e, 0x78, 0x7b, 0x84, 0x7d, 0x4b, 0x7d, 0x6b, 0x4f, 0x6a, 0x76, 0x7f, 0x90, 0xb0,
+    0xc5, 0xc9, 0x98, 0xb7, 0x8f, 0x4e, 0x64, 0x87, 0x8b, 0x72, 0x4c, 0x58, 0x67, 0xcf, 0xdd, 0x79,
+    0xe2, 0xf5, 0xf4, 0x59, 0x61, 0x92, 0x7e, 0x86, 0x59, 0x4a, 0x54, 0x44, 0x44, 0x14, 0x04, 0x02,
+    0x02, 0x08, 0x07, 0x07, 0x67, 0xbd, 0xb1, 0x90, 0x75, 0x5f, 0x4b, 0x1a, 0x1a, 0x26, 0x36, 0x42,
+    0x60, 0xc4, 0xfd, 0xfd, 0xf5, 0xec, 0xe8, 0x61, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0xc4, 0xc2, 0xb1, 0xa3, 0xa7, 0xa0, 0xab, 0x9f, 0x8a, 0x9b, 0x9b, 0x82, 0x90, 0x88, 0x92,
+    0x7e, 0x74, 0x74, 0x7a, 0x74, 0x76, 0x71, 0x5c, 0x79, 0x66, 0x8d, 0x9f, 0x8a, 0x68, 0x84, 0x92,
+    0x7a, 0xc9, 0xe0, 0xaa, 0x90, 0x78, 0x54, 0x76, 0x88, 0x6d, 0x4a, 0x56, 0x63, 0xd9, 0xdc, 0x6b,
+    0xda, 0xf2, 0xf4, 0x63, 0x57, 0x5a, 0x5e, 0x6d, 0x74, 0x75, 0x7e, 0x3b, 0x1c, 0x03, 0x01, 0x00,
+    0x05, 0x04, 0x01, 0x00, 0x10, 0x16, 0x12, 0x18, 0x18, 0x15, 0x0e, 0x0b, 0x07, 0x07, 0x09, 0x1b,
+    0x2f, 0x3f, 0x84, 0xee, 0xfd, 0xf1, 0xe9, 0xea, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbf, 0xc5, 0xc3, 0xae, 0x96, 0x9a, 0x97, 0xa5, 0x9f, 0x92, 0x97, 0x99, 0x7d, 0x94, 0x91, 0x92,
+    0x7f, 0x79, 0x72, 0x6f, 0x75, 0x6f, 0x61, 0x67, 0x79, 0x57, 0x5a, 0x67, 0x8c, 0x7c, 0x40, 0x4e,
+    0x4e, 0x61, 0x94, 0x9a, 0x74, 0x60, 0x56, 0x65, 0x7f, 0x6a, 0x48, 0x53, 0x5a, 0xe2, 0xdb, 0x6d,
+    0xcb, 0xec, 0xee, 0x74, 0x4b, 0x5c, 0x4e, 0x48, 0x45, 0x41, 0x23, 0x1c, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
+    0x07, 0x1d, 0x3b, 0x68, 0xd6, 0xfe, 0xf0, 0xef, 0xe6, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xba, 0xc5, 0xc2, 0xa8, 0x91, 0x95, 0x93, 0x9e, 0x94, 0x93, 0x88, 0x8f, 0x8c, 0x9a, 0x97, 0x91,
+    0x7c, 0x7b, 0x77, 0x70, 0x67, 0x6e, 0x63, 0x6f, 0x78, 0x53, 0x6b, 0x41, 0x4b, 0x9d, 0x99, 0x77,
+    0x51, 0x4b, 0x7e, 0x85, 0x7b, 0x51, 0x56, 0x5d, 0x7b, 0x5d, 0x46, 0x52, 0x68, 0xe1, 0xd8, 0x68,
+    0xc4, 0xe8, 0xeb, 0x80, 0x3c, 0x67, 0x63, 0x61, 0x61, 0x3f, 0x30, 0x0f, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x03, 0x19, 0x47, 0x69, 0xc9, 0xfc, 0xf4, 0xf3, 0xce, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8f, 0xc0, 0xbf, 0x99, 0x8d, 0x97, 0x95, 0x99, 0x90, 0x96, 0x91, 0x85, 0x95, 0x98, 0x97, 0x89,
+    0x77, 0x78, 0x71, 0x62, 0x60, 0x5f, 0x5f, 0x77, 0x78, 0x5f, 0x86, 0x6f, 0x8c, 0xab, 0x99, 0xd0,
+    0xcd, 0xd7, 0xe1, 0xbf, 0x3f, 0x53, 0x4c, 0x64, 0x74, 0x4c, 0x44, 0x5c, 0x88, 0xdb, 0xcc, 0x71,
+    0xbe, 0xe4, 0xe6, 0x84, 0x30, 0x5f, 0x73, 0x61, 0x2b, 0x44, 0x2c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x04, 0x16, 0x3d, 0x5f, 0xc3, 0xf9, 0xf3, 0xf5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x43, 0xa7, 0xb6, 0x8a, 0x8e, 0x95, 0x94, 0x9c, 0x94, 0x97, 0x99, 0x8f, 0x8b, 0x94, 0x99, 0x96,
+    0x8b, 0x7e, 0x72, 0x60, 0x58, 0x54, 0x4c, 0x62, 0x78, 0x67, 0x9a, 0x61, 0x71, 0xd9, 0xda, 0xe4,
+    0xd6, 0xa5, 0x85, 0x5b, 0x62, 0x51, 0x49, 0x6c, 0x5e, 0x43, 0x4b, 0x75, 0x95, 0xd3, 0xb7, 0x85,
+    0xb7, 0xde, 0xdf, 0x86, 0x29, 0x57, 0x7e, 0x3b, 0x45, 0x43, 0x0c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x04, 0x0f, 0x35, 0x56, 0xb8, 0xf4, 0xf5, 0xf1, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x67, 0xaa, 0x97, 0x90, 0x95, 0x97, 0xa0, 0x96, 0x9a, 0x98, 0x95, 0x97, 0x97, 0x8d, 0x8a,
+    0x8b, 0x8b, 0x83, 0x5c, 0x57, 0x4a, 0x4d, 0x4b, 0x7c, 0x73, 0x84, 0x85, 0x52, 0x9a, 0xc3, 0xc2,
+    0x37, 0x42, 0x4b, 0x4d, 0x9a, 0x64, 0x4b, 0x6b, 0x4a, 0x44, 0x65, 0x84, 0x94, 0xcb, 0xa8, 0x93,
+    0xae, 0xda, 0xd9, 0x87, 0x28, 0x5e, 0x7d, 0x36, 0x5a, 0x0f, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x11, 0x38, 0x53, 0xd0, 0xf0, 0xf7, 0x73, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x3a, 0x78, 0x96, 0x87, 0x8f, 0x97, 0xa1, 0x97, 0x92, 0x97, 0x86, 0x6f, 0x5a, 0x54, 0x54,
+    0x59, 0x64, 0x73, 0x4f, 0x4e, 0x47, 0x48, 0x33, 0x7a, 0x77, 0x62, 0x98, 0x7b, 0x6b, 0x99, 0x5b,
+    0x42, 0x43, 0x4c, 0x92, 0x83, 0x46, 0x6d, 0x56, 0x45, 0x5d, 0x80, 0x81, 0x93, 0xbd, 0xa5, 0x8f,
+    0xa1, 0xd9, 0xd2, 0x8a, 0x30, 0x65, 0x6e, 0x56, 0x1d, 0x0f, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x03, 0x07, 0x14, 0x3a, 0x64, 0xe6, 0xf3, 0xc5, 0x01, 0x00, 0x00, 0x00,
+    0x33, 0x37, 0x36, 0x74, 0x68, 0x56, 0x71, 0x66, 0x6f, 0x6f, 0x63, 0x61, 0x6f, 0x79, 0x79, 0x76,
+    0x72, 0x60, 0x51, 0x58, 0x55, 0x55, 0x34, 0x3d, 0x72, 0x7b, 0x72, 0x5e, 0x7e, 0x84, 0x75, 0x5f,
+    0x65, 0x63, 0x99, 0x6e, 0x4c, 0x69, 0x71, 0x48, 0x57, 0x7b, 0x82, 0x75, 0x8f, 0xb9, 0x9e, 0x6a,
+    0x90, 0xd2, 0xcb, 0x89, 0x38, 0x6e, 0x57, 0x43, 0x0d, 0x13, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x05, 0x06, 0x05, 0x05, 0x03, 0x05, 0x06, 0x1a, 0x3f, 0x8d, 0xea, 0xf1, 0x1c, 0x00, 0x00, 0x00,
+    0x36, 0x35, 0x2a, 0x41, 0x86, 0x62, 0x35, 0x59, 0x78, 0x77, 0x85, 0x8e, 0x8b, 0x89, 0x7e, 0x77,
+    0x78, 0x79, 0x78, 0x67, 0x5c, 0x51, 0x18, 0x43, 0x6b, 0x7b, 0x79, 0x71, 0x5a, 0x60, 0x77, 0x7c,
+    0x77, 0x61, 0x55, 0x4c, 0x69, 0x73, 0x63, 0x53, 0x71, 0x81, 0x7a, 0x6b, 0x8f, 0xb3, 0x6d, 0x4f,
+    0x9d, 0xc9, 0xc2, 0x81, 0x3e, 0x68, 0x5f, 0x1d, 0x0e, 0x13, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d,
+    0x12, 0x12, 0x10, 0x09, 0x07, 0x05, 0x07, 0x0a, 0x2b, 0x3f, 0xd1, 0xf2, 0x5a, 0x00, 0x00, 0x00,
+    0x38, 0x34, 0x2c, 0x2d, 0x7a, 0x83, 0x56, 0x5e, 0x7b, 0x8c, 0x89, 0x8a, 0x8c, 0x8f, 0x90, 0x8a,
+    0x86, 0x82, 0x6e, 0x6d, 0x72, 0x66, 0x21, 0x40, 0x62, 0x83, 0x79, 0x78, 0x76, 0x69, 0x5e, 0x57,
+    0x55, 0x51, 0x63, 0x74, 0x71, 0x6c, 0x71, 0x63, 0x7a, 0x67, 0x55, 0x46, 0x85, 0xa5, 0x5e, 0x6c,
+    0x93, 0xbd, 0xb9, 0x75, 0x41, 0x5b, 0x4b, 0x0d, 0x1c, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x40, 0x65, 0x28, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x26,
+    0x30, 0x34, 0x2b, 0x21, 0x0f, 0x09, 0x06, 0x08, 0x15, 0x33, 0x71, 0xec, 0x91, 0x00, 0x00, 0x00,
+    0x3a, 0x32, 0x2d, 0x28, 0x60, 0x86, 0x7d, 0x74, 0x70, 0x78, 0x97, 0x93, 0x8d, 0x8d, 0x90, 0x93,
+    0x94, 0x8a, 0x68, 0x60, 0x51, 0x4a, 0x3e, 0x35, 0x53, 0x76, 0x85, 0x7a, 0x75, 0x76, 0x75, 0x76,
+    0x74, 0x73, 0x73, 0x72, 0x79, 0x6e, 0x58, 0x4c, 0x39, 0x2d, 0x2d, 0x40, 0x94, 0x9c, 0x4f, 0x3c,
+    0x96, 0xb9, 0xb8, 0x6d, 0x3d, 0x53, 0x28, 0x08, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x0f, 0xd1, 0xfe, 0xf9, 0x91, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x44,
+    0x55, 0x5c, 0x50, 0x34, 0x1f, 0x0f, 0x06, 0x09, 0x0a, 0x23, 0x31, 0xd4, 0xbb, 0x00, 0x00, 0x00,
+    0x39, 0x30, 0x29, 0x24, 0x47, 0x80, 0x81, 0x7d, 0x84, 0x82, 0x7b, 0x81, 0x8c, 0x96, 0x9a, 0x9b,
+    0x9a, 0x89, 0x7e, 0x75, 0x6b, 0x5c, 0x4c, 0x31, 0x50, 0x67, 0x88, 0x8b, 0x85, 0x7a, 0x74, 0x72,
+    0x75, 0x78, 0x7c, 0x65, 0x42, 0x32, 0x2d, 0x2e, 0x36, 0x4c, 0x66, 0x74, 0x97, 0x9a, 0x3f, 0x71,
+    0xaf, 0xbb, 0xbd, 0x64, 0x38, 0x4d, 0x18, 0x10, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x48, 0xfd, 0xfe, 0xfe, 0xa4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3d, 0x62,
+    0x77, 0x76, 0x63, 0x46, 0x2c, 0x12, 0x09, 0x09, 0x08, 0x10, 0x25, 0x9e, 0xd3, 0x02, 0x00, 0x00,
+    0x36, 0x2c, 0x23, 0x23, 0x44, 0x5f, 0x88, 0x7e, 0x84, 0x83, 0x8e, 0x95, 0x9a, 0x9c, 0x9d, 0x9e,
+    0x97, 0x80, 0x75, 0x74, 0x70, 0x6d, 0x62, 0x46, 0x61, 0x7e, 0x79, 0x8a, 0x8d, 0x90, 0x8f, 0x84,
+    0x66, 0x4e, 0x35, 0x2e, 0x36, 0x42, 0x51, 0x61, 0x71, 0x79, 0x70, 0x54, 0x6f, 0xa7, 0x5f, 0x80,
+    0xbc, 0xbf, 0xc3, 0x60, 0x38, 0x35, 0x0f, 0x12, 0x0b, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x9e, 0xfe, 0xfe, 0xfe, 0x6b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x4e, 0x73,
+    0x8b, 0x8c, 0x70, 0x4e, 0x2c, 0x18, 0x08, 0x05, 0x05, 0x06, 0x19, 0x74, 0xdf, 0x07, 0x00, 0x00,
+    0x33, 0x28, 0x21, 0x27, 0x44, 0x58, 0x71, 0x7c, 0x88, 0x93, 0x95, 0x9a, 0x99, 0x8f, 0x7a, 0x7d,
+    0x7f, 0x86, 0x6e, 0x57, 0x56, 0x58, 0x5a, 0x59, 0x6a, 0x7e, 0x74, 0x7f, 0x7e, 0x76, 0x54, 0x2d,
+    0x30, 0x3e, 0x52, 0x5b, 0x69, 0x76, 0x7b, 0x7a, 0x74, 0x66, 0x55, 0x5f, 0x7a, 0xb9, 0xb9, 0xb9,
+    0xba, 0xb7, 0xc1, 0x54, 0x3c, 0x1e, 0x0c, 0x0c, 0x09, 0x0a, 0x54, 0x0b, 0x00, 0x00, 0x00, 0x01,
+    0x16, 0xe1, 0xfe, 0xfe, 0xf3, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0x56, 0x7e,
+    0x94, 0x8d, 0x7c, 0x56, 0x2b, 0x16, 0x06, 0x08, 0x05, 0x03, 0x0a, 0x54, 0xdb, 0x1b, 0x00, 0x00,
+    0x30, 0x24, 0x22, 0x29, 0x47, 0x50, 0x5b, 0x7b, 0x83, 0x87, 0x7f, 0x65, 0x5c, 0x76, 0x92, 0x91,
+    0x7d, 0x5a, 0x71, 0x8b, 0x84, 0x88, 0x8c, 0x8b, 0x88, 0x7e, 0x6e, 0x68, 0x53, 0x2b, 0x27, 0x3e,
+    0x62, 0x72, 0x6b, 0x70, 0x7d, 0x80, 0x82, 0x63, 0x5f, 0x61, 0x6f, 0x71, 0x85, 0xaa, 0xf7, 0xde,
+    0x90, 0xa7, 0xc0, 0x4e, 0x3b, 0x1b, 0x07, 0x07, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x2a, 0xfc, 0xfe, 0xfe, 0xd2, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x30, 0x5a, 0x7d,
+    0x8f, 0x90, 0x7e, 0x56, 0x2e, 0x1a, 0x10, 0x04, 0x02, 0x02, 0x0a, 0x36, 0xd8, 0x1d, 0x00, 0x00,
+    0x2f, 0x22, 0x27, 0x2e, 0x49, 0x5b, 0x5b, 0x6c, 0x5c, 0x36, 0x2f, 0x62, 0x84, 0x8e, 0x78, 0x67,
+    0x6f, 0x86, 0x92, 0x99, 0x93, 0x8d, 0x8a, 0x88, 0x90, 0x8c, 0x78, 0x49, 0x29, 0x34, 0x4c, 0x65,
+    0x76, 0x7f, 0x7c, 0x83, 0x76, 0x81, 0x83, 0x5b, 0x6e, 0x7a, 0x7e, 0x80, 0x85, 0xaa, 0xfb, 0xe4,
+    0x68, 0x8b, 0xc4, 0x4c, 0x3a, 0x17, 0x05, 0x08, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0xba, 0xe0, 0xf8, 0x98, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x52, 0x73,
+    0x8c, 0x8f, 0x79, 0x54, 0x2d, 0x11, 0x06, 0x05, 0x03, 0x02, 0x04, 0x19, 0x74, 0x43, 0x1f, 0x00,
+    0x2f, 0x22, 0x2c, 0x31, 0x45, 0x59, 0x64, 0x48, 0x1a, 0x21, 0x5d, 0x86, 0x8a, 0x7d, 0x81, 0x92,
+    0x8f, 0x94, 0x99, 0x8a, 0x79, 0x78, 0x83, 0x90, 0x8e, 0x7d, 0x72, 0x6a, 0x37, 0x57, 0x55, 0x5d,
+    0x74, 0x7d, 0x87, 0x87, 0x8c, 0x83, 0x82, 0x60, 0x7c, 0x80, 0x82, 0x80, 0x81, 0xaa, 0xf4, 0xe5,
+    0x45, 0x74, 0xc4, 0x4c, 0x32, 0x14, 0x07, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x13, 0x27, 0x35, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x41, 0x68,
+    0x7c, 0x80, 0x6f, 0x4a, 0x2c, 0x0f, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x24, 0x18, 0x09, 0x00,
+    0x2c, 0x24, 0x30, 0x30, 0x44, 0x5c, 0x59, 0x23, 0x17, 0x41, 0x73, 0x7d, 0x82, 0x90, 0x94, 0x95,
+    0x9a, 0x97, 0x82, 0x73, 0x78, 0x87, 0x94, 0x8d, 0x79, 0x7e, 0x7d, 0x75, 0x55, 0x8c, 0xd7, 0xe8,
+    0xc4, 0x95, 0x83, 0x8b, 0x83, 0x83, 0x7a, 0x69, 0x87, 0x8d, 0x6f, 0x60, 0x87, 0xb6, 0xf9, 0xf6,
+    0x4a, 0x6f, 0xc9, 0x53, 0x2c, 0x15, 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x17, 0x30, 0x55,
+    0x72, 0x70, 0x61, 0x45, 0x27, 0x0a, 0x02, 0x02, 0x02, 0x00, 0x00, 0x15, 0x3d, 0x95, 0x6b, 0x00,
+    0x29, 0x28, 0x31, 0x2d, 0x3e, 0x5b, 0x38, 0x1a, 0x29, 0x56, 0x6f, 0x80, 0x7e, 0x88, 0x91, 0x94,
+    0x90, 0x8e, 0x8f, 0x8e, 0x90, 0x97, 0x90, 0x87, 0x92, 0x91, 0x8a, 0x86, 0x7b, 0xc4, 0xfe, 0xfe,
+    0xfc, 0xee, 0xbb, 0x7a, 0x8c, 0x8d, 0x87, 0x71, 0x80, 0x73, 0x2f, 0x63, 0x2d, 0x84, 0xf5, 0xba,
+    0x6c, 0x68, 0xd0, 0x71, 0x28, 0x11, 0x0b, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x24, 0x3f,
+    0x57, 0x5d, 0x58, 0x39, 0x19, 0x07, 0x05, 0x02, 0x01, 0x00, 0x00, 0x1b, 0x84, 0x66, 0x99, 0x02,
+    0x31, 0x2e, 0x2e, 0x2c, 0x35, 0x4e, 0x2b, 0x1f, 0x3a, 0x50, 0x4c, 0x7e, 0x82, 0x84, 0x7f, 0x7b,
+    0x7e, 0x75, 0x6a, 0x7e, 0x97, 0x90, 0x90, 0x97, 0x98, 0x96, 0x90, 0x88, 0x7d, 0x7f, 0xce, 0xba,
+    0xd3, 0xf2, 0xe0, 0xa5, 0x7e, 0x89, 0x81, 0x7f, 0x7e, 0x34, 0x41, 0x75, 0x4a, 0x2b, 0x42, 0x61,
+    0xa4, 0x5d, 0xcc, 0x90, 0x36, 0x12, 0x21, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x2a, 0x3c,
+    0x54, 0x63, 0x53, 0x37, 0x1e, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x6d, 0x4a, 0x79, 0x05,
+    0x70, 0x31, 0x2a, 0x2b, 0x2a, 0x40, 0x29, 0x2b, 0x49, 0x3d, 0x4c, 0x6e, 0x86, 0x85, 0x73, 0x6c,
+    0x60, 0x63, 0x85, 0x9a, 0x93, 0x93, 0x99, 0x9a, 0x99, 0x95, 0x7c, 0x49, 0x2e, 0x38, 0x4e, 0xab,
+    0xae, 0xc9, 0xe6, 0xd8, 0x62, 0x86, 0x8e, 0x86, 0x7e, 0x1e, 0x78, 0xc1, 0x76, 0x25, 0x1a, 0x22,
+    0xa4, 0x89, 0xcc, 0xa7, 0x45, 0x10, 0x12, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x27, 0x39,
+    0x4e, 0x54, 0x46, 0x23, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x27, 0x42, 0x20, 0x3c, 0x1b,
+    0xa0, 0x5b, 0x29, 0x29, 0x21, 0x35, 0x2f, 0x39, 0x51, 0x38, 0x4e, 0x54, 0x87, 0x74, 0x80, 0x74,
+    0x80, 0x90, 0x9d, 0x99, 0x98, 0x9c, 0x9c, 0x9a, 0x83, 0x45, 0x2e, 0x28, 0x2f, 0x2b, 0x3f, 0xb0,
+    0x99, 0xa8, 0xe2, 0xdc, 0x6d, 0x83, 0x87, 0x83, 0x6b, 0x14, 0x83, 0xd8, 0xb0, 0x1e, 0x47, 0x3d,
+    0x72, 0xad, 0xcd, 0xab, 0x46, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x08,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x37, 0x15, 0x19, 0xb4,
+    0xa1, 0xa4, 0x3f, 0x27, 0x20, 0x2d, 0x36, 0x46, 0x51, 0x3b, 0x4d, 0x62, 0x6d, 0x6c, 0x6f, 0x82,
+    0x8f, 0x94, 0x98, 0x99, 0x9d, 0x9b, 0x91, 0x56, 0x2e, 0x9a, 0x7d, 0x1a, 0x06, 0x12, 0x21, 0xa5,
+    0x7d, 0x4f, 0xda, 0xcc, 0x65, 0x83, 0x87, 0x7f, 0x52, 0x12, 0x60, 0x8c, 0x74, 0x48, 0x51, 0x47,
+    0x97, 0x88, 0xc2, 0xa4, 0x3e, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x61, 0x24, 0x20, 0xa2,
+    0xaa, 0xb1, 0x7e, 0x2c, 0x22, 0x2e, 0x3f, 0x51, 0x4e, 0x40, 0x43, 0x68, 0x5d, 0x78, 0x8b, 0x91,
+    0x95, 0x98, 0x8f, 0x93, 0x93, 0x77, 0x36, 0x41, 0x69, 0x3b, 0x04, 0x02, 0x07, 0x15, 0x1f, 0x49,
+    0x36, 0x5d, 0xdc, 0xb7, 0x4d, 0x83, 0x83, 0x7d, 0x3a, 0x32, 0x4d, 0x3e, 0x30, 0x36, 0x2d, 0x77,
+    0x97, 0xb4, 0xac, 0x9c, 0x44, 0x09, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x59, 0x48, 0x16, 0x88,
+    0xb1, 0xa1, 0x86, 0x6e, 0x2d, 0x30, 0x32, 0x4f, 0x4b, 0x4e, 0x3e, 0x62, 0x6b, 0x43, 0x6b, 0x60,
+    0x55, 0x76, 0x89, 0x6e, 0x3c, 0x1c, 0x7a, 0x99, 0x1f, 0x02, 0x02, 0x06, 0x17, 0x21, 0x30, 0x50,
+    0x9d, 0xe6, 0xc7, 0x95, 0x4d, 0x87, 0x84, 0x7c, 0x59, 0x70, 0x54, 0x25, 0x36, 0x28, 0x30, 0x7c,
+    0xa2, 0xc3, 0xbc, 0x8e, 0x45, 0x04, 0x0c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x1d, 0x30, 0x4a, 0x21, 0x43,
+    0xaa, 0x89, 0x83, 0x97, 0x67, 0x2f, 0x27, 0x39, 0x48, 0x50, 0x40, 0x5b, 0x4a, 0x1b, 0x1c, 0x3f,
+    0x68, 0x75, 0x53, 0x23, 0x14, 0x4a, 0xbb, 0x1a, 0x01, 0x01, 0x09, 0x1a, 0x2b, 0x42, 0x50, 0x39,
+    0x4c, 0xb2, 0x9a, 0x42, 0x81, 0x87, 0x82, 0x7b, 0x74, 0x6c, 0x51, 0x3f, 0x3f, 0x32, 0x15, 0x61,
+    0xa0, 0xc1, 0xbe, 0x8c, 0x58, 0x22, 0x11, 0x10, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x50, 0x19, 0x20, 0x47, 0x33, 0x0f,
+};
+
+static const uint8_t coffee[96 * 96] = {
+    0x1e, 0x1e, 0x1d, 0x1e, 0x1e, 0x1f, 0x21, 0x21, 0x21, 0x21, 0x22, 0x24, 0x3a, 0x47, 0x55, 0x4c,
+    0x57, 0x68, 0x6e, 0x75, 0x76, 0x6d, 0x74, 0x76, 0x6a, 0x67, 0x6b, 0x74, 0x77, 0x77, 0x64, 0x5f,
+    0x5c, 0x5b, 0x50, 0x56, 0x4d, 0x4f, 0x70, 0x7e, 0x7a, 0x7e, 0x78, 0x6e, 0x68, 0x73, 0x6e, 0x6c,
+    0x70, 0x71, 0x71, 0x6f, 0x6c, 0x67, 0x6b, 0x71, 0x71, 0x79, 0x76, 0x7a, 0x75, 0x73, 0x70, 0x81,
+    0x88, 0x85, 0x80, 0x84, 0x7e, 0x7d, 0x78, 0x77, 0x83, 0x7e, 0x7a, 0x80, 0x81, 0x81, 0x7c, 0x7b,
+    0x83, 0x82, 0x84, 0x84, 0x86, 0x86, 0x81, 0x83, 0x84, 0x82, 0x87, 0x81, 0x82, 0x87, 0x91, 0x94,
+    0x1e, 0x1f, 0x1e, 0x1e, 0x1f, 0x20, 0x22, 0x22, 0x21, 0x21, 0x2f, 0x47, 0x4b, 0x4d, 0x52, 0x62,
+    0x70, 0x75, 0x7e, 0x70, 0x71, 0x6a, 0x66, 0x70, 0x66, 0x70, 0x78, 0x78, 0x6c, 0x6f, 0x69, 0x5d,
+    0x51, 0x58, 0x53, 0x59, 0x5a, 0x6e, 0x7a, 0x70, 0x77, 0x73, 0x70, 0x6f, 0x6c, 0x71, 0x6e, 0x6f,
+    0x71, 0x70, 0x6e, 0x6d, 0x6e, 0x70, 0x6e, 0x74, 0x79, 0x78, 0x75, 0x76, 0x73, 0x6d, 0x79, 0x7e,
+    0x7b, 0x7f, 0x7c, 0x7e, 0x7e, 0x77, 0x7f, 0x80, 0x7b, 0x7a, 0x7a, 0x80, 0x7f, 0x7e, 0x85, 0x82,
+    0x83, 0x83, 0x82, 0x84, 0x85, 0x83, 0x84, 0x83, 0x83, 0x86, 0x87, 0x82, 0x86, 0x8b, 0x8f, 0x87,
+    0x1d, 0x1d, 0x1e, 0x1f, 0x21, 0x21, 0x21, 0x22, 0x27, 0x3b, 0x54, 0x50, 0x4d, 0x5b, 0x6f, 0x6e,
+    0x78, 0x80, 0x7d, 0x7b, 0x7c, 0x70, 0x72, 0x6f, 0x7a, 0x79, 0x74, 0x67, 0x64, 0x60, 0x5c, 0x55,
+    0x5b, 0x56, 0x5b, 0x6d, 0x73, 0x72, 0x70, 0x6c, 0x67, 0x6a, 0x67, 0x6a, 0x6d, 0x74, 0x76, 0x71,
+    0x72, 0x75, 0x78, 0x76, 0x77, 0x6f, 0x75, 0x7b, 0x78, 0x78, 0x79, 0x78, 0x77, 0x7a, 0x81, 0x89,
+    0x85, 0x7c, 0x7a, 0x74, 0x78, 0x81, 0x7c, 0x7a, 0x7b, 0x7e, 0x79, 0x77, 0x7a, 0x7b, 0x82, 0x84,
+    0x86, 0x84, 0x82, 0x83, 0x80, 0x81, 0x83, 0x81, 0x7d, 0x82, 0x85, 0x8d, 0x8a, 0x87, 0x87, 0x87,
+    0x1f, 0x1e, 0x1f, 0x20, 0x20, 0x20, 0x21, 0x30, 0x4f, 0x56, 0x54, 0x50, 0x65, 0x6d, 0x71, 0x75,
+    0x74, 0x75, 0x7f, 0x7b, 0x6d, 0x68, 0x75, 0x7b, 0x77, 0x6f, 0x70, 0x5f, 0x63, 0x64, 0x6a, 0x5f,
+    0x59, 0x69, 0x77, 0x76, 0x71, 0x69, 0x66, 0x67, 0x6b, 0x66, 0x6a, 0x71, 0x6f, 0x71, 0x71, 0x75,
+    0x6c, 0x73, 0x79, 0x77, 0x70, 0x7b, 0x84, 0x7f, 0x79, 0x7f, 0x7a, 0x70, 0x77, 0x7b, 0x7a, 0x71,
+    0x79, 0x7c, 0x80, 0x7c, 0x7c, 0x78, 0x7c, 0x76, 0x76, 0x7f, 0x79, 0x7c, 0x7a, 0x7d, 0x83, 0x86,
+    0x86, 0x82, 0x7d, 0x79, 0x7c, 0x7d, 0x81, 0x7e, 0x76, 0x79, 0x81, 0x8c, 0x89, 0x89, 0x8b, 0x8a,
+    0x1f, 0x1f, 0x21, 0x21, 0x21, 0x22, 0x3c, 0x52, 0x54, 0x56, 0x5b, 0x71, 0x6f, 0x6a, 0x76, 0x7a,
+    0x81, 0x82, 0x6e, 0x6c, 0x6d, 0x7a, 0x79, 0x6c, 0x6a, 0x78, 0x70, 0x58, 0x51, 0x48, 0x52, 0x55,
+    0x6a, 0x79, 0x76, 0x70, 0x70, 0x71, 0x82, 0x9e, 0xaf, 0xbf, 0xc7, 0xcc, 0xca, 0xca, 0xc8, 0xbe,
+    0xaf, 0xa0, 0x86, 0x75, 0x78, 0x81, 0x79, 0x77, 0x7d, 0x7e, 0x76, 0x77, 0x75, 0x7a, 0x7d, 0x70,
+    0x70, 0x7b, 0x7f, 0x7c, 0x75, 0x81, 0x80, 0x7a, 0x75, 0x7a, 0x7a, 0x76, 0x72, 0x7a, 0x7d, 0x7f,
+    0x7e, 0x81, 0x7f, 0x76, 0x75, 0x7e, 0x80, 0x7c, 0x80, 0x81, 0x80, 0x81, 0x88, 0x87, 0x85, 0x8f,
+    0x20, 0x21, 0x22, 0x22, 0x24, 0x3f, 0x54, 0x4f, 0x55, 0x5e, 0x67, 0x68, 0x74, 0x74, 0x78, 0x7f,
+    0x6c, 0x69, 0x6c, 0x6e, 0x79, 0x71, 0x6e, 0x6a, 0x76, 0x6b, 0x5d, 0x52, 0x52, 0x50, 0x5d, 0x6c,
+    0x77, 0x75, 0x87, 0xaf, 0xd0, 0xec, 0xf1, 0xf1, 0xf2, 0xf3, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5,
+    0xf3, 0xf3, 0xf1, 0xe9, 0xd1, 0xb4, 0x91, 0x7a, 0x7d, 0x81, 0x7b, 0x73, 0x78, 0x7a, 0x79, 0x76,
+    0x70, 0x81, 0x70, 0x73, 0x7b, 0x82, 0x7c, 0x7b, 0x7d, 0x7f, 0x78, 0x76, 0x78, 0x7b, 0x78, 0x7f,
+    0x79, 0x7a, 0x78, 0x77, 0x75, 0x7b, 0x7f, 0x7e, 0x82, 0x84, 0x81, 0x84, 0x83, 0x84, 0x8f, 0x93,
+    0x20, 0x21, 0x21, 0x2d, 0x4c, 0x4e, 0x56, 0x5d, 0x66, 0x78, 0x74, 0x79, 0x79, 0x74, 0x71, 0x64,
+    0x6b, 0x6d, 0x71, 0x7b, 0x6f, 0x61, 0x61, 0x6b, 0x63, 0x56, 0x5a, 0x5a, 0x59, 0x69, 0x70, 0x76,
+    0xa6, 0xdd, 0xef, 0xf0, 0xf3, 0xf6, 0xf7, 0xf7, 0xf4, 0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf2,
+    0xf4, 0xf8, 0xfb, 0xfa, 0xf8, 0xf4, 0xf3, 0xe7, 0xb7, 0x83, 0x78, 0x7c, 0x79, 0x74, 0x75, 0x78,
+    0x78, 0x6c, 0x6e, 0x77, 0x7f, 0x7d, 0x77, 0x79, 0x7f, 0x7f, 0x7e, 0x7f, 0x85, 0x7f, 0x7d, 0x7c,
+    0x73, 0x6e, 0x78, 0x79, 0x7a, 0x7e, 0x81, 0x7c, 0x85, 0x8f, 0x8b, 0x86, 0x85, 0x8d, 0x90, 0x96,
+    0x1f, 0x20, 0x37, 0x55, 0x4f, 0x53, 0x68, 0x66, 0x64, 0x71, 0x75, 0x75, 0x73, 0x74, 0x67, 0x67,
+    0x6e, 0x79, 0x78, 0x70, 0x61, 0x6e, 0x6c, 0x5b, 0x5b, 0x53, 0x56, 0x62, 0x73, 0x79, 0xaf, 0xe4,
+    0xef, 0xf1, 0xf4, 0xf5, 0xf0, 0xea, 0xe5, 0xe2, 0xde, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xda, 0xdd,
+    0xdf, 0xe2, 0xe5, 0xeb, 0xf1, 0xf7, 0xfb, 0xf8, 0xf2, 0xed, 0xc8, 0x91, 0x76, 0x77, 0x79, 0x72,
+    0x63, 0x6f, 0x6f, 0x76, 0x80, 0x77, 0x7c, 0x7d, 0x7e, 0x83, 0x87, 0x85, 0x84, 0x89, 0x82, 0x79,
+    0x70, 0x76, 0x72, 0x73, 0x7e, 0x81, 0x85, 0x89, 0x8a, 0x8c, 0x8b, 0x89, 0x8d, 0x8a, 0x8f, 0x8c,
+    0x25, 0x47, 0x57, 0x62, 0x64, 0x6b, 0x66, 0x6f, 0x6a, 0x6a, 0x70, 0x6f, 0x6b, 0x6a, 0x63, 0x76,
+    0x7e, 0x76, 0x6d, 0x66, 0x6c, 0x70, 0x62, 0x63, 0x59, 0x5e, 0x75, 0x81, 0xb1, 0xe5, 0xef, 0xef,
+    0xef, 0xec, 0xe6, 0xe0, 0xd9, 0xd1, 0xcb, 0xc4, 0xc2, 0xc0, 0xc0, 0xc0, 0xc1, 0xc2, 0xc4, 0xc6,
+    0xc8, 0xcc, 0xd0, 0xd7, 0xdd, 0xe5, 0xe6, 0xed, 0xf5, 0xf9, 0xf5, 0xf1, 0xd1, 0xa3, 0x71, 0x6d,
+    0x73, 0x76, 0x72, 0x71, 0x78, 0x7c, 0x7d, 0x78, 0x7f, 0x7f, 0x7e, 0x82, 0x8a, 0x85, 0x76, 0x73,
+    0x75, 0x75, 0x73, 0x78, 0x7c, 0x7f, 0x83, 0x87, 0x88, 0x82, 0x83, 0x8d, 0x8e, 0x8d, 0x8b, 0x8b,
+    0x4d, 0x57, 0x61, 0x66, 0x67, 0x6c, 0x77, 0x69, 0x72, 0x67, 0x6f, 0x6d, 0x67, 0x6b, 0x7d, 0x76,
+    0x72, 0x65, 0x6c, 0x68, 0x66, 0x6a, 0x66, 0x5d, 0x6f, 0x7f, 0x98, 0xe8, 0xef, 0xef, 0xee, 0xe9,
+    0xe3, 0xd9, 0xcb, 0xc0, 0xb9, 0xb6, 0xb5, 0xb5, 0xb7, 0xb8, 0xb9, 0xbb, 0xbc, 0xbe, 0xbf, 0xc0,
+    0xc1, 0xc2, 0xc3, 0xc6, 0xc8, 0xcf, 0xd5, 0xdc, 0xe3, 0xe8, 0xf2, 0xfb, 0xf6, 0xf0, 0xcc, 0x81,
+    0x75, 0x79, 0x76, 0x75, 0x76, 0x77, 0x7e, 0x7c, 0x8a, 0x86, 0x88, 0x8b, 0x88, 0x83, 0x84, 0x7c,
+    0x6f, 0x74, 0x7c, 0x76, 0x7a, 0x83, 0x7f, 0x83, 0x84, 0x8d, 0x8c, 0x90, 0x8c, 0x8c, 0x8e, 0x88,
+    0x58, 0x5d, 0x62, 0x64, 0x66, 0x68, 0x66, 0x7f, 0x6f, 0x6c, 0x76, 0x67, 0x70, 0x7d, 0x77, 0x73,
+    0x59, 0x66, 0x5f, 0x68, 0x5a, 0x60, 0x63, 0x72, 0x82, 0xa9, 0xeb, 0xef, 0xee, 0xeb, 0xe5, 0xdf,
+    0xcc, 0xb9, 0xb1, 0xaf, 0xb1, 0xb1, 0xb3, 0xb5, 0xb6, 0xb7, 0xb9, 0xba, 0xbc, 0xbd, 0xbf, 0xbf,
+    0xc0, 0xc1, 0xc1, 0xc3, 0xc2, 0xc4, 0xc6, 0xcb, 0xd9, 0xdd, 0xe3, 0xe9, 0xf4, 0xfa, 0xf2, 0xe1,
+    0x97, 0x7e, 0x7b, 0x7c, 0x73, 0x78, 0x7a, 0x84, 0x83, 0x80, 0x7f, 0x7f, 0x81, 0x84, 0x84, 0x7b,
+    0x77, 0x7b, 0x84, 0x7c, 0x81, 0x82, 0x81, 0x88, 0x89, 0x87, 0x8f, 0x8b, 0x8a, 0x8a, 0x8d, 0x89,
+    0x59, 0x67, 0x72, 0x72, 0x6e, 0x6d, 0x74, 0x68, 0x70, 0x6e, 0x67, 0x77, 0x78, 0x6f, 0x73, 0x64,
+    0x56, 0x60, 0x6a, 0x58, 0x57, 0x6c, 0x66, 0x7c, 0xb8, 0xed, 0xee, 0xee, 0xe9, 0xe2, 0xd3, 0xc0,
+    0xb0, 0xab, 0xab, 0xad, 0xae, 0xaf, 0xb1, 0xb3, 0xb5, 0xb6, 0xb8, 0xbb, 0xbc, 0xbd, 0xbf, 0xc0,
+    0xc1, 0xc0, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4, 0xc7, 0xcc, 0xd4, 0xde, 0xe5, 0xec, 0xf8, 0xf3,
+    0xed, 0xb0, 0x81, 0x78, 0x76, 0x79, 0x86, 0x84, 0x7b, 0x79, 0x75, 0x78, 0x7c, 0x85, 0x80, 0x7d,
+    0x78, 0x7f, 0x81, 0x81, 0x7f, 0x7e, 0x83, 0x81, 0x87, 0x89, 0x80, 0x84, 0x7f, 0x82, 0x8b, 0x8e,
+    0x71, 0x76, 0x6f, 0x71, 0x6f, 0x66, 0x61, 0x72, 0x6e, 0x70, 0x80, 0x75, 0x74, 0x6c, 0x66, 0x5f,
+    0x6c, 0x6b, 0x5c, 0x5c, 0x6c, 0x74, 0x86, 0xbf, 0xed, 0xee, 0xed, 0xe7, 0xde, 0xcb, 0xb5, 0xab,
+    0xa8, 0xaa, 0xab, 0xad, 0xae, 0xb0, 0xb0, 0xb2, 0xb3, 0xb4, 0xb5, 0xb7, 0xba, 0xbd, 0xbe, 0xc0,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc5, 0xc8, 0xcf, 0xdb, 0xe8, 0xea, 0xf7,
+    0xf5, 0xef, 0xb5, 0x74, 0x76, 0x7e, 0x7f, 0x7c, 0x7e, 0x73, 0x71, 0x76, 0x7d, 0x84, 0x86, 0x81,
+    0x77, 0x7d, 0x7f, 0x83, 0x7e, 0x85, 0x82, 0x88, 0x82, 0x82, 0x7f, 0x78, 0x6e, 0x75, 0x7b, 0x83,
+    0x71, 0x77, 0x72, 0x73, 0x6b, 0x67, 0x79, 0x6c, 0x76, 0x7c, 0x6f, 0x6c, 0x68, 0x6c, 0x6b, 0x76,
+    0x66, 0x62, 0x62, 0x65, 0x78, 0x81, 0xba, 0xed, 0xee, 0xed, 0xe7, 0xdb, 0xc4, 0xae, 0xa6, 0xa5,
+    0xa6, 0xa7, 0xa9, 0xaa, 0xac, 0xad, 0xaf, 0xb1, 0xb3, 0xb5, 0xb6, 0xb7, 0xb9, 0xba, 0xbb, 0xbe,
+    0xc1, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xc5, 0xc7, 0xcb, 0xd5, 0xe0, 0xe8,
+    0xf4, 0xf7, 0xef, 0xba, 0x7a, 0x7c, 0x7e, 0x80, 0x7b, 0x72, 0x6f, 0x72, 0x7c, 0x82, 0x84, 0x7d,
+    0x7b, 0x7c, 0x7d, 0x86, 0x85, 0x7e, 0x88, 0x84, 0x85, 0x82, 0x82, 0x7d, 0x7c, 0x7b, 0x7b, 0x82,
+    0x70, 0x74, 0x71, 0x6c, 0x72, 0x75, 0x77, 0x80, 0x78, 0x6d, 0x67, 0x66, 0x6b, 0x70, 0x6f, 0x63,
+    0x5c, 0x68, 0x6c, 0x81, 0x84, 0xb2, 0xec, 0xee, 0xed, 0xe8, 0xdc, 0xc0, 0xa8, 0xa2, 0xa1, 0xa1,
+    0xa3, 0xa4, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xaa, 0xab, 0xae, 0xb0, 0xb3, 0xb7, 0xba, 0xba, 0xba,
+    0xbb, 0xbd, 0xc1, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xc5, 0xc5, 0xc4, 0xc5, 0xc8, 0xd1, 0xdf,
+    0xe7, 0xf1, 0xf6, 0xf0, 0xb1, 0x7c, 0x7b, 0x7d, 0x81, 0x77, 0x73, 0x7e, 0x7c, 0x80, 0x7d, 0x7b,
+    0x81, 0x7a, 0x81, 0x86, 0x8a, 0x8c, 0x83, 0x83, 0x81, 0x81, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x7d,
+    0x60, 0x6b, 0x6f, 0x7b, 0x77, 0x84, 0x86, 0x77, 0x6c, 0x5f, 0x66, 0x66, 0x71, 0x61, 0x59, 0x59,
+    0x6e, 0x6f, 0x8b, 0x7e, 0x90, 0xeb, 0xee, 0xed, 0xe9, 0xe0, 0xc4, 0xa7, 0x9e, 0x9e, 0x9d, 0xa0,
+    0xa0, 0x9f, 0xa0, 0xa0, 0xa0, 0xa1, 0xa2, 0xa5, 0xa6, 0xa8, 0xaa, 0xac, 0xad, 0xb1, 0xb5, 0xb9,
+    0xba, 0xba, 0xbb, 0xbe, 0xc3, 0xc4, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xd1,
+    0xdd, 0xe7, 0xf0, 0xf6, 0xef, 0x97, 0x78, 0x77, 0x7b, 0x78, 0x7b, 0x76, 0x7e, 0x83, 0x7e, 0x8b,
+    0x87, 0x87, 0x80, 0x8f, 0x8a, 0x89, 0x8c, 0x84, 0x7b, 0x7b, 0x7e, 0x7c, 0x72, 0x77, 0x77, 0x7e,
+    0x62, 0x74, 0x7e, 0x7e, 0x8a, 0x82, 0x7b, 0x6c, 0x5c, 0x67, 0x6c, 0x6e, 0x5e, 0x62, 0x5e, 0x64,
+    0x6f, 0x86, 0x79, 0x63, 0xc5, 0xee, 0xee, 0xeb, 0xe3, 0xcf, 0xae, 0x9e, 0x9b, 0x96, 0x98, 0x9a,
+    0x9a, 0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9d, 0x9e, 0xa0, 0xa4, 0xa8, 0xab, 0xac,
+    0xb0, 0xb6, 0xba, 0xbb, 0xbc, 0xc1, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc4, 0xc5, 0xc8,
+    0xd1, 0xdf, 0xe8, 0xf2, 0xf4, 0xe4, 0x87, 0x7f, 0x7a, 0x8e, 0xa0, 0x9a, 0x8f, 0x77, 0x87, 0x84,
+    0x89, 0x87, 0x92, 0x89, 0x8c, 0x8a, 0x8c, 0x82, 0x87, 0x82, 0x7b, 0x73, 0x70, 0x76, 0x7a, 0x76,
+    0x7a, 0x80, 0x85, 0x8a, 0x77, 0x6d, 0x64, 0x55, 0x5b, 0x6c, 0x60, 0x59, 0x59, 0x56, 0x57, 0x77,
+    0x79, 0x6a, 0x58, 0x83, 0xea, 0xee, 0xec, 0xe7, 0xd9, 0xba, 0xa1, 0x99, 0x97, 0x96, 0x98, 0x9a,
+    0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9f,
+    0xa4, 0xa9, 0xaf, 0xb6, 0xbb, 0xbb, 0xbf, 0xc4, 0xc5, 0xc6, 0xc5, 0xc5, 0xc5, 0xc4, 0xc4, 0xc4,
+    0xc9, 0xd4, 0xe1, 0xea, 0xf3, 0xf3, 0xc3, 0x83, 0x8c, 0x97, 0xac, 0xa6, 0xc4, 0xa1, 0x84, 0x8a,
+    0x84, 0x8a, 0x88, 0x8f, 0x8a, 0x8c, 0x7c, 0x82, 0x87, 0x7d, 0x7c, 0x7a, 0x77, 0x82, 0x78, 0x79,
+    0x7d, 0x85, 0x84, 0x74, 0x6c, 0x4f, 0x66, 0x74, 0x6e, 0x64, 0x56, 0x63, 0x50, 0x59, 0x73, 0x7b,
+    0x6e, 0x71, 0x99, 0xd2, 0xf0, 0xed, 0xea, 0xe3, 0xc9, 0xa9, 0x9b, 0x96, 0x98, 0x99, 0x99, 0x9a,
+    0x9a, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0x9b, 0x9f, 0xa7, 0xae, 0xb7, 0xbb, 0xbc, 0xc3, 0xc5, 0xc6, 0xc6, 0xc5, 0xc5, 0xc4, 0xc4,
+    0xc4, 0xca, 0xd7, 0xe4, 0xed, 0xf2, 0xf2, 0xad, 0xa5, 0xb1, 0xaa, 0xa8, 0x9a, 0xdb, 0x89, 0x89,
+    0x87, 0x81, 0x89, 0x86, 0x86, 0x85, 0x86, 0x91, 0x89, 0x80, 0x83, 0x7f, 0x81, 0x79, 0x73, 0x7c,
+    0x86, 0x7f, 0x7a, 0x6b, 0x56, 0x77, 0x7b, 0x70, 0x64, 0x5f, 0x59, 0x54, 0x5c, 0x67, 0x64, 0x6b,
+    0x95, 0x7d, 0x77, 0xe7, 0xee, 0xec, 0xe7, 0xd9, 0xb7, 0xa0, 0x98, 0x97, 0x99, 0x99, 0x9a, 0x9a,
+    0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x95, 0x94, 0x93, 0x94, 0x95, 0x95, 0x96,
+    0x97, 0x9a, 0x9b, 0x9c, 0x9d, 0xa4, 0xae, 0xb8, 0xbd, 0xc3, 0xc6, 0xc6, 0xc5, 0xc5, 0xc4, 0xc3,
+    0xc3, 0xc5, 0xce, 0xdd, 0xe9, 0xf0, 0xf4, 0xd8, 0xa6, 0xb6, 0xa2, 0xa8, 0x97, 0xaf, 0x89, 0x8a,
+    0x87, 0x84, 0x86, 0x88, 0x8c, 0x8d, 0x8c, 0x85, 0x87, 0x87, 0x87, 0x82, 0x7b, 0x76, 0x79, 0x7c,
+    0x79, 0x80, 0x69, 0x6b, 0x75, 0x7a, 0x69, 0x58, 0x58, 0x5f, 0x60, 0x66, 0x5a, 0x58, 0x6e, 0x72,
+    0x5d, 0x58, 0xa8, 0xec, 0xed, 0xeb, 0xe4, 0xc9, 0xa8, 0x9b, 0x96, 0x97, 0x99, 0x9a, 0x99, 0x97,
+    0x96, 0x96, 0x95, 0x95, 0x94, 0x92, 0x8e, 0x8e, 0x91, 0x8f, 0x8f, 0x8f, 0x90, 0x92, 0x92, 0x93,
+    0x95, 0x96, 0x98, 0x99, 0x9a, 0x9c, 0x9d, 0xa2, 0xae, 0xba, 0xc0, 0xc5, 0xc5, 0xc5, 0xc4, 0xc3,
+    0xc2, 0xc2, 0xc6, 0xd2, 0xe3, 0xed, 0xef, 0xf4, 0xbb, 0xbb, 0xb4, 0xb4, 0xb4, 0xa6, 0x8b, 0x88,
+    0x85, 0x86, 0x8d, 0x90, 0x8a, 0x87, 0x7f, 0x84, 0x85, 0x86, 0x80, 0x75, 0x73, 0x7c, 0x7b, 0x76,
+    0x70, 0x59, 0x66, 0x61, 0x61, 0x5d, 0x65, 0x5b, 0x5d, 0x78, 0x66, 0x58, 0x65, 0x66, 0x58, 0x56,
+    0x54, 0x54, 0xd6, 0xee, 0xed, 0xe9, 0xde, 0xb9, 0xa0, 0x99, 0x96, 0x97, 0x99, 0x98, 0x97, 0x96,
+    0x95, 0x94, 0x93, 0x92, 0x8f, 0x8b, 0x8c, 0x8c, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x8a, 0x8d,
+    0x8f, 0x92, 0x93, 0x97, 0x98, 0x9a, 0x9b, 0x9c, 0x9e, 0xa3, 0xb3, 0xbe, 0xc4, 0xc4, 0xc4, 0xc3,
+    0xc2, 0xc1, 0xc2, 0xca, 0xdd, 0xea, 0xef, 0xf5, 0xd9, 0xb4, 0xbc, 0xb7, 0xb4, 0x91, 0x8b, 0x87,
+    0x8a, 0x8a, 0x91, 0x86, 0x84, 0x81, 0x83, 0x85, 0x86, 0x80, 0x78, 0x74, 0x78, 0x7c, 0x7a, 0x73,
+    0x58, 0x50, 0x58, 0x5b, 0x5a, 0x5a, 0x62, 0x55, 0x81, 0x5f, 0x5c, 0x6b, 0x5f, 0x59, 0x55, 0x53,
+    0x51, 0x67, 0xe5, 0xee, 0xed, 0xe8, 0xd6, 0xaf, 0x9c, 0x98, 0x96, 0x97, 0x98, 0x97, 0x94, 0x94,
+    0x93, 0x92, 0x8f, 0x8b, 0x89, 0x8a, 0x87, 0x84, 0x84, 0x84, 0x7f, 0x7e, 0x7c, 0x7c, 0x81, 0x82,
+    0x86, 0x89, 0x8c, 0x91, 0x94, 0x97, 0x99, 0x9b, 0x9c, 0x9d, 0x9e, 0xa9, 0xbb, 0xc4, 0xc4, 0xc3,
+    0xc2, 0xc0, 0xc0, 0xc5, 0xd6, 0xe7, 0xee, 0xf3, 0xef, 0xb5, 0xc2, 0xbc, 0xaa, 0x7f, 0x7e, 0x88,
+    0x8f, 0x88, 0x88, 0x85, 0x86, 0x82, 0x83, 0x7f, 0x7f, 0x7a, 0x77, 0x73, 0x76, 0x77, 0x78, 0x76,
+    0x51, 0x4f, 0x5f, 0x4e, 0x53, 0x57, 0x5f, 0x70, 0x5b, 0x5c, 0x6c, 0x5f, 0x56, 0x53, 0x51, 0x50,
+    0x51, 0x7e, 0xe9, 0xed, 0xec, 0xe7, 0xcf, 0xa7, 0x9a, 0x97, 0x96, 0x97, 0x98, 0x95, 0x93, 0x92,
+    0x91, 0x8c, 0x82, 0x85, 0x85, 0x73, 0x72, 0x68, 0x66, 0x66, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63,
+    0x6b, 0x6c, 0x73, 0x7e, 0x8a, 0x91, 0x95, 0x97, 0x99, 0x9b, 0x9d, 0x9e, 0xa3, 0xb8, 0xc4, 0xc3,
+    0xc2, 0xc1, 0xbf, 0xc1, 0xcf, 0xe4, 0xed, 0xf1, 0xf6, 0xc1, 0xc5, 0xb5, 0x9c, 0x7d, 0x82, 0x8e,
+    0x8c, 0x8b, 0x8a, 0x84, 0x85, 0x85, 0x80, 0x7d, 0x7a, 0x7a, 0x74, 0x72, 0x70, 0x72, 0x73, 0x75,
+    0x51, 0x5b, 0x65, 0x4a, 0x5b, 0x5d, 0x66, 0x57, 0x5a, 0x63, 0x5c, 0x56, 0x52, 0x52, 0x51, 0x50,
+    0x51, 0x8a, 0xee, 0xed, 0xed, 0xe6, 0xc8, 0xa1, 0x99, 0x97, 0x96, 0x96, 0x96, 0x93, 0x92, 0x8f,
+    0x7f, 0x70, 0x6e, 0x62, 0x5f, 0x58, 0x56, 0x54, 0x50, 0x51, 0x50, 0x4f, 0x50, 0x53, 0x53, 0x54,
+    0x58, 0x5c, 0x61, 0x67, 0x6b, 0x76, 0x85, 0x92, 0x97, 0x99, 0x9b, 0x9c, 0x9e, 0xa0, 0xb7, 0xc2,
+    0xc2, 0xc1, 0xbe, 0xbf, 0xca, 0xe0, 0xec, 0xf0, 0xf5, 0xd2, 0xc9, 0xbc, 0x8a, 0x81, 0x89, 0x88,
+    0x82, 0x80, 0x85, 0x8b, 0x8a, 0x87, 0x82, 0x7c, 0x7b, 0x74, 0x72, 0x79, 0x75, 0x70, 0x75, 0x81,
+    0x53, 0x74, 0x5b, 0x5e, 0x63, 0x64, 0x56, 0x5f, 0x5c, 0x5b, 0x5c, 0x53, 0x52, 0x51, 0x51, 0x50,
+    0x50, 0x90, 0xeb, 0xee, 0xf0, 0xe6, 0xc2, 0x9e, 0x98, 0x96, 0x96, 0x96, 0x93, 0x91, 0x7b, 0x6e,
+    0x64, 0x5e, 0x5b, 0x53, 0x4e, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x46, 0x47, 0x48, 0x4a, 0x4c, 0x4c,
+    0x50, 0x52, 0x56, 0x5b, 0x60, 0x64, 0x69, 0x74, 0x8b, 0x96, 0x99, 0x9a, 0x9c, 0x9d, 0xa2, 0xba,
+    0xc2, 0xc0, 0xbe, 0xbc, 0xc6, 0xdd, 0xeb, 0xef, 0xf2, 0xd1, 0xce, 0xbc, 0x7b, 0x8b, 0x86, 0x7f,
+    0x7c, 0x7c, 0x7d, 0x87, 0x92, 0x8b, 0x84, 0x81, 0x7c, 0x77, 0x77, 0x71, 0x6b, 0x70, 0x82, 0x86,
+    0x63, 0x58, 0x59, 0x6e, 0x69, 0x55, 0x58, 0x5f, 0x57, 0x5b, 0x57, 0x51, 0x51, 0x51, 0x51, 0x52,
+    0x51, 0x90, 0xea, 0xed, 0xf5, 0xe7, 0xbf, 0x9e, 0x97, 0x95, 0x95, 0x91, 0x8f, 0x81, 0x5a, 0x5c,
+    0x5c, 0x54, 0x4c, 0x4b, 0x49, 0x47, 0x43, 0x42, 0x42, 0x40, 0x43, 0x42, 0x42, 0x41, 0x41, 0x42,
+    0x44, 0x48, 0x4f, 0x53, 0x56, 0x59, 0x60, 0x64, 0x6d, 0x7f, 0x92, 0x97, 0x9a, 0x9b, 0x9d, 0xa3,
+    0xb9, 0xbf, 0xbd, 0xba, 0xc1, 0xd9, 0xea, 0xef, 0xf0, 0xdb, 0xcb, 0xa9, 0xa4, 0x82, 0x79, 0x6e,
+    0x7a, 0x7a, 0x7f, 0x8a, 0x88, 0x84, 0x81, 0x7e, 0x7c, 0x78, 0x72, 0x6f, 0x77, 0x7d, 0x7c, 0x88,
+    0x52, 0x61, 0x71, 0x66, 0x51, 0x5c, 0x5d, 0x5a, 0x54, 0x51, 0x50, 0x57, 0x55, 0x52, 0x51, 0x51,
+    0x51, 0x86, 0xe9, 0xed, 0xf6, 0xeb, 0xbf, 0x9b, 0x97, 0x94, 0x91, 0x8e, 0x84, 0x64, 0x5b, 0x57,
+    0x53, 0x4c, 0x4a, 0x4e, 0x4b, 0x49, 0x49, 0x4f, 0x56, 0x6a, 0x71, 0x79, 0x78, 0x74, 0x66, 0x54,
+    0x4c, 0x4b, 0x47, 0x49, 0x4f, 0x55, 0x57, 0x5d, 0x62, 0x69, 0x76, 0x8e, 0x97, 0x99, 0x9b, 0x9d,
+    0xa6, 0xb9, 0xbd, 0xb9, 0xbe, 0xd7, 0xec, 0xef, 0xf0, 0xe1, 0xb4, 0x69, 0xbc, 0xb4, 0x85, 0x75,
+    0x73, 0x78, 0x82, 0x83, 0x7f, 0x83, 0x81, 0x7b, 0x7b, 0x7a, 0x79, 0x7b, 0x81, 0x80, 0x8f, 0x87,
+    0x6b, 0x75, 0x6b, 0x51, 0x56, 0x58, 0x56, 0x54, 0x51, 0x4f, 0x52, 0x58, 0x5a, 0x53, 0x51, 0x51,
+    0x51, 0x75, 0xe7, 0xed, 0xf4, 0xea, 0xc3, 0x9a, 0x97, 0x92, 0x8f, 0x88, 0x62, 0x5e, 0x55, 0x54,
+    0x5b, 0x4d, 0x4b, 0x4a, 0x50, 0x5d, 0x79, 0x8a, 0x85, 0x7e, 0x7a, 0x75, 0x79, 0x77, 0x84, 0xa1,
+    0xb1, 0x93, 0x6d, 0x53, 0x50, 0x50, 0x54, 0x57, 0x5c, 0x62, 0x68, 0x74, 0x8e, 0x97, 0x99, 0x9b,
+    0x9e, 0xad, 0xb9, 0xb8, 0xbb, 0xd6, 0xea, 0xf0, 0xef, 0xe1, 0xad, 0x42, 0x60, 0xb8, 0xb0, 0x8b,
+    0x77, 0x79, 0x82, 0x7d, 0x7f, 0x83, 0x7d, 0x7b, 0x7a, 0x7d, 0x81, 0x81, 0x81, 0x88, 0x88, 0x83,
+    0x78, 0x78, 0x56, 0x5c, 0x57, 0x54, 0x52, 0x50, 0x4f, 0x4f, 0x51, 0x52, 0x57, 0x58, 0x52, 0x51,
+    0x4f, 0x56, 0xe0, 0xed, 0xf1, 0xef, 0xcb, 0x9a, 0x95, 0x91, 0x8c, 0x71, 0x5f, 0x57, 0x54, 0x56,
+    0x51, 0x4c, 0x51, 0x5a, 0x6f, 0x7a, 0x6d, 0x70, 0x75, 0x77, 0x79, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a,
+    0x79, 0x90, 0xb0, 0xab, 0x78, 0x5a, 0x56, 0x57, 0x5a, 0x5f, 0x64, 0x6a, 0x76, 0x90, 0x97, 0x9a,
+    0x9c, 0xa2, 0xb2, 0xb6, 0xb8, 0xd7, 0xeb, 0xf0, 0xee, 0xde, 0x7f, 0x44, 0x54, 0x5d, 0xb2, 0xa6,
+    0x8a, 0x77, 0x7b, 0x7a, 0x7f, 0x7d, 0x79, 0x83, 0x82, 0x80, 0x85, 0x86, 0x87, 0x8a, 0x86, 0x82,
+    0x7d, 0x59, 0x52, 0x60, 0x54, 0x52, 0x50, 0x4d, 0x4d, 0x4e, 0x50, 0x50, 0x51, 0x57, 0x5e, 0x55,
+    0x50, 0x43, 0xc8, 0xec, 0xef, 0xf3, 0xd8, 0x9a, 0x94, 0x8f, 0x7f, 0x5d, 0x55, 0x55, 0x56, 0x55,
+    0x4f, 0x58, 0x66, 0x70, 0x74, 0x7b, 0x7f, 0x81, 0x85, 0x85, 0x87, 0x88, 0x87, 0x88, 0x89, 0x87,
+    0x86, 0x86, 0x83, 0x90, 0xbb, 0xa8, 0x6e, 0x5e, 0x5c, 0x5e, 0x62, 0x66, 0x6c, 0x7e, 0x94, 0x99,
+    0x9b, 0x9d, 0xaa, 0xb3, 0xb8, 0xdb, 0xec, 0xef, 0xed, 0xcf, 0x5d, 0x48, 0x4c, 0x55, 0x5f, 0xbb,
+    0x99, 0x87, 0x79, 0x7b, 0x77, 0x77, 0x72, 0x79, 0x81, 0x81, 0x84, 0x84, 0x84, 0x89, 0x8c, 0x82,
+    0x71, 0x51, 0x5c, 0x54, 0x52, 0x4f, 0x4e, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x4e, 0x50, 0x6a, 0x76,
+    0x52, 0x42, 0x9a, 0xea, 0xee, 0xf4, 0xe6, 0xa3, 0x92, 0x8e, 0x6a, 0x5b, 0x56, 0x59, 0x56, 0x57,
+    0x64, 0x74, 0x7c, 0x7f, 0x82, 0x85, 0x88, 0x8a, 0x8c, 0x8e, 0x8f, 0x90, 0x90, 0x91, 0x90, 0x8f,
+    0x91, 0x8f, 0x8c, 0x89, 0x8a, 0xa4, 0xc0, 0x86, 0x68, 0x63, 0x63, 0x66, 0x6a, 0x71, 0x8b, 0x97,
+    0x99, 0x9c, 0xa2, 0xaf, 0xb8, 0xe0, 0xed, 0xef, 0xec, 0xb5, 0x4a, 0x4b, 0x4c, 0x4d, 0x57, 0x61,
+    0xbd, 0x8d, 0x89, 0x74, 0x74, 0x70, 0x74, 0x7c, 0x7f, 0x83, 0x84, 0x82, 0x88, 0x8a, 0x8b, 0x82,
+    0x67, 0x59, 0x57, 0x52, 0x50, 0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x55, 0x5e,
+    0x51, 0x43, 0x5f, 0xe2, 0xed, 0xf1, 0xed, 0xbd, 0x92, 0x7e, 0x65, 0x5d, 0x5e, 0x59, 0x63, 0x71,
+    0x7d, 0x83, 0x86, 0x88, 0x8c, 0x8e, 0x90, 0x93, 0x95, 0x96, 0x97, 0x98, 0x98, 0x98, 0x99, 0x9a,
+    0x98, 0x97, 0x95, 0x93, 0x91, 0x8f, 0x9a, 0xbc, 0x94, 0x77, 0x6f, 0x6c, 0x6e, 0x6e, 0x7b, 0x95,
+    0x98, 0x9b, 0x9d, 0xaa, 0xbb, 0xe7, 0xf0, 0xf0, 0xea, 0x94, 0x3b, 0x4e, 0x52, 0x4f, 0x51, 0x57,
+    0x73, 0xbe, 0x97, 0x81, 0x72, 0x75, 0x6d, 0x76, 0x83, 0x7e, 0x83, 0x8b, 0x8c, 0x84, 0x7f, 0x85,
+    0x57, 0x60, 0x52, 0x50, 0x4d, 0x4c, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x50, 0x4f, 0x4e, 0x4e,
+    0x4f, 0x3e, 0x41, 0xba, 0xeb, 0xee, 0xf0, 0xdf, 0x98, 0x6d, 0x60, 0x62, 0x60, 0x70, 0x7c, 0x84,
+    0x89, 0x8c, 0x8d, 0x91, 0x94, 0x96, 0x98, 0x99, 0x9c, 0x9d, 0x9e, 0x9e, 0x9f, 0x9e, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9c, 0x9b, 0x99, 0x96, 0x94, 0x9a, 0xc1, 0x8c, 0x81, 0x7a, 0x78, 0x77, 0x75, 0x8e,
+    0x98, 0x9b, 0x9c, 0xa7, 0xc7, 0xeb, 0xef, 0xef, 0xe4, 0x60, 0x39, 0x50, 0x51, 0x52, 0x52, 0x55,
+    0x59, 0x82, 0xb1, 0x9d, 0x77, 0x6a, 0x6c, 0x7e, 0x7d, 0x88, 0x89, 0x89, 0x81, 0x7f, 0x84, 0x88,
+    0x5b, 0x56, 0x52, 0x55, 0x4e, 0x4c, 0x4b, 0x4c, 0x4c, 0x4d, 0x4d, 0x4e, 0x4e, 0x4f, 0x4e, 0x4e,
+    0x4e, 0x3f, 0x4f, 0x6d, 0xe5, 0xee, 0xef, 0xec, 0xb7, 0x68, 0x66, 0x69, 0x75, 0x82, 0x87, 0x8d,
+    0x8f, 0x93, 0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa2, 0x9f, 0xa0, 0xa1,
+    0xa2, 0xa0, 0x9f, 0x9f, 0x9f, 0x9d, 0x9a, 0x98, 0xa9, 0xaf, 0x89, 0x84, 0x83, 0x81, 0x7a, 0x85,
+    0x99, 0x9b, 0x9c, 0xa6, 0xd9, 0xed, 0xf0, 0xec, 0xc9, 0x3a, 0x40, 0x4f, 0x51, 0x52, 0x55, 0x55,
+    0x56, 0x59, 0xa5, 0x91, 0x9e, 0x6c, 0x7f, 0x82, 0x86, 0x81, 0x82, 0x80, 0x78, 0x82, 0x89, 0x8a,
+    0x5a, 0x51, 0x66, 0x80, 0x4f, 0x4c, 0x4b, 0x4b, 0x4c, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e,
+    0x4f, 0x40, 0x4e, 0x36, 0xc5, 0xeb, 0xed, 0xee, 0xe2, 0x84, 0x72, 0x75, 0x85, 0x8b, 0x8e, 0x91,
+    0x96, 0x98, 0x9a, 0x9c, 0x9f, 0xa1, 0xa1, 0xa3, 0xa5, 0xa4, 0xa3, 0xa2, 0xa1, 0xa1, 0xa3, 0xa1,
+    0xa2, 0xa3, 0xa0, 0xa2, 0xa1, 0xa0, 0x9e, 0x9c, 0x9d, 0xba, 0x98, 0x8b, 0x88, 0x8a, 0x83, 0x7e,
+    0x98, 0x9c, 0x9c, 0xb3, 0xe7, 0xee, 0xef, 0xe7, 0x80, 0x38, 0x46, 0x4f, 0x50, 0x53, 0x55, 0x54,
+    0x55, 0x58, 0x60, 0xb3, 0x94, 0x89, 0x7b, 0x85, 0x8a, 0x82, 0x7b, 0x78, 0x82, 0x81, 0x82, 0x83,
+    0x56, 0x50, 0x5b, 0x6a, 0x52, 0x4d, 0x4b, 0x4c, 0x4c, 0x4c, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e,
+    0x4f, 0x43, 0x45, 0x3f, 0x73, 0xe5, 0xef, 0xed, 0xed, 0xcc, 0x81, 0x85, 0x8f, 0x93, 0x94, 0x97,
+    0x9a, 0x9d, 0xa0, 0xa2, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa2, 0xa4, 0xa1, 0xa2, 0xa2, 0xa1,
+    0xa2, 0xa4, 0xa2, 0xa4, 0xa3, 0xa2, 0xa1, 0xa0, 0x9d, 0xa7, 0xa4, 0x94, 0x90, 0x8e, 0x8d, 0x7f,
+    0x93, 0x9d, 0x9e, 0xd3, 0xec, 0xf0, 0xec, 0xd3, 0x47, 0x36, 0x48, 0x4f, 0x52, 0x55, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x7a, 0xa0, 0xa6, 0x83, 0x88, 0x8d, 0x7c, 0x7b, 0x7f, 0x84, 0x83, 0x7d, 0x86,
+    0x52, 0x50, 0x4d, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4f, 0x46, 0x34, 0x5d, 0x34, 0xba, 0xea, 0xf0, 0xed, 0xeb, 0xb2, 0x91, 0x96, 0x97, 0x9b, 0x9d,
+    0xa0, 0xa1, 0xa3, 0xa4, 0xa4, 0xa5, 0xa6, 0xa4, 0xa5, 0xa5, 0xa4, 0xa3, 0xa3, 0xa1, 0xa1, 0xa3,
+    0xa4, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa1, 0xa2, 0xa0, 0xa2, 0xa5, 0x9b, 0x95, 0x92, 0x93, 0x85,
+    0x90, 0x9e, 0xb8, 0xe9, 0xee, 0xee, 0xe5, 0x88, 0x3d, 0x35, 0x4a, 0x51, 0x53, 0x53, 0x54, 0x55,
+    0x54, 0x54, 0x57, 0x56, 0x9f, 0x90, 0x95, 0x81, 0x83, 0x83, 0x83, 0x85, 0x7e, 0x7e, 0x88, 0x8b,
+    0x51, 0x4d, 0x4c, 0x4b, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d,
+    0x4e, 0x49, 0x36, 0x55, 0x42, 0x47, 0xc8, 0xec, 0xf2, 0xed, 0xe7, 0xb6, 0x9c, 0x9e, 0xa0, 0xa3,
+    0xa4, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa4, 0xa3, 0xa2,
+    0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa2, 0xa3, 0xa4, 0xa4, 0xa5, 0xa6, 0xa0, 0x9d, 0x98, 0x99, 0x8b,
+    0x8c, 0xb1, 0xe4, 0xed, 0xee, 0xe8, 0xbc, 0x3b, 0x39, 0x3b, 0x4c, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x54, 0x55, 0x55, 0x63, 0x97, 0xad, 0x7f, 0x7b, 0x87, 0x8a, 0x87, 0x7e, 0x83, 0x8e, 0x8a,
+    0x4e, 0x4c, 0x4b, 0x4b, 0x4b, 0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0x4f,
+    0x4e, 0x4d, 0x38, 0x35, 0x62, 0x2c, 0x4f, 0xcf, 0xee, 0xf5, 0xee, 0xe9, 0xc3, 0xa4, 0xa4, 0xa5,
+    0xa5, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa2, 0xa3, 0xa0, 0xa0, 0xa2, 0xa4, 0xa3, 0xa0, 0xa8,
+    0xa3, 0xab, 0xa4, 0xa2, 0xa3, 0xa2, 0xa3, 0xa5, 0xa6, 0xa8, 0xaa, 0xa5, 0xa4, 0x9c, 0x9c, 0x96,
+    0xa3, 0xe4, 0xed, 0xef, 0xea, 0xd6, 0x4b, 0x3f, 0x34, 0x42, 0x4f, 0x53, 0x52, 0x53, 0x53, 0x54,
+    0x53, 0x52, 0x53, 0x55, 0x55, 0x7e, 0xab, 0x87, 0x85, 0x8a, 0x8f, 0x8d, 0x82, 0x89, 0x96, 0x87,
+    0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4c, 0x4e, 0x4e, 0x4d, 0x4d, 0x4e, 0x50, 0x4e,
+    0x4f, 0x4e, 0x3b, 0x33, 0x65, 0x2e, 0x2c, 0x5d, 0xd2, 0xef, 0xf5, 0xed, 0xed, 0xcf, 0xaa, 0xa5,
+    0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa4, 0xa3, 0xa1, 0xa2, 0xa3, 0xa2, 0xa2, 0xa3, 0xa1,
+    0xa2, 0xa2, 0xa6, 0xa7, 0xa7, 0xa7, 0xa5, 0xa8, 0xa9, 0xa9, 0xac, 0xa9, 0xa7, 0xa2, 0xa1, 0xb1,
+    0xe4, 0xf0, 0xef, 0xec, 0xde, 0x6c, 0x44, 0x3b, 0x31, 0x46, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53,
+    0x53, 0x54, 0x54, 0x55, 0x56, 0x5c, 0x8b, 0xaf, 0x8a, 0x88, 0x89, 0x8b, 0x84, 0x85, 0x8d, 0x82,
+    0x4c, 0x4b, 0x4a, 0x4c, 0x4b, 0x4c, 0x4b, 0x4c, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4f, 0x50, 0x42, 0x32, 0x3f, 0x60, 0x2a, 0x2c, 0x5d, 0xcf, 0xf0, 0xf8, 0xef, 0xed, 0xdd, 0xb6,
+    0xa5, 0xa6, 0xa5, 0xa4, 0xa4, 0xa4, 0xa3, 0xa2, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa1, 0xa2,
+    0xa0, 0xa1, 0xa1, 0xa3, 0xa6, 0xa9, 0xad, 0xae, 0xae, 0xad, 0xad, 0xa9, 0xa8, 0xa5, 0xb8, 0xe7,
+    0xf0, 0xef, 0xec, 0xe3, 0x8b, 0x34, 0x62, 0x36, 0x34, 0x49, 0x51, 0x51, 0x52, 0x52, 0x53, 0x52,
+    0x52, 0x52, 0x53, 0x54, 0x59, 0x58, 0x70, 0xae, 0x86, 0x88, 0x89, 0x8f, 0x88, 0x80, 0x7b, 0x8a,
+    0x4b, 0x4b, 0x4a, 0x4a, 0x4b, 0x56, 0x62, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4c, 0x4f, 0x4f, 0x51,
+    0x51, 0x50, 0x4a, 0x34, 0x31, 0x65, 0x38, 0x2a, 0x2d, 0x53, 0xc9, 0xee, 0xfa, 0xf3, 0xed, 0xec,
+    0xc9, 0xac, 0xa8, 0xa8, 0xa7, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa2, 0xa3,
+    0xa2, 0xa3, 0xa0, 0xa6, 0xa8, 0xaa, 0xa7, 0xb0, 0xae, 0xae, 0xa8, 0xaa, 0xac, 0xc7, 0xe9, 0xee,
+    0xee, 0xeb, 0xe2, 0xa0, 0x25, 0x72, 0x42, 0x2e, 0x3c, 0x49, 0x4e, 0x4f, 0x50, 0x51, 0x51, 0x50,
+    0x51, 0x51, 0x54, 0x56, 0x57, 0x59, 0x69, 0x81, 0x91, 0x89, 0x8a, 0x82, 0x7f, 0x7b, 0x87, 0x87,
+    0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4e, 0x4d, 0x4d, 0x4e, 0x4f, 0x50, 0x54,
+    0x51, 0x52, 0x53, 0x38, 0x31, 0x34, 0x5c, 0x2d, 0x2a, 0x2d, 0x60, 0xcc, 0xe6, 0xf8, 0xf9, 0xf1,
+    0xee, 0xde, 0xc0, 0xae, 0xaa, 0xa9, 0xa8, 0xa7, 0xa6, 0xa3, 0xa4, 0xa3, 0xa4, 0xa2, 0xa4, 0xa5,
+    0xa5, 0xa5, 0xa4, 0xa6, 0xa7, 0xa5, 0xa7, 0xa6, 0xa9, 0xa9, 0xaa, 0xbc, 0xdc, 0xec, 0xee, 0xed,
+    0xea, 0xdd, 0x94, 0x26, 0x36, 0x6b, 0x36, 0x28, 0x40, 0x49, 0x4f, 0x4e, 0x4f, 0x4f, 0x50, 0x50,
+    0x50, 0x54, 0x54, 0x56, 0x56, 0x58, 0x5c, 0x6d, 0x9a, 0x8a, 0x81, 0x7a, 0x7e, 0x7d, 0x80, 0x7a,
+    0x4a, 0x4b, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4f, 0x53, 0x57, 0x5b,
+    0x51, 0x52, 0x58, 0x43, 0x33, 0x31, 0x44, 0x5a, 0x2d, 0x29, 0x2e, 0x41, 0x82, 0xcc, 0xeb, 0xf7,
+    0xf8, 0xf2, 0xed, 0xe3, 0xd1, 0xbd, 0xaf, 0xac, 0xa8, 0xa7, 0xa4, 0xa4, 0xa6, 0xa4, 0xa6, 0xa2,
+    0xa5, 0xa5, 0xa6, 0xab, 0xa6, 0xa3, 0xab, 0xa8, 0xb2, 0xc7, 0xde, 0xec, 0xee, 0xee, 0xea, 0xe3,
+    0xc0, 0x5f, 0x1e, 0x24, 0x64, 0x3e, 0x2e, 0x2c, 0x45, 0x4b, 0x4f, 0x4e, 0x50, 0x50, 0x50, 0x52,
+    0x53, 0x54, 0x54, 0x55, 0x56, 0x59, 0x59, 0x67, 0x83, 0x79, 0x7a, 0x78, 0x7b, 0x79, 0x74, 0x77,
+    0x4b, 0x4b, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4d, 0x4d, 0x4e, 0x52, 0x5d, 0x6d, 0x64,
+    0x52, 0x5c, 0x59, 0x51, 0x37, 0x34, 0x3b, 0x59, 0x54, 0x2a, 0x28, 0x29, 0x2d, 0x3e, 0x8b, 0xd1,
+    0xeb, 0xf8, 0xfb, 0xf5, 0xf2, 0xf2, 0xe6, 0xd4, 0xc3, 0xb4, 0xad, 0xa9, 0xa7, 0xa6, 0xa8, 0xa4,
+    0xa9, 0xa9, 0xa9, 0xaa, 0xaf, 0xb5, 0xc7, 0xdd, 0xea, 0xee, 0xef, 0xef, 0xec, 0xe6, 0xd8, 0x85,
+    0x28, 0x1a, 0x1f, 0x48, 0x60, 0x37, 0x23, 0x35, 0x47, 0x4d, 0x4f, 0x4f, 0x4f, 0x50, 0x52, 0x53,
+    0x53, 0x54, 0x53, 0x55, 0x55, 0x57, 0x59, 0x61, 0x6b, 0x7c, 0x7d, 0x76, 0x76, 0x71, 0x74, 0x75,
+    0x4b, 0x4a, 0x4a, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4c, 0x4e, 0x4f, 0x53, 0x5f, 0x7c, 0x91, 0x68,
+    0x52, 0x5b, 0x5d, 0x5c, 0x40, 0x3c, 0x39, 0x4f, 0x62, 0x45, 0x2a, 0x28, 0x2a, 0x2b, 0x2d, 0x4a,
+    0xac, 0xdb, 0xe9, 0xf5, 0xfb, 0xfa, 0xf5, 0xf0, 0xed, 0xea, 0xe6, 0xe0, 0xda, 0xd3, 0xcd, 0xcc,
+    0xce, 0xd1, 0xd8, 0xe1, 0xe8, 0xec, 0xf0, 0xf2, 0xf1, 0xf0, 0xec, 0xe6, 0xd7, 0xa5, 0x48, 0x1b,
+    0x1b, 0x1c, 0x41, 0x74, 0x43, 0x42, 0x21, 0x3e, 0x4a, 0x50, 0x4e, 0x4e, 0x50, 0x50, 0x52, 0x51,
+    0x52, 0x53, 0x52, 0x53, 0x54, 0x55, 0x58, 0x5b, 0x65, 0x77, 0x74, 0x76, 0x71, 0x6b, 0x71, 0x74,
+    0x4b, 0x4b, 0x4a, 0x4b, 0x4b, 0x4c, 0x4b, 0x4d, 0x4d, 0x4f, 0x55, 0x6b, 0x83, 0x88, 0x9b, 0x5f,
+    0x54, 0x55, 0x58, 0x57, 0x56, 0x34, 0x3c, 0x42, 0x54, 0x5f, 0x38, 0x2a, 0x2a, 0x29, 0x29, 0x2b,
+    0x40, 0x5d, 0x88, 0xc2, 0xde, 0xed, 0xf6, 0xfc, 0xfc, 0xf8, 0xf6, 0xf4, 0xf3, 0xf2, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf1, 0xf3, 0xf4, 0xf5, 0xf4, 0xf0, 0xe8, 0xde, 0xc9, 0x8c, 0x47, 0x1e, 0x1b, 0x1a,
+    0x1b, 0x3a, 0x73, 0x5d, 0x3d, 0x5a, 0x29, 0x43, 0x4b, 0x4f, 0x4d, 0x4f, 0x52, 0x52, 0x52, 0x53,
+    0x52, 0x52, 0x54, 0x53, 0x55, 0x54, 0x57, 0x5a, 0x65, 0x6f, 0x6f, 0x72, 0x72, 0x6e, 0x70, 0x74,
+    0x4b, 0x4b, 0x4a, 0x4b, 0x4b, 0x4c, 0x4b, 0x4d, 0x4f, 0x57, 0x6a, 0x85, 0x7f, 0x67, 0x87, 0x54,
+    0x54, 0x5b, 0x58, 0x55, 0x56, 0x50, 0x33, 0x3d, 0x4c, 0x54, 0x53, 0x34, 0x38, 0x2a, 0x29, 0x29,
+    0x29, 0x2d, 0x35, 0x3d, 0x82, 0xaa, 0xbd, 0xd6, 0xe3, 0xea, 0xee, 0xf2, 0xf4, 0xf6, 0xf6, 0xf6,
+    0xf5, 0xf4, 0xf1, 0xee, 0xea, 0xe3, 0xda, 0xc8, 0x9c, 0x5e, 0x2c, 0x1c, 0x1c, 0x1c, 0x19, 0x1b,
+    0x44, 0x7f, 0x6f, 0x40, 0x8e, 0x37, 0x31, 0x47, 0x4c, 0x50, 0x4e, 0x51, 0x52, 0x51, 0x53, 0x52,
+    0x52, 0x53, 0x53, 0x53, 0x54, 0x54, 0x56, 0x5c, 0x63, 0x6a, 0x67, 0x70, 0x72, 0x6b, 0x6b, 0x74,
+    0x4c, 0x4c, 0x4b, 0x4b, 0x4c, 0x4c, 0x4d, 0x4e, 0x57, 0x6b, 0x85, 0x7d, 0x61, 0x51, 0x6e, 0x50,
+    0x52, 0x54, 0x4f, 0x52, 0x4a, 0x74, 0x38, 0x31, 0x3e, 0x4f, 0x52, 0x4d, 0x39, 0x2d, 0x2a, 0x28,
+    0x28, 0x28, 0x29, 0x2b, 0x3b, 0x39, 0x33, 0x46, 0x63, 0x81, 0x9a, 0xae, 0xbf, 0xc8, 0xcc, 0xce,
+    0xcc, 0xc7, 0xbd, 0xa9, 0x8d, 0x6f, 0x4c, 0x2e, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x4a,
+    0x78, 0x72, 0x53, 0x3f, 0xd3, 0x21, 0x3a, 0x4a, 0x4e, 0x4f, 0x4e, 0x51, 0x52, 0x52, 0x53, 0x52,
+    0x52, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x5b, 0x62, 0x6c, 0x68, 0x74, 0x73, 0x72, 0x77, 0x76,
+    0x4c, 0x4b, 0x4b, 0x4b, 0x4c, 0x4c, 0x4d, 0x55, 0x69, 0x7e, 0x77, 0x5e, 0x50, 0x51, 0x58, 0x51,
+    0x50, 0x50, 0x4c, 0x4a, 0x45, 0x42, 0x73, 0x32, 0x2c, 0x33, 0x45, 0x50, 0x50, 0x43, 0x2e, 0x2a,
+    0x27, 0x26, 0x27, 0x27, 0x27, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x34, 0x31, 0x30,
+    0x30, 0x2a, 0x24, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1b, 0x1a, 0x1c, 0x1b, 0x2b, 0x62, 0x77,
+    0x70, 0x5f, 0x35, 0x94, 0xb2, 0x27, 0x42, 0x4b, 0x4e, 0x4f, 0x50, 0x51, 0x53, 0x51, 0x52, 0x52,
+    0x51, 0x52, 0x53, 0x54, 0x53, 0x55, 0x55, 0x5a, 0x5f, 0x6b, 0x65, 0x71, 0x72, 0x80, 0x79, 0x75,
+    0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x53, 0x60, 0x78, 0x72, 0x59, 0x50, 0x4e, 0x4c, 0x50, 0x4d,
+    0x4e, 0x4c, 0x4a, 0x46, 0x3e, 0x32, 0x3c, 0x7e, 0x2e, 0x29, 0x2e, 0x3c, 0x52, 0x58, 0x4a, 0x32,
+    0x24, 0x24, 0x24, 0x25, 0x26, 0x26, 0x25, 0x24, 0x23, 0x21, 0x22, 0x21, 0x21, 0x21, 0x21, 0x20,
+    0x1f, 0x1e, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x21, 0x4d, 0x70, 0x76, 0x71,
+    0x63, 0x3d, 0x42, 0x8c, 0x75, 0x32, 0x43, 0x4c, 0x4f, 0x4f, 0x50, 0x52, 0x53, 0x52, 0x53, 0x52,
+    0x53, 0x53, 0x54, 0x54, 0x55, 0x54, 0x55, 0x5a, 0x5d, 0x6f, 0x62, 0x6d, 0x78, 0x83, 0x81, 0x80,
+    0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4e, 0x57, 0x6d, 0x78, 0x63, 0x52, 0x4f, 0x4c, 0x4a, 0x4b, 0x4b,
+    0x4c, 0x4a, 0x46, 0x3d, 0x31, 0x29, 0x24, 0x57, 0x74, 0x2a, 0x28, 0x2a, 0x2f, 0x40, 0x4f, 0x3c,
+    0x20, 0x20, 0x2d, 0x2d, 0x22, 0x23, 0x22, 0x22, 0x22, 0x21, 0x21, 0x20, 0x1f, 0x1f, 0x1f, 0x1e,
+    0x1d, 0x1e, 0x1b, 0x1c, 0x1b, 0x1c, 0x1b, 0x1a, 0x1c, 0x1f, 0x31, 0x63, 0x70, 0x70, 0x65, 0x48,
+    0x3c, 0x49, 0x2b, 0x4a, 0x49, 0x3c, 0x45, 0x4b, 0x4f, 0x4f, 0x51, 0x54, 0x53, 0x53, 0x54, 0x53,
+    0x54, 0x54, 0x54, 0x55, 0x54, 0x55, 0x56, 0x59, 0x5d, 0x68, 0x6c, 0x7d, 0x82, 0x7e, 0x7d, 0x85,
+    0x4c, 0x4d, 0x4d, 0x4c, 0x4c, 0x4c, 0x5a, 0x6f, 0x66, 0x56, 0x50, 0x4c, 0x49, 0x48, 0x4e, 0x48,
+    0x48, 0x43, 0x3c, 0x32, 0x2c, 0x25, 0x1f, 0x17, 0x6b, 0x66, 0x28, 0x28, 0x2a, 0x49, 0x36, 0x2a,
+    0x25, 0x20, 0x1e, 0x21, 0x1f, 0x1f, 0x20, 0x21, 0x20, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d,
+    0x1d, 0x1d, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1e, 0x2b, 0x44, 0x69, 0x70, 0x69, 0x48, 0x28, 0x28,
+    0x48, 0x30, 0x32, 0x3f, 0x3f, 0x40, 0x45, 0x4a, 0x4d, 0x50, 0x51, 0x52, 0x54, 0x53, 0x53, 0x54,
+    0x54, 0x53, 0x54, 0x54, 0x55, 0x55, 0x56, 0x58, 0x5e, 0x68, 0x68, 0x7f, 0x83, 0x75, 0x80, 0x87,
+    0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4c, 0x53, 0x5d, 0x57, 0x51, 0x4e, 0x4a, 0x48, 0x47, 0x4f, 0x43,
+    0x41, 0x3e, 0x38, 0x2c, 0x28, 0x20, 0x1a, 0x14, 0x13, 0x61, 0x57, 0x26, 0x27, 0x2f, 0x20, 0x18,
+    0x2e, 0x3a, 0x27, 0x21, 0x1c, 0x1e, 0x1d, 0x1f, 0x20, 0x1f, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1e,
+    0x1e, 0x1e, 0x1e, 0x1d, 0x1e, 0x21, 0x2b, 0x39, 0x58, 0x6c, 0x63, 0x46, 0x26, 0x1e, 0x1d, 0x26,
+    0x2c, 0x19, 0x1b, 0x2f, 0x3c, 0x44, 0x44, 0x49, 0x4d, 0x4e, 0x52, 0x52, 0x51, 0x52, 0x54, 0x53,
+    0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x56, 0x5a, 0x5c, 0x67, 0x66, 0x7a, 0x7f, 0x7b, 0x81, 0x72,
+    0x4c, 0x4c, 0x4a, 0x4c, 0x4b, 0x4b, 0x4d, 0x56, 0x53, 0x4f, 0x4b, 0x48, 0x45, 0x41, 0x42, 0x3c,
+    0x3e, 0x38, 0x2f, 0x28, 0x21, 0x1d, 0x17, 0x13, 0x10, 0x0d, 0x3e, 0x51, 0x26, 0x23, 0x17, 0x13,
+    0x11, 0x1e, 0x28, 0x2a, 0x23, 0x1e, 0x1c, 0x27, 0x33, 0x32, 0x30, 0x30, 0x2c, 0x26, 0x22, 0x22,
+    0x23, 0x28, 0x2b, 0x35, 0x43, 0x4f, 0x5b, 0x63, 0x5d, 0x36, 0x1f, 0x1a, 0x18, 0x18, 0x19, 0x1e,
+    0x1d, 0x1c, 0x24, 0x30, 0x39, 0x45, 0x42, 0x48, 0x4b, 0x4d, 0x50, 0x51, 0x51, 0x53, 0x52, 0x54,
+    0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x57, 0x59, 0x5c, 0x65, 0x69, 0x70, 0x7e, 0x83, 0x7d, 0x7c,
+    0x4d, 0x4c, 0x4b, 0x4b, 0x4a, 0x4a, 0x4a, 0x50, 0x52, 0x4c, 0x47, 0x43, 0x3e, 0x3c, 0x3b, 0x38,
+    0x3a, 0x34, 0x2a, 0x24, 0x1e, 0x19, 0x15, 0x12, 0x0f, 0x0c, 0x0a, 0x23, 0x39, 0x33, 0x32, 0x28,
+    0x38, 0x15, 0x14, 0x10, 0x11, 0x18, 0x18, 0x1b, 0x25, 0x2a, 0x2f, 0x2f, 0x30, 0x32, 0x33, 0x37,
+    0x3c, 0x3f, 0x41, 0x45, 0x45, 0x3e, 0x38, 0x38, 0x1d, 0x1a, 0x1a, 0x1b, 0x1f, 0x27, 0x1b, 0x17,
+    0x1e, 0x41, 0x56, 0x3e, 0x38, 0x3f, 0x42, 0x46, 0x49, 0x4d, 0x4e, 0x4f, 0x51, 0x52, 0x53, 0x54,
+    0x54, 0x54, 0x54, 0x55, 0x54, 0x55, 0x56, 0x5b, 0x5d, 0x65, 0x65, 0x6e, 0x7b, 0x7d, 0x79, 0x79,
+    0x4e, 0x4c, 0x4b, 0x4b, 0x4b, 0x49, 0x4a, 0x52, 0x62, 0x4f, 0x44, 0x40, 0x3c, 0x39, 0x37, 0x3c,
+    0x34, 0x2f, 0x26, 0x1f, 0x1a, 0x18, 0x14, 0x11, 0x0e, 0x0c, 0x06, 0x18, 0x42, 0x42, 0x41, 0x3d,
+    0x37, 0x2f, 0x21, 0x15, 0x10, 0x0f, 0x11, 0x14, 0x14, 0x17, 0x19, 0x1b, 0x1b, 0x1c, 0x1c, 0x1d,
+    0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x20, 0x2d, 0x28, 0x29, 0x39, 0x44, 0x7a, 0x76, 0x2f, 0x19, 0x1b,
+    0x28, 0x43, 0x55, 0x62, 0x49, 0x3b, 0x3e, 0x43, 0x47, 0x4b, 0x4d, 0x50, 0x51, 0x51, 0x53, 0x53,
+    0x53, 0x53, 0x54, 0x54, 0x53, 0x54, 0x56, 0x5b, 0x5e, 0x65, 0x63, 0x6f, 0x6d, 0x7c, 0x78, 0x73,
+    0x4e, 0x4c, 0x4b, 0x4a, 0x4a, 0x48, 0x47, 0x4c, 0x53, 0x46, 0x3f, 0x3c, 0x3a, 0x36, 0x36, 0x35,
+    0x2f, 0x28, 0x22, 0x1e, 0x19, 0x16, 0x14, 0x12, 0x0f, 0x0d, 0x0b, 0x3b, 0x49, 0x47, 0x46, 0x44,
+    0x42, 0x3e, 0x35, 0x28, 0x18, 0x17, 0x11, 0x11, 0x11, 0x11, 0x15, 0x17, 0x18, 0x18, 0x18, 0x18,
+    0x19, 0x18, 0x18, 0x17, 0x1f, 0x3f, 0x77, 0xcf, 0xbb, 0x99, 0x5e, 0x3b, 0x9d, 0x7d, 0x37, 0x23,
+    0x1c, 0x1b, 0x39, 0x49, 0x41, 0x37, 0x3c, 0x41, 0x46, 0x4c, 0x4e, 0x50, 0x50, 0x51, 0x53, 0x52,
+    0x53, 0x53, 0x54, 0x54, 0x53, 0x54, 0x59, 0x5a, 0x5f, 0x66, 0x67, 0x69, 0x73, 0x6f, 0x63, 0x66,
+    0x4f, 0x4e, 0x4b, 0x4b, 0x48, 0x4b, 0x48, 0x43, 0x40, 0x3e, 0x3c, 0x3a, 0x38, 0x35, 0x32, 0x31,
+    0x2b, 0x23, 0x20, 0x1c, 0x18, 0x15, 0x13, 0x12, 0x0f, 0x0d, 0x25, 0x59, 0x4a, 0x4a, 0x49, 0x48,
+    0x48, 0x43, 0x3e, 0x33, 0x37, 0x3e, 0x0d, 0x0e, 0x0f, 0x0e, 0x0f, 0x14, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x15, 0x15, 0x15, 0x25, 0x24, 0x34, 0x7d, 0x98, 0x57, 0x26, 0x30, 0x5b, 0x55, 0x64, 0x3d,
+    0x1c, 0x1c, 0x1a, 0x1b, 0x1d, 0x48, 0x3a, 0x3e, 0x44, 0x4b, 0x4f, 0x50, 0x52, 0x54, 0x53, 0x52,
+    0x54, 0x54, 0x53, 0x54, 0x54, 0x55, 0x58, 0x59, 0x5f, 0x65, 0x5c, 0x5e, 0x66, 0x75, 0x70, 0x58,
+    0x53, 0x55, 0x4c, 0x49, 0x4a, 0x5c, 0x4e, 0x42, 0x3e, 0x3c, 0x3b, 0x39, 0x37, 0x34, 0x32, 0x2e,
+    0x29, 0x24, 0x1e, 0x1b, 0x18, 0x14, 0x13, 0x12, 0x0f, 0x14, 0x46, 0x4a, 0x5b, 0x79, 0x74, 0x74,
+    0x53, 0x45, 0x46, 0x38, 0x24, 0x0c, 0x0d, 0x0d, 0x0f, 0x0e, 0x0e, 0x10, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x1c, 0x3a, 0x1f, 0x29, 0x31, 0x3e, 0x31, 0x48, 0x47, 0x4b, 0x65, 0x4b, 0x43,
+    0x29, 0x1b, 0x15, 0x16, 0x16, 0x22, 0x4a, 0x3c, 0x43, 0x48, 0x4f, 0x50, 0x51, 0x52, 0x54, 0x55,
+    0x55, 0x56, 0x56, 0x57, 0x56, 0x57, 0x59, 0x5b, 0x62, 0x63, 0x58, 0x59, 0x60, 0x6a, 0x6e, 0x64,
+    0x55, 0x6e, 0x53, 0x4c, 0x5d, 0x58, 0x45, 0x3e, 0x3d, 0x3b, 0x39, 0x38, 0x36, 0x33, 0x31, 0x2c,
+    0x26, 0x23, 0x1c, 0x1a, 0x18, 0x14, 0x13, 0x12, 0x10, 0x33, 0x51, 0x4b, 0x9f, 0xd5, 0xe7, 0xe8,
+    0x75, 0x49, 0x47, 0x20, 0x0b, 0x0b, 0x0d, 0x0d, 0x0e, 0x0f, 0x0f, 0x0f, 0x11, 0x12, 0x13, 0x12,
+    0x13, 0x13, 0x13, 0x16, 0x57, 0x48, 0x3f, 0x4c, 0x3a, 0x49, 0x49, 0x58, 0x52, 0x57, 0x47, 0x4c,
+    0x2c, 0x1d, 0x25, 0x1b, 0x17, 0x15, 0x1c, 0x3d, 0x40, 0x45, 0x4d, 0x50, 0x50, 0x52, 0x53, 0x55,
+    0x55, 0x56, 0x57, 0x58, 0x57, 0x57, 0x58, 0x5c, 0x62, 0x63, 0x51, 0x4e, 0x55, 0x61, 0x67, 0x68,
+    0x66, 0x6f, 0x62, 0x58, 0x58, 0x46, 0x3f, 0x3c, 0x3c, 0x3a, 0x39, 0x37, 0x36, 0x33, 0x31, 0x2a,
+    0x24, 0x1d, 0x1f, 0x30, 0x19, 0x13, 0x12, 0x10, 0x26, 0x48, 0x49, 0x4c, 0x54, 0x83, 0xc4, 0xac,
+    0x52, 0x49, 0x28, 0x0b, 0x0a, 0x0b, 0x0d, 0x0d, 0x0e, 0x0e, 0x0f, 0x10, 0x11, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x11, 0x10, 0x0e, 0x25, 0x17, 0x2f, 0x36, 0x3e, 0x56, 0x53, 0x5f, 0x76, 0x54, 0x38,
+    0x2d, 0x27, 0x3a, 0x1e, 0x16, 0x14, 0x17, 0x1c, 0x3d, 0x42, 0x4a, 0x4f, 0x50, 0x51, 0x54, 0x55,
+    0x56, 0x5a, 0x58, 0x59, 0x5c, 0x5c, 0x58, 0x5c, 0x63, 0x66, 0x46, 0x52, 0x54, 0x56, 0x60, 0x62,
+    0x88, 0x59, 0x5c, 0x57, 0x49, 0x41, 0x3e, 0x3c, 0x3a, 0x39, 0x38, 0x36, 0x35, 0x33, 0x30, 0x2b,
+    0x23, 0x1d, 0x1a, 0x1a, 0x15, 0x13, 0x12, 0x13, 0x45, 0x47, 0x45, 0x47, 0x49, 0x4d, 0x4b, 0x4a,
+    0x47, 0x39, 0x0f, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x09, 0x22, 0x38, 0x6d, 0x53, 0x67, 0x89, 0x9d, 0x66, 0x3f,
+    0x3f, 0x2f, 0x2e, 0x2b, 0x1e, 0x15, 0x14, 0x13, 0x25, 0x43, 0x47, 0x4f, 0x51, 0x51, 0x55, 0x59,
+    0x59, 0x5d, 0x5a, 0x5a, 0x62, 0x59, 0x59, 0x5f, 0x67, 0x62, 0x4d, 0x5b, 0x60, 0x61, 0x5f, 0x5d,
+    0xa6, 0x4c, 0x53, 0x4f, 0x42, 0x40, 0x3d, 0x3c, 0x3b, 0x3a, 0x38, 0x36, 0x35, 0x32, 0x31, 0x2a,
+    0x22, 0x1c, 0x19, 0x17, 0x14, 0x12, 0x11, 0x20, 0x47, 0x47, 0x44, 0x43, 0x47, 0x4a, 0x4a, 0x48,
+    0x47, 0x22, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x0d, 0x0b, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x07, 0x08, 0x4d, 0x49, 0x5c, 0x71, 0xbf, 0xdc, 0xdb, 0x78, 0x6b,
+    0x81, 0x38, 0x26, 0x2a, 0x2a, 0x19, 0x14, 0x13, 0x11, 0x44, 0x4a, 0x4f, 0x50, 0x51, 0x56, 0x58,
+    0x5d, 0x5c, 0x5b, 0x5f, 0x64, 0x5a, 0x5b, 0x60, 0x63, 0x53, 0x4e, 0x5e, 0x63, 0x64, 0x5f, 0x59,
+    0x79, 0x61, 0x4c, 0x42, 0x40, 0x3f, 0x3d, 0x3c, 0x3b, 0x39, 0x38, 0x36, 0x34, 0x33, 0x30, 0x2a,
+    0x22, 0x1b, 0x19, 0x17, 0x13, 0x12, 0x10, 0x29, 0x56, 0x5d, 0x48, 0x46, 0x45, 0x45, 0x46, 0x48,
+    0x44, 0x10, 0x0f, 0x0e, 0x0d, 0x0d, 0x0e, 0x0b, 0x11, 0x11, 0x10, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e,
+    0x0d, 0x0d, 0x0c, 0x0b, 0x06, 0x05, 0x26, 0x9c, 0x4e, 0x50, 0x90, 0xfd, 0xfd, 0xf5, 0x85, 0x9e,
+    0xd8, 0x66, 0x31, 0x23, 0x2e, 0x1e, 0x14, 0x12, 0x11, 0x42, 0x55, 0x57, 0x53, 0x53, 0x56, 0x56,
+    0x58, 0x5a, 0x5b, 0x5e, 0x5d, 0x58, 0x5c, 0x63, 0x65, 0x3b, 0x4f, 0x5d, 0x5e, 0x58, 0x58, 0x58,
+    0x54, 0x7c, 0x4b, 0x42, 0x40, 0x41, 0x40, 0x3e, 0x3c, 0x3a, 0x39, 0x36, 0x34, 0x33, 0x2f, 0x2a,
+    0x22, 0x1b, 0x19, 0x16, 0x13, 0x12, 0x11, 0x2d, 0x58, 0x5a, 0x5a, 0x4d, 0x48, 0x45, 0x3f, 0x3f,
+    0x22, 0x0b, 0x10, 0x1b, 0x0d, 0x12, 0x0d, 0x10, 0x13, 0x13, 0x13, 0x12, 0x11, 0x10, 0x0f, 0x0e,
+    0x0e, 0x0d, 0x09, 0x06, 0x06, 0x0a, 0x48, 0xca, 0x6b, 0xb7, 0xa2, 0xef, 0xfd, 0xfc, 0x7e, 0x4e,
+    0x4f, 0x31, 0x36, 0x2b, 0x35, 0x26, 0x16, 0x14, 0x12, 0x44, 0x6a, 0x6f, 0x65, 0x66, 0x5c, 0x56,
+    0x57, 0x57, 0x5a, 0x5c, 0x59, 0x5a, 0x5e, 0x63, 0x55, 0x37, 0x47, 0x63, 0x6d, 0x6b, 0x65, 0x54,
+    0x58, 0x69, 0x4e, 0x41, 0x3f, 0x3e, 0x3e, 0x3e, 0x3d, 0x3c, 0x39, 0x36, 0x35, 0x33, 0x30, 0x2a,
+    0x23, 0x1c, 0x1a, 0x17, 0x14, 0x12, 0x12, 0x2e, 0x3c, 0x39, 0x49, 0x7b, 0x5d, 0x49, 0x3d, 0x35,
+    0x11, 0x0b, 0x0c, 0x19, 0x15, 0x10, 0x0c, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x0f, 0x0d,
+    0x0b, 0x08, 0x07, 0x0a, 0x0c, 0x0d, 0x4d, 0x8c, 0x9b, 0xd3, 0xd3, 0xad, 0xcb, 0xb1, 0x56, 0x40,
+    0x31, 0x26, 0x33, 0x5d, 0x73, 0x1f, 0x15, 0x13, 0x11, 0x48, 0x63, 0x60, 0x6b, 0x69, 0x5a, 0x55,
+    0x56, 0x57, 0x58, 0x5a, 0x58, 0x5b, 0x65, 0x63, 0x39, 0x26, 0x36, 0x51, 0x66, 0x76, 0x73, 0x54,
+    0x4c, 0x53, 0x5c, 0x43, 0x3f, 0x3e, 0x3e, 0x3d, 0x3d, 0x3c, 0x3c, 0x37, 0x34, 0x33, 0x30, 0x2d,
+    0x26, 0x1e, 0x1a, 0x17, 0x14, 0x12, 0x13, 0x2b, 0x3d, 0x31, 0x39, 0x66, 0x6c, 0x4b, 0x35, 0x22,
+    0x0c, 0x0c, 0x0d, 0x1b, 0x1a, 0x0d, 0x0a, 0x08, 0x07, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08, 0x09,
+    0x0a, 0x0c, 0x0d, 0x0e, 0x0e, 0x0c, 0x51, 0x7c, 0xb5, 0x7f, 0xa8, 0x7f, 0x83, 0x68, 0x45, 0x3e,
+    0x2c, 0x59, 0x4c, 0x75, 0x49, 0x18, 0x13, 0x12, 0x18, 0x50, 0x4b, 0x50, 0x57, 0x5a, 0x57, 0x58,
+    0x56, 0x56, 0x57, 0x58, 0x5a, 0x5c, 0x63, 0x55, 0x25, 0x28, 0x43, 0x4c, 0x51, 0x5c, 0x65, 0x6a,
+    0x46, 0x55, 0x54, 0x45, 0x40, 0x3f, 0x3e, 0x3e, 0x3d, 0x3c, 0x3b, 0x38, 0x36, 0x34, 0x32, 0x2e,
+    0x28, 0x21, 0x1b, 0x18, 0x15, 0x12, 0x12, 0x28, 0x2d, 0x3c, 0x65, 0x33, 0x30, 0x2b, 0x26, 0x14,
+    0x0c, 0x0d, 0x2b, 0x1f, 0x19, 0x13, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0d,
+    0x0d, 0x0d, 0x0e, 0x0e, 0x10, 0x0e, 0x5b, 0xa8, 0x5f, 0x4c, 0x65, 0x84, 0x77, 0x64, 0x7c, 0x5c,
+    0x53, 0xd1, 0x6c, 0x52, 0x29, 0x10, 0x13, 0x18, 0x36, 0x3f, 0x48, 0x4d, 0x51, 0x53, 0x56, 0x5e,
+    0x58, 0x57, 0x57, 0x57, 0x5b, 0x61, 0x62, 0x34, 0x29, 0x31, 0x4a, 0x59, 0x52, 0x51, 0x5b, 0x53,
+    0x3d, 0x4b, 0x59, 0x4a, 0x42, 0x40, 0x3f, 0x3e, 0x3d, 0x3d, 0x3b, 0x39, 0x37, 0x35, 0x33, 0x2f,
+    0x29, 0x21, 0x1c, 0x18, 0x16, 0x13, 0x11, 0x22, 0x29, 0x2b, 0x48, 0x4c, 0x40, 0x27, 0x1f, 0x0f,
+    0x0e, 0x2a, 0x1f, 0x14, 0x15, 0x15, 0x13, 0x12, 0x11, 0x11, 0x12, 0x11, 0x0f, 0x0f, 0x0e, 0x0e,
+    0x0d, 0x0e, 0x0d, 0x0e, 0x0f, 0x0e, 0x65, 0xca, 0x66, 0x53, 0x6b, 0x79, 0x75, 0x68, 0xa1, 0xba,
+    0x7b, 0x8c, 0x52, 0x31, 0x17, 0x1a, 0x16, 0x29, 0x54, 0x3f, 0x49, 0x4d, 0x50, 0x54, 0x58, 0x5b,
+    0x59, 0x58, 0x59, 0x5a, 0x5e, 0x61, 0x56, 0x24, 0x27, 0x30, 0x59, 0x61, 0x50, 0x52, 0x52, 0x57,
+    0x1f, 0x44, 0x62, 0x53, 0x46, 0x41, 0x3f, 0x3f, 0x3e, 0x3d, 0x3c, 0x3a, 0x38, 0x36, 0x33, 0x30,
+    0x2c, 0x24, 0x1d, 0x1a, 0x17, 0x14, 0x12, 0x14, 0x2a, 0x2a, 0x2b, 0x2e, 0x2b, 0x24, 0x18, 0x0f,
+    0x2d, 0x33, 0x15, 0x16, 0x16, 0x15, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x10, 0x0f, 0x0f,
+    0x0e, 0x0f, 0x0d, 0x0d, 0x0e, 0x0d, 0x2f, 0xb8, 0x77, 0x5a, 0x86, 0x95, 0x9b, 0xa9, 0xbf, 0xcd,
+    0x67, 0x4e, 0x22, 0x15, 0x27, 0x15, 0x23, 0x3a, 0x3d, 0x43, 0x4a, 0x4d, 0x4f, 0x53, 0x56, 0x5c,
+    0x59, 0x59, 0x59, 0x5c, 0x60, 0x69, 0x41, 0x23, 0x2b, 0x39, 0x4d, 0x51, 0x4f, 0x55, 0x5b, 0x5a,
+    0x0a, 0x2f, 0x4d, 0x86, 0x4d, 0x45, 0x41, 0x40, 0x3f, 0x3e, 0x3c, 0x3b, 0x39, 0x36, 0x33, 0x30,
+    0x2d, 0x27, 0x1f, 0x1b, 0x18, 0x16, 0x13, 0x12, 0x12, 0x25, 0x2f, 0x28, 0x27, 0x21, 0x15, 0x15,
+    0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x11, 0x10, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0d, 0x0e, 0x0d, 0x0d, 0x17, 0x66, 0x6e, 0x6f, 0x81, 0xdd, 0xd3, 0xc3, 0x99, 0x69,
+    0x3a, 0x1e, 0x1d, 0x1e, 0x19, 0x20, 0x29, 0x49, 0x32, 0x46, 0x4a, 0x4f, 0x51, 0x54, 0x56, 0x59,
+    0x5c, 0x59, 0x5b, 0x5e, 0x65, 0x5b, 0x29, 0x2d, 0x36, 0x39, 0x44, 0x4e, 0x52, 0x5a, 0x61, 0x62,
+    0x09, 0x0f, 0x3e, 0x60, 0x80, 0x4b, 0x45, 0x43, 0x40, 0x3e, 0x3d, 0x3c, 0x3a, 0x37, 0x35, 0x31,
+    0x2f, 0x2a, 0x23, 0x1c, 0x19, 0x17, 0x14, 0x13, 0x11, 0x0f, 0x17, 0x26, 0x20, 0x1b, 0x11, 0x10,
+    0x1c, 0x39, 0x13, 0x1c, 0x3a, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x12, 0x11, 0x10, 0x0f, 0x0e,
+    0x0f, 0x0d, 0x0d, 0x0d, 0x0e, 0x0d, 0x0c, 0x53, 0x69, 0xa9, 0x79, 0xa4, 0x8e, 0x79, 0x4f, 0x28,
+    0x1a, 0x22, 0x1d, 0x18, 0x2c, 0x28, 0x48, 0x28, 0x40, 0x48, 0x4b, 0x4f, 0x52, 0x54, 0x55, 0x59,
+    0x5f, 0x5a, 0x5b, 0x61, 0x61, 0x35, 0x27, 0x35, 0x36, 0x3b, 0x52, 0x4e, 0x58, 0x5c, 0x6b, 0x66,
+    0x07, 0x06, 0x1a, 0x45, 0x6c, 0x81, 0x4c, 0x45, 0x42, 0x3f, 0x3e, 0x3c, 0x3b, 0x38, 0x36, 0x33,
+    0x31, 0x2e, 0x28, 0x20, 0x1b, 0x19, 0x17, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x36, 0x26, 0x10, 0x1b, 0x2b, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0f, 0x0f,
+    0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x1f, 0xb4, 0xbe, 0xa2, 0x6d, 0x5c, 0x3d, 0x31, 0x1f,
+    0x1c, 0x1c, 0x22, 0x42, 0x54, 0x47, 0x24, 0x33, 0x49, 0x48, 0x4b, 0x50, 0x51, 0x53, 0x55, 0x62,
+    0x5b, 0x5b, 0x64, 0x61, 0x3b, 0x20, 0x26, 0x2e, 0x3f, 0x53, 0x5a, 0x5c, 0x60, 0x6c, 0x6c, 0x64,
+    0x08, 0x08, 0x08, 0x22, 0x4b, 0x6c, 0x89, 0x4d, 0x46, 0x43, 0x40, 0x3f, 0x3c, 0x3c, 0x38, 0x36,
+    0x33, 0x30, 0x2c, 0x26, 0x1d, 0x1b, 0x18, 0x16, 0x14, 0x12, 0x11, 0x0f, 0x0d, 0x0d, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x10, 0x10, 0x0f, 0x0f,
+    0x0f, 0x0e, 0x0d, 0x0d, 0x0d, 0x0c, 0x0b, 0x0a, 0x4c, 0xb6, 0xbf, 0x8f, 0x50, 0x25, 0x25, 0x27,
+    0x2a, 0x2a, 0x38, 0x42, 0x5b, 0x19, 0x28, 0x41, 0x49, 0x4c, 0x4e, 0x4f, 0x53, 0x54, 0x60, 0x5b,
+    0x5a, 0x62, 0x67, 0x42, 0x1e, 0x1e, 0x22, 0x34, 0x4b, 0x51, 0x59, 0x5f, 0x6a, 0x69, 0x5b, 0x55,
+    0x0a, 0x0a, 0x09, 0x0b, 0x29, 0x4c, 0x78, 0x92, 0x4e, 0x45, 0x43, 0x40, 0x3f, 0x3d, 0x3a, 0x37,
+    0x35, 0x32, 0x2f, 0x2a, 0x24, 0x1c, 0x1a, 0x18, 0x16, 0x14, 0x12, 0x11, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0x0d,
+    0x0e, 0x0d, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x09, 0x4e, 0x9f, 0x86, 0x4d, 0x2a, 0x30, 0x59,
+    0x3c, 0x35, 0x48, 0x56, 0x12, 0x1f, 0x3e, 0x47, 0x49, 0x50, 0x4f, 0x51, 0x52, 0x5a, 0x5a, 0x59,
+    0x5f, 0x63, 0x49, 0x20, 0x24, 0x1f, 0x24, 0x2f, 0x3a, 0x49, 0x5c, 0x67, 0x56, 0x46, 0x4d, 0x59,
+    0x0d, 0x0b, 0x0b, 0x09, 0x0c, 0x2d, 0x4d, 0x7a, 0x89, 0x4d, 0x47, 0x43, 0x40, 0x3e, 0x3c, 0x3a,
+    0x38, 0x34, 0x32, 0x30, 0x29, 0x22, 0x1c, 0x1a, 0x18, 0x16, 0x13, 0x12, 0x10, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0c, 0x0c, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x39, 0x65, 0x5d, 0x68, 0x5a, 0x7b,
+    0x4d, 0x44, 0x24, 0x0d, 0x17, 0x3b, 0x44, 0x49, 0x4b, 0x4e, 0x53, 0x52, 0x55, 0x57, 0x59, 0x5e,
+    0x65, 0x52, 0x1e, 0x1a, 0x1d, 0x1e, 0x23, 0x33, 0x42, 0x5a, 0x5d, 0x4f, 0x4c, 0x69, 0x5e, 0x58,
+    0x0f, 0x0c, 0x0b, 0x0b, 0x09, 0x0e, 0x2e, 0x52, 0x85, 0x8c, 0x4f, 0x45, 0x42, 0x40, 0x3e, 0x3c,
+    0x39, 0x37, 0x35, 0x33, 0x2f, 0x29, 0x22, 0x1e, 0x19, 0x18, 0x16, 0x13, 0x12, 0x10, 0x0f, 0x0e,
+    0x0d, 0x0e, 0x0d, 0x0d, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d,
+    0x0d, 0x0d, 0x0e, 0x0c, 0x0c, 0x0c, 0x0b, 0x0a, 0x0a, 0x09, 0x0a, 0x0b, 0x0c, 0x13, 0x1c, 0x18,
+    0x10, 0x0c, 0x0d, 0x15, 0x36, 0x42, 0x47, 0x4a, 0x4b, 0x4e, 0x52, 0x54, 0x55, 0x5a, 0x61, 0x60,
+    0x5a, 0x21, 0x12, 0x19, 0x1b, 0x1f, 0x2d, 0x3b, 0x50, 0x63, 0x5b, 0x41, 0x63, 0x5a, 0x57, 0x63,
+    0x15, 0x0c, 0x0d, 0x09, 0x09, 0x0a, 0x0c, 0x2d, 0x50, 0x86, 0xa0, 0x53, 0x47, 0x43, 0x40, 0x3d,
+    0x3c, 0x39, 0x38, 0x35, 0x32, 0x2f, 0x29, 0x23, 0x1d, 0x1a, 0x18, 0x15, 0x13, 0x11, 0x0f, 0x0e,
+    0x0e, 0x0d, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d,
+    0x0d, 0x0e, 0x10, 0x0d, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0d,
+    0x0d, 0x0e, 0x1d, 0x37, 0x40, 0x47, 0x48, 0x4a, 0x4e, 0x4f, 0x53, 0x58, 0x5d, 0x65, 0x66, 0x5e,
+    0x28, 0x0b, 0x12, 0x17, 0x1e, 0x23, 0x35, 0x40, 0x51, 0x5e, 0x48, 0x66, 0x55, 0x59, 0x6c, 0x60,
+    0x1c, 0x11, 0x0a, 0x0a, 0x08, 0x08, 0x09, 0x0b, 0x2b, 0x71, 0x6d, 0xa2, 0x74, 0x4a, 0x44, 0x40,
+    0x3d, 0x3c, 0x3a, 0x39, 0x35, 0x32, 0x30, 0x2b, 0x25, 0x1d, 0x18, 0x15, 0x13, 0x11, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x11,
+    0x19, 0x2b, 0x39, 0x40, 0x46, 0x49, 0x4b, 0x4c, 0x4f, 0x53, 0x57, 0x64, 0x90, 0x65, 0x55, 0x26,
+    0x0a, 0x09, 0x12, 0x18, 0x1f, 0x2c, 0x3b, 0x50, 0x63, 0x4c, 0x4e, 0x50, 0x63, 0x66, 0x65, 0x67,
+    0x24, 0x15, 0x0d, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x27, 0x4d, 0x56, 0x96, 0x9c, 0x51, 0x44,
+    0x41, 0x3f, 0x3c, 0x3a, 0x38, 0x37, 0x33, 0x30, 0x2b, 0x25, 0x1c, 0x15, 0x12, 0x10, 0x0e, 0x0d,
+    0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0e, 0x10, 0x11, 0x11, 0x0f, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x1b, 0x27,
+    0x35, 0x3c, 0x41, 0x47, 0x47, 0x4b, 0x4c, 0x50, 0x51, 0x59, 0x62, 0x5f, 0x6c, 0x4e, 0x1a, 0x09,
+    0x09, 0x0d, 0x15, 0x1f, 0x2d, 0x33, 0x47, 0x5b, 0x44, 0x58, 0x4e, 0x54, 0x86, 0x6d, 0x66, 0x6d,
+    0x3b, 0x21, 0x10, 0x0b, 0x09, 0x0a, 0x0b, 0x09, 0x09, 0x09, 0x16, 0x3d, 0x54, 0x73, 0xac, 0x5e,
+    0x46, 0x42, 0x40, 0x3d, 0x3b, 0x39, 0x36, 0x33, 0x2f, 0x27, 0x1a, 0x15, 0x12, 0x10, 0x0f, 0x0e,
+    0x0e, 0x0d, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0e, 0x10, 0x12, 0x13, 0x18, 0x1b, 0x1b, 0x16, 0x15, 0x16, 0x18, 0x1c, 0x24, 0x2f, 0x38,
+    0x3d, 0x42, 0x49, 0x47, 0x49, 0x4c, 0x4f, 0x51, 0x5f, 0x60, 0x65, 0x62, 0x45, 0x16, 0x09, 0x09,
+    0x0b, 0x12, 0x17, 0x25, 0x2f, 0x31, 0x51, 0x44, 0x56, 0x49, 0x4e, 0x56, 0x5d, 0x98, 0x72, 0x6b,
+    0x6f, 0x32, 0x16, 0x0f, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0a, 0x12, 0x2c, 0x4d, 0x60, 0xae,
+    0x94, 0x4e, 0x43, 0x3f, 0x3c, 0x39, 0x36, 0x33, 0x2d, 0x21, 0x19, 0x14, 0x12, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x10,
+    0x10, 0x11, 0x13, 0x14, 0x17, 0x1d, 0x21, 0x24, 0x24, 0x24, 0x26, 0x29, 0x31, 0x34, 0x3a, 0x3e,
+    0x4b, 0x49, 0x47, 0x49, 0x4c, 0x4f, 0x52, 0x61, 0x64, 0x5f, 0x5f, 0x34, 0x10, 0x08, 0x08, 0x09,
+    0x0b, 0x18, 0x1f, 0x26, 0x29, 0x47, 0x48, 0x56, 0x41, 0x4a, 0x53, 0x4a, 0x4f, 0x7c, 0x70, 0x65,
+    0x92, 0x4e, 0x26, 0x16, 0x0d, 0x0b, 0x0a, 0x0c, 0x0a, 0x09, 0x0d, 0x0b, 0x0c, 0x1b, 0x41, 0x52,
+    0x7d, 0xb8, 0x80, 0x47, 0x40, 0x3c, 0x37, 0x31, 0x25, 0x1c, 0x17, 0x12, 0x10, 0x0e, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x12, 0x13, 0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x14, 0x16, 0x18, 0x1d, 0x22, 0x25, 0x28, 0x29, 0x2d, 0x31, 0x35, 0x41, 0x41, 0x44, 0x4d,
+    0x4c, 0x48, 0x4a, 0x4c, 0x4f, 0x53, 0x5b, 0x5c, 0x5f, 0x67, 0x36, 0x0c, 0x08, 0x08, 0x09, 0x0a,
+    0x12, 0x18, 0x23, 0x2d, 0x3e, 0x41, 0x55, 0x44, 0x55, 0x5f, 0x5f, 0x3e, 0x83, 0x6f, 0x85, 0x68,
+    0x90, 0x75, 0x3f, 0x1f, 0x13, 0x0b, 0x0b, 0x0c, 0x09, 0x0e, 0x0b, 0x09, 0x09, 0x08, 0x12, 0x32,
+    0x4c, 0x54, 0x8e, 0xbc, 0x71, 0x3e, 0x38, 0x2e, 0x22, 0x1a, 0x14, 0x11, 0x0f, 0x0f, 0x10, 0x11,
+    0x12, 0x13, 0x13, 0x15, 0x14, 0x14, 0x15, 0x16, 0x17, 0x17, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16,
+    0x17, 0x18, 0x19, 0x1d, 0x23, 0x28, 0x2a, 0x2f, 0x32, 0x37, 0x3b, 0x3e, 0x43, 0x43, 0x45, 0x47,
+    0x4a, 0x4c, 0x4d, 0x50, 0x58, 0x5a, 0x5f, 0x5a, 0x43, 0x1e, 0x0a, 0x08, 0x08, 0x09, 0x09, 0x0d,
+    0x15, 0x1e, 0x26, 0x39, 0x48, 0x40, 0x3f, 0x49, 0x60, 0x51, 0x33, 0x68, 0x7b, 0x81, 0x7e, 0x70,
+    0xac, 0x98, 0x6d, 0x32, 0x19, 0x11, 0x0a, 0x09, 0x0b, 0x0c, 0x0c, 0x09, 0x09, 0x09, 0x08, 0x09,
+    0x17, 0x34, 0x54, 0x72, 0x87, 0xa5, 0x86, 0x3e, 0x22, 0x1a, 0x13, 0x10, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x19, 0x1e, 0x21, 0x1f, 0x1e, 0x1e, 0x1d, 0x1c, 0x1d, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c,
+    0x1e, 0x1f, 0x22, 0x29, 0x2f, 0x33, 0x36, 0x3b, 0x3c, 0x3f, 0x41, 0x43, 0x44, 0x48, 0x4a, 0x4b,
+    0x4c, 0x51, 0x5a, 0x5c, 0x5c, 0x55, 0x41, 0x23, 0x0d, 0x07, 0x08, 0x08, 0x08, 0x0a, 0x0d, 0x10,
+    0x1f, 0x22, 0x3e, 0x43, 0x40, 0x38, 0x4d, 0x65, 0x49, 0x38, 0x6b, 0x60, 0x70, 0x8c, 0x77, 0x6c,
+    0xb6, 0xaf, 0x95, 0x5f, 0x2d, 0x16, 0x0e, 0x0b, 0x0c, 0x0c, 0x0b, 0x09, 0x09, 0x09, 0x07, 0x08,
+    0x08, 0x08, 0x16, 0x4d, 0x4d, 0x4b, 0x61, 0x86, 0x46, 0x1f, 0x15, 0x12, 0x12, 0x12, 0x14, 0x16,
+    0x18, 0x1b, 0x22, 0x28, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x29, 0x28, 0x28, 0x29, 0x2a,
+    0x2c, 0x2e, 0x32, 0x38, 0x3b, 0x3c, 0x3e, 0x41, 0x43, 0x44, 0x46, 0x48, 0x4c, 0x4a, 0x4d, 0x56,
+    0x65, 0x67, 0x64, 0x59, 0x3e, 0x20, 0x0e, 0x08, 0x08, 0x07, 0x07, 0x09, 0x0a, 0x0e, 0x10, 0x1b,
+    0x2a, 0x3c, 0x45, 0x40, 0x2e, 0x42, 0x6e, 0x41, 0x2f, 0x65, 0x73, 0x4c, 0x67, 0x7e, 0x72, 0x62,
+    0xba, 0xb4, 0xb1, 0x95, 0x52, 0x27, 0x15, 0x0c, 0x0b, 0x0a, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x09, 0x17, 0x2f, 0x44, 0x43, 0x3b, 0x3f, 0x33, 0x1e, 0x18, 0x18, 0x18, 0x19,
+    0x1c, 0x24, 0x2a, 0x2d, 0x2f, 0x30, 0x31, 0x31, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x33,
+    0x33, 0x36, 0x3a, 0x3e, 0x40, 0x41, 0x43, 0x45, 0x47, 0x49, 0x4b, 0x4d, 0x50, 0x61, 0x70, 0x71,
+    0x5f, 0x57, 0x3f, 0x23, 0x10, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x09, 0x0c, 0x0f, 0x17, 0x25,
+    0x3a, 0x42, 0x3f, 0x2d, 0x4a, 0x4d, 0x47, 0x3a, 0x52, 0x61, 0x51, 0x75, 0x80, 0x76, 0x6e, 0x6b,
+    0xb3, 0xb9, 0xc9, 0xb6, 0x87, 0x45, 0x1b, 0x15, 0x11, 0x0a, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x14, 0x26, 0x3d, 0x45, 0x57, 0x34, 0x30, 0x35, 0x34, 0x30,
+    0x35, 0x30, 0x32, 0x34, 0x35, 0x35, 0x36, 0x38, 0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x37, 0x38,
+    0x39, 0x3d, 0x41, 0x44, 0x46, 0x46, 0x48, 0x4b, 0x4f, 0x5a, 0x73, 0x7e, 0x7c, 0x6b, 0x57, 0x4a,
+    0x32, 0x1e, 0x0f, 0x09, 0x08, 0x08, 0x0a, 0x07, 0x08, 0x09, 0x0a, 0x0a, 0x10, 0x13, 0x25, 0x41,
+    0x3f, 0x32, 0x2c, 0x48, 0x55, 0x5b, 0x54, 0x54, 0x6e, 0x67, 0x7b, 0x9d, 0x7d, 0x79, 0x73, 0x6b,
+    0xc4, 0xd0, 0xc9, 0xa7, 0xa0, 0x6e, 0x54, 0x2a, 0x16, 0x0e, 0x0a, 0x0b, 0x0b, 0x0a, 0x09, 0x08,
+    0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0d, 0x1b, 0x35, 0x3d, 0x3b, 0x38, 0x3c, 0x57,
+    0x97, 0xab, 0x9a, 0x84, 0x6d, 0x56, 0x46, 0x3f, 0x3e, 0x3f, 0x3d, 0x3c, 0x3c, 0x3e, 0x3f, 0x40,
+    0x46, 0x4a, 0x4c, 0x51, 0x5d, 0x70, 0x83, 0x8b, 0x8d, 0x82, 0x64, 0x52, 0x4a, 0x3a, 0x27, 0x15,
+    0x0d, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0d, 0x13, 0x22, 0x33, 0x2d,
+    0x22, 0x2a, 0x3d, 0x50, 0x66, 0x67, 0x65, 0x6c, 0x5e, 0x69, 0x87, 0x91, 0x7b, 0x78, 0x75, 0x67,
+    0xc4, 0xc4, 0xc4, 0xd0, 0xc6, 0xb0, 0x91, 0x5b, 0x26, 0x14, 0x0e, 0x0d, 0x0d, 0x0b, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x09, 0x11, 0x1a, 0x26, 0x31, 0x39,
+    0x3e, 0x42, 0x48, 0x5b, 0x73, 0x84, 0x99, 0x98, 0x96, 0x99, 0x94, 0x94, 0x8d, 0x8c, 0x91, 0x90,
+    0x91, 0x92, 0x97, 0x91, 0x87, 0x73, 0x5e, 0x53, 0x4a, 0x3e, 0x31, 0x24, 0x18, 0x0f, 0x09, 0x08,
+    0x08, 0x08, 0x08, 0x07, 0x09, 0x09, 0x09, 0x09, 0x08, 0x0a, 0x0d, 0x12, 0x20, 0x31, 0x28, 0x1e,
+    0x21, 0x33, 0x57, 0x60, 0x6a, 0x65, 0x6b, 0x6d, 0x69, 0x7f, 0x8b, 0x8d, 0x77, 0x71, 0x73, 0x70,
+    0xba, 0xb7, 0xb2, 0xd8, 0xd8, 0xc4, 0xa6, 0x90, 0x59, 0x2b, 0x18, 0x11, 0x0f, 0x0e, 0x0c, 0x0d,
+    0x0b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x0e, 0x11,
+    0x18, 0x20, 0x27, 0x2e, 0x36, 0x38, 0x3b, 0x41, 0x42, 0x46, 0x4b, 0x4d, 0x4f, 0x4d, 0x49, 0x48,
+    0x48, 0x46, 0x42, 0x3c, 0x37, 0x2f, 0x27, 0x1e, 0x16, 0x10, 0x0d, 0x09, 0x09, 0x08, 0x08, 0x08,
+    0x0a, 0x09, 0x08, 0x09, 0x08, 0x08, 0x09, 0x09, 0x0a, 0x0d, 0x12, 0x21, 0x26, 0x2d, 0x23, 0x20,
+    0x40, 0x5b, 0x64, 0x61, 0x64, 0x6c, 0x6c, 0x5e, 0x73, 0x7f, 0xa9, 0x83, 0x77, 0x6d, 0x71, 0x6c,
+    0xc2, 0xba, 0xbf, 0xd5, 0xc2, 0xd5, 0xce, 0xaa, 0x8b, 0x61, 0x2a, 0x1a, 0x13, 0x11, 0x10, 0x0d,
+    0x0d, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x0b, 0x0c,
+    0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0e, 0x13, 0x16, 0x18, 0x1a, 0x1b, 0x1c, 0x1d, 0x1d, 0x1b, 0x1a,
+    0x18, 0x15, 0x12, 0x0f, 0x0d, 0x09, 0x08, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08,
+    0x08, 0x09, 0x09, 0x0a, 0x08, 0x09, 0x0a, 0x0a, 0x0e, 0x12, 0x21, 0x28, 0x38, 0x29, 0x21, 0x2a,
+    0x55, 0x6b, 0x64, 0x6d, 0x70, 0x70, 0x71, 0x53, 0x75, 0x71, 0x7b, 0x7f, 0x63, 0x72, 0x6e, 0x68,
+    0xd2, 0xd5, 0xda, 0xba, 0xb6, 0xd5, 0xdb, 0xc7, 0x99, 0x7a, 0x55, 0x2d, 0x1e, 0x1c, 0x13, 0x12,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x0a, 0x0a, 0x0a, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0c,
+    0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0b,
+    0x09, 0x08, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x0a, 0x08, 0x08, 0x08, 0x0a, 0x09, 0x08, 0x09, 0x08,
+    0x08, 0x09, 0x09, 0x08, 0x09, 0x0a, 0x0c, 0x0e, 0x14, 0x1e, 0x29, 0x37, 0x2a, 0x27, 0x30, 0x48,
+    0x7c, 0x5f, 0x6d, 0x6a, 0x77, 0x61, 0x70, 0x5b, 0x67, 0x73, 0x78, 0x64, 0x71, 0x76, 0x6f, 0x71,
+    0xd7, 0xda, 0xd7, 0xcf, 0xb6, 0xdd, 0xce, 0xd7, 0xc2, 0xa3, 0x7f, 0x5d, 0x4a, 0x2f, 0x1a, 0x12,
+    0x10, 0x0f, 0x10, 0x0c, 0x0a, 0x0a, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x11, 0x10, 0x0d, 0x0f,
+    0x0c, 0x0a, 0x09, 0x08, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x09, 0x0c, 0x10, 0x19, 0x10, 0x0c,
+    0x0b, 0x0a, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08,
+    0x09, 0x09, 0x0a, 0x0a, 0x0b, 0x0c, 0x10, 0x14, 0x21, 0x31, 0x2c, 0x27, 0x28, 0x2e, 0x4a, 0x81,
+    0x67, 0x64, 0x70, 0x6c, 0x5d, 0x39, 0x56, 0x6a, 0x72, 0x76, 0x6b, 0x68, 0x70, 0x6a, 0x72, 0x73,
+};
+
+#endif //ELOQUENTTINYML_HOST_REGRESSION_PERSON_FRAMES_H
@@ -0,0 +1,656 @@
+#!/usr/bin/env python3
+"""
+Write goldens.txt from an independent reference implementation
+of the models the regression suite runs.
+
+The models are read straight from the repo's C headers and evaluated
+in numpy, replicating TFLM's reference kernels: float math for Iris
+and the LSTM, TFLM's integer arithmetic (per-channel requantization,
+gemmlowp fixed-point softmax) for person detection.
+Inputs and call order match regression/*.cpp.
+
+Usage: python3 reference.py [goldens.txt]
+Requires numpy only.
+"""
+import os
+import re
+import struct
+import sys
+
+import numpy as np
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, "..", "..", "..")
+
+
+# --- C headers -------------------------------------------------------------
+
+def c_array(path, name):
+    """Body of `name[...] = { ... };` in a C header"""
+    src = open(path).read()
+    match = re.search(r"\b%s\s*\[[^\]]*\][^=]*=\s*\{(.*?)\};" % re.escape(name), src, re.S)
+
+    if match is None:
+        raise KeyError("%s not found in %s" % (name, path))
+
+    return match.group(1)
+
+
+def c_bytes(path, name):
+    return bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{1,2})", c_array(path, name)))
+
+
+def c_floats(path, name):
+    return np.array([float(x.rstrip("f")) for x in re.findall(r"-?\d+\.\d*(?:e-?\d+)?f?", c_array(path, name))], dtype=np.float32)
+
+
+# --- flatbuffers -----------------------------------------------------------
+
+class Table:
+    """Read-only view of a flatbuffer table"""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        self.vtable = pos - struct.unpack_from("<i", buf, pos)[0]
+        self.vtable_length = struct.unpack_from("<H", buf, self.vtable)[0]
+
+    def offset(self, field):
+        o = 4 + 2 * field
+
+        return struct.unpack_from("<H", self.buf, self.vtable + o)[0] if o < self.vtable_length else 0
+
+    def scalar(self, field, fmt, default=0):
+        o = self.offset(field)
+
+        return struct.unpack_from("<" + fmt, self.buf, self.pos + o)[0] if o else default
+
+    def indirect(self, field):
+        o = self.offset(field)
+
+        if not o:
+            return None
+
+        return self.pos + o + struct.unpack_from("<I", self.buf, self.pos + o)[0]
+
+    def table(self, field):
+        p = self.indirect(field)
+
+        return Table(self.buf, p) if p is not None else None
+
+    def tables(self, field):
+        p = self.indirect(field)
+
+        if p is None:
+            return []
+
+        n = struct.unpack_from("<I", self.buf, p)[0]
+
+        return [Table(self.buf, p + 4 + 4 * i + struct.unpack_from("<I", self.buf, p + 4 + 4 * i)[0]) for i in range(n)]
+
+    def array(self, field, dtype):
+        p = self.indirect(field)
+
+        if p is None:
+            return None
+
+        n = struct.unpack_from("<I", self.buf, p)[0]
+
+        return np.frombuffer(self.buf, dtype=dtype, count=n, offset=p + 4)
+
+
+# schema.fbs
+AVERAGE_POOL_2D, CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED = 1, 3, 4, 9
+RESHAPE, SOFTMAX, UNIDIRECTIONAL_SEQUENCE_LSTM, STRIDED_SLICE = 22, 25, 44, 45
+DTYPES = {0: np.float32, 2: np.int32, 9: np.int8}
+NONE, RELU, RELU6, TANH = 0, 1, 3, 4
+
+
+class Tensor:
+    def __init__(self, table, buffers):
+        self.shape = tuple(table.array(0, "<i4"))
+        self.dtype = DTYPES[table.scalar(1, "b")]
+        self.variable = bool(table.scalar(5, "b"))
+        self.scale = None
+        self.zero_point = None
+        self.data = None
+
+        quantization = table.table(4)
+
+        if quantization is not None and quantization.array(2, "<f4") is not None:
+            self.scale = quantization.array(2, "<f4")
+            self.zero_point = quantization.array(3, "<i8")
+
+        raw = buffers[table.scalar(2, "I")].array(0, "u1")
+
+        if raw is not None and len(raw):
+            self.data = np.frombuffer(raw.tobytes(), dtype=self.dtype).reshape(self.shape)
+
+
+class Model:
+    """
+    Single-subgraph .tflite model.
+    Variable tensors (LSTM states) are zeroed by reset() and
+    otherwise persist across invoke(), as in TFLM
+    """
+
+    def __init__(self, buf):
+        root = Table(buf, struct.unpack_from("<I", buf, 0)[0])
+        buffers = root.tables(4)
+        subgraph = root.tables(2)[0]
+
+        self.codes = [max(code.scalar(0, "b"), code.scalar(3, "i")) for code in root.tables(1)]
+        self.tensors = [Tensor(t, buffers) for t in subgraph.tables(0)]
+        self.inputs = list(subgraph.array(1, "<i4"))
+        self.outputs = list(subgraph.array(2, "<i4"))
+        self.ops = subgraph.tables(3)
+        self.values = {}
+        self.reset()
+
+    def reset(self):
+        for i, tensor in enumerate(self.tensors):
+            if tensor.variable:
+                self.values[i] = np.zeros(tensor.shape, dtype=tensor.dtype)
+
+    def value(self, i):
+        return self.tensors[i].data if self.tensors[i].data is not None else self.values[i]
+
+    def invoke(self, x):
+        self.values[self.inputs[0]] = np.asarray(x, dtype=self.tensors[self.inputs[0]].dtype).reshape(self.tensors[self.inputs[0]].shape)
+
+        for op in self.ops:
+            code = self.codes[op.scalar(0, "I")]
+            inputs = list(op.array(1, "<i4"))
+            output = op.array(2, "<i4")[0]
+            options = op.table(4)
+            kernel = KERNELS[code]
+
+            self.values[output] = kernel(self, inputs, output, options).reshape(self.tensors[output].shape)
+
+        return self.values[self.outputs[0]].reshape(-1)
+
+
+# --- float kernels ---------------------------------------------------------
+
+def activate(x, activation):
+    if activation == RELU:
+        return np.maximum(x, 0)
+
+    if activation == RELU6:
+        return np.clip(x, 0, 6)
+
+    if activation == TANH:
+        return np.tanh(x)
+
+    assert activation == NONE, activation
+
+    return x
+
+
+def sigmoid(x):
+    return 1 / (1 + np.exp(-x))
+
+
+def fully_connected(model, inputs, output, options):
+    x = model.value(inputs[0]).astype(np.float64)
+    w = model.value(inputs[1]).astype(np.float64)
+    x = x.reshape(-1, w.shape[1])
+    y = x @ w.T
+
+    if len(inputs) > 2 and inputs[2] >= 0:
+        y = y + model.value(inputs[2])
+
+    return activate(y, options.scalar(0, "b")).astype(np.float32)
+
+
+def softmax(model, inputs, output, options):
+    if model.tensors[inputs[0]].dtype == np.int8:
+        return softmax_int8(model, inputs, output, options)
+
+    beta = options.scalar(0, "f", 1.0)
+    x = model.value(inputs[0]).astype(np.float64)
+    e = np.exp((x - x.max(axis=-1, keepdims=True)) * beta)
+
+    return (e / e.sum(axis=-1, keepdims=True)).astype(np.float32)
+
+
+def strided_slice(model, inputs, output, options):
+    x = model.value(inputs[0])
+    begin, end, strides = (model.value(i) for i in inputs[1:4])
+    begin_mask, end_mask = options.scalar(0, "i"), options.scalar(1, "i")
+    shrink_mask = options.scalar(4, "i")
+    index = []
+
+    for axis in range(x.ndim):
+        if shrink_mask & (1 << axis):
+            index.append(int(begin[axis]))
+            continue
+
+        start = None if begin_mask & (1 << axis) else int(begin[axis])
+        stop = None if end_mask & (1 << axis) else int(end[axis])
+        index.append(slice(start, stop, int(strides[axis])))
+
+    return np.ascontiguousarray(x[tuple(index)])
+
+
+def lstm(model, inputs, output, options):
+    """
+    UNIDIRECTIONAL_SEQUENCE_LSTM without peepholes, projection
+    or layer norm; states are updated in place
+    """
+    activation = options.scalar(0, "b")
+    cell_clip = options.scalar(1, "f")
+    time_major = options.scalar(3, "b")
+    x = model.value(inputs[0]).astype(np.float64)
+    w = [model.value(i).astype(np.float64) for i in inputs[1:5]]
+    r = [model.value(i).astype(np.float64) for i in inputs[5:9]]
+    b = [model.value(i).astype(np.float64) for i in inputs[12:16]]
+    h = model.values[inputs[18]].astype(np.float64).reshape(-1)
+    c = model.values[inputs[19]].astype(np.float64).reshape(-1)
+
+    assert all(i < 0 for i in inputs[9:12] + inputs[16:18] + inputs[20:24]), "unsupported LSTM variant"
+
+    if time_major:
+        x = x.transpose(1, 0, 2)
+
+    y = np.zeros(x.shape[:2] + (h.shape[0],))
+
+    for t in range(x.shape[1]):
+        xt = x[0, t]
+        gates = [w[k] @ xt + r[k] @ h + b[k] for k in range(4)]
+        c = sigmoid(gates[1]) * c + sigmoid(gates[0]) * activate(gates[2], activation)
+
+        if cell_clip > 0:
+            c = np.clip(c, -cell_clip, cell_clip)
+
+        h = sigmoid(gates[3]) * activate(c, activation)
+        y[0, t] = h
+
+    model.values[inputs[18]] = h.astype(np.float32).reshape(model.tensors[inputs[18]].shape)
+    model.values[inputs[19]] = c.astype(np.float32).reshape(model.tensors[inputs[19]].shape)
+
+    return (y.transpose(1, 0, 2) if time_major else y).astype(np.float32)
+
+
+# --- TFLM integer arithmetic -----------------------------------------------
+
+INT32_MIN, INT32_MAX = -(1 << 31), (1 << 31) - 1
+
+
+def trunc_div(a, b):
+    """C integer division"""
+    q = abs(a) // abs(b)
+
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def srdhm(a, b):
+    """gemmlowp SaturatingRoundingDoublingHighMul"""
+    if a == b == INT32_MIN:
+        return INT32_MAX
+
+    ab = a * b
+    nudge = (1 << 30) if ab >= 0 else 1 - (1 << 30)
+
+    return trunc_div(ab + nudge, 1 << 31)
+
+
+def rdbpot(x, exponent):
+    """gemmlowp RoundingDivideByPOT"""
+    mask = (1 << exponent) - 1
+    remainder = x & mask
+    threshold = (mask >> 1) + (1 if x < 0 else 0)
+
+    return (x >> exponent) + (1 if remainder > threshold else 0)
+
+
+def sat_shift_left(x, exponent):
+    """gemmlowp SaturatingRoundingMultiplyByPOT, positive exponent"""
+    if x > (INT32_MAX >> exponent):
+        return INT32_MAX
+
+    if x < (INT32_MIN >> exponent):
+        return INT32_MIN
+
+    return x << exponent
+
+
+def round_away(x):
+    """std::round / roundf: halves away from zero (np.round goes to even)"""
+    x = np.asarray(x, dtype=np.float64)
+
+    return np.sign(x) * np.floor(np.abs(x) + 0.5)
+
+
+def wrap32(x):
+    return (x + (1 << 31)) % (1 << 32) - (1 << 31)
+
+
+def quantize_multiplier(real):
+    """tflite::QuantizeMultiplier"""
+    if real == 0:
+        return 0, 0
+
+    q, shift = np.frexp(real)
+    fixed = int(round_away(q * (1 << 31)))
+
+    if fixed == (1 << 31):
+        fixed //= 2
+        shift += 1
+
+    if shift < -31:
+        return 0, 0
+
+    return fixed, int(shift)
+
+
+def multiply_by_quantized_multiplier(x, multiplier, shift):
+    left = shift if shift > 0 else 0
+    right = 0 if shift > 0 else -shift
+
+    return rdbpot(srdhm(x * (1 << left), multiplier), right)
+
+
+def requantize(acc, multipliers, shifts, zero_point, low, high):
+    """Per-channel requantization of int32 accumulators (last axis)"""
+    out = np.empty(acc.shape, dtype=np.int64)
+    flat, flat_out = acc.reshape(-1, acc.shape[-1]), out.reshape(-1, acc.shape[-1])
+
+    for c in range(acc.shape[-1]):
+        m, s = multipliers[c], shifts[c]
+        flat_out[:, c] = [multiply_by_quantized_multiplier(int(v), m, s) for v in flat[:, c]]
+
+    return np.clip(out + zero_point, low, high).astype(np.int8)
+
+
+def quantized_activation(tensor, activation):
+    """tflite::CalculateActivationRangeQuantized"""
+    scale, zero_point = float(tensor.scale[0]), int(tensor.zero_point[0])
+    quantize = lambda f: zero_point + int(round_away(np.float32(f) / np.float32(scale)))
+
+    if activation == RELU:
+        return max(-128, quantize(0)), 127
+
+    if activation == RELU6:
+        return max(-128, quantize(0)), min(127, quantize(6))
+
+    assert activation == NONE, activation
+
+    return -128, 127
+
+
+def same_padding(size, filter_size, stride, dilation, padding):
+    out = (size + stride - 1) // stride if padding == 0 else (size - (filter_size - 1) * dilation - 1 + stride) // stride
+    total = max((out - 1) * stride + (filter_size - 1) * dilation + 1 - size, 0)
+
+    return out, total // 2
+
+
+def channel_multipliers(model, inputs, output):
+    x, w, y = model.tensors[inputs[0]], model.tensors[inputs[1]], model.tensors[output]
+    channels = w.shape[0] if len(w.scale) > 1 and w.shape[0] == y.shape[-1] else y.shape[-1]
+    scales = w.scale if len(w.scale) > 1 else np.repeat(w.scale, channels)
+    quantized = [quantize_multiplier(float(x.scale[0]) * float(s) / float(y.scale[0])) for s in scales]
+
+    return [q[0] for q in quantized], [q[1] for q in quantized]
+
+
+def patches(x, fh, fw, stride_h, stride_w, dilation_h, dilation_w, padding, pad_value):
+    """im2col: (1, oh, ow, fh, fw, c) windows, out-of-bounds taps set to pad_value"""
+    _, h, w, c = x.shape
+    oh, pad_h = same_padding(h, fh, stride_h, dilation_h, padding)
+    ow, pad_w = same_padding(w, fw, stride_w, dilation_w, padding)
+    out = np.full((1, oh, ow, fh, fw, c), pad_value, dtype=np.int64)
+
+    for i in range(fh):
+        for j in range(fw):
+            for oy in range(oh):
+                iy = oy * stride_h - pad_h + i * dilation_h
+
+                if 0 <= iy < h:
+                    ix = np.arange(ow) * stride_w - pad_w + j * dilation_w
+                    valid = (ix >= 0) & (ix < w)
+                    out[0, oy, valid, i, j] = x[0, iy, ix[valid]]
+
+    return out
+
+
+def conv_int8(model, inputs, output, options):
+    padding = options.scalar(0, "b")
+    stride_w, stride_h = options.scalar(1, "i"), options.scalar(2, "i")
+    activation = options.scalar(3, "b")
+    dilation_w, dilation_h = options.scalar(4, "i", 1), options.scalar(5, "i", 1)
+    x = model.value(inputs[0]).astype(np.int64)
+    w = model.value(inputs[1]).astype(np.int64)
+    bias = model.value(inputs[2]).astype(np.int64)
+    offset = -int(model.tensors[inputs[0]].zero_point[0])
+    windows = patches(x + offset, w.shape[1], w.shape[2], stride_h, stride_w, dilation_h, dilation_w, padding, 0)
+    acc = np.einsum("nyxijc,oijc->nyxo", windows, w) + bias
+    multipliers, shifts = channel_multipliers(model, inputs, output)
+    low, high = quantized_activation(model.tensors[output], activation)
+
+    return requantize(acc, multipliers, shifts, int(model.tensors[output].zero_point[0]), low, high)
+
+
+def depthwise_int8(model, inputs, output, options):
+    padding = options.scalar(0, "b")
+    stride_w, stride_h = options.scalar(1, "i"), options.scalar(2, "i")
+    multiplier = options.scalar(3, "i")
+    activation = options.scalar(4, "b")
+    dilation_w, dilation_h = options.scalar(5, "i", 1), options.scalar(6, "i", 1)
+    x = model.value(inputs[0]).astype(np.int64)
+    w = model.value(inputs[1]).astype(np.int64)
+    bias = model.value(inputs[2]).astype(np.int64)
+    offset = -int(model.tensors[inputs[0]].zero_point[0])
+    windows = patches(x + offset, w.shape[1], w.shape[2], stride_h, stride_w, dilation_h, dilation_w, padding, 0)
+    # output channel k reads input channel k / multiplier
+    windows = np.repeat(windows, multiplier, axis=-1)
+    acc = np.einsum("nyxijc,ijc->nyxc", windows, w[0]) + bias
+    multipliers, shifts = channel_multipliers(model, inputs, output)
+    low, high = quantized_activation(model.tensors[output], activation)
+
+    return requantize(acc, multipliers, shifts, int(model.tensors[output].zero_point[0]), low, high)
+
+
+def average_pool_int8(model, inputs, output, options):
+    padding = options.scalar(0, "b")
+    stride_w, stride_h = options.scalar(1, "i"), options.scalar(2, "i")
+    fw, fh = options.scalar(3, "i"), options.scalar(4, "i")
+    activation = options.scalar(5, "b")
+    x = model.value(inputs[0]).astype(np.int64)
+    _, h, w, c = x.shape
+    oh, pad_h = same_padding(h, fh, stride_h, 1, padding)
+    ow, pad_w = same_padding(w, fw, stride_w, 1, padding)
+    low, high = quantized_activation(model.tensors[output], activation)
+    y = np.empty((1, oh, ow, c), dtype=np.int8)
+
+    for oy in range(oh):
+        for ox in range(ow):
+            y0, x0 = oy * stride_h - pad_h, ox * stride_w - pad_w
+            window = x[0, max(y0, 0):min(y0 + fh, h), max(x0, 0):min(x0 + fw, w)]
+            count = window.shape[0] * window.shape[1]
+
+            for k in range(c):
+                acc = int(window[:, :, k].sum())
+                acc = trunc_div(acc + count // 2, count) if acc > 0 else trunc_div(acc - count // 2, count)
+                y[0, oy, ox, k] = min(max(acc, low), high)
+
+    return y
+
+
+def reshape(model, inputs, output, options):
+    return model.value(inputs[0]).copy()
+
+
+# gemmlowp fixed point, int32 raw values
+
+def exp_on_interval_between_negative_one_quarter_and_0_excl(a):
+    constant_term = 1895147668
+    constant_1_over_3 = 715827883
+    x = wrap32(a + (1 << 28))
+    x2 = srdhm(x, x)
+    x3 = srdhm(x2, x)
+    x4 = srdhm(x2, x2)
+    x4_over_4 = rdbpot(x4, 2)
+    poly = rdbpot(wrap32(srdhm(wrap32(x4_over_4 + x3), constant_1_over_3) + x2), 1)
+
+    return wrap32(constant_term + srdhm(constant_term, wrap32(x + poly)))
+
+
+def exp_on_negative_values(a, integer_bits=5):
+    fractional_bits = 31 - integer_bits
+    one_quarter = 1 << (fractional_bits - 2)
+    a_mod_quarter_minus_one_quarter = wrap32((a & (one_quarter - 1)) - one_quarter)
+    result = exp_on_interval_between_negative_one_quarter_and_0_excl(sat_shift_left(a_mod_quarter_minus_one_quarter, integer_bits))
+    remainder = wrap32(a_mod_quarter_minus_one_quarter - a)
+    barrel = [(-2, 1672461947), (-1, 1302514674), (0, 790015084), (1, 290630308), (2, 39332535), (3, 720401), (4, 242)]
+
+    for exponent, multiplier in barrel:
+        if integer_bits > exponent and remainder & (1 << (fractional_bits + exponent)):
+            result = srdhm(result, multiplier)
+
+    return INT32_MAX if a == 0 else result
+
+
+def one_over_one_plus_x_for_x_in_0_1(a):
+    total = a + INT32_MAX
+    half_denominator = trunc_div(total + (1 if total >= 0 else -1), 2)
+    x = wrap32(1515870810 + srdhm(half_denominator, -1010580540))
+
+    for _ in range(3):
+        one_minus = wrap32((1 << 29) - srdhm(half_denominator, x))
+        x = wrap32(x + sat_shift_left(srdhm(x, one_minus), 2))
+
+    return sat_shift_left(x, 1)
+
+
+def reciprocal(x, integer_bits):
+    """tflite::GetReciprocal"""
+    headroom_plus_one = 32 - int(x).bit_length() if x > 0 else 0
+    bits_over_unit = integer_bits - headroom_plus_one
+    shifted_minus_one = wrap32(((x << headroom_plus_one) & 0xFFFFFFFF) - (1 << 31))
+
+    return one_over_one_plus_x_for_x_in_0_1(shifted_minus_one), bits_over_unit
+
+
+def softmax_int8(model, inputs, output, options):
+    """reference_ops::Softmax for int8 in / int8 out"""
+    beta = options.scalar(0, "f", 1.0)
+    scaled_diff_integer_bits, accumulation_integer_bits = 5, 12
+    real = min(float(beta) * float(model.tensors[inputs[0]].scale[0]) * (1 << (31 - scaled_diff_integer_bits)), (1 << 31) - 1.0)
+    multiplier, left_shift = quantize_multiplier(real)
+    radius = int(np.floor(((1 << scaled_diff_integer_bits) - 1) * (1 << (31 - scaled_diff_integer_bits)) / (1 << left_shift)))
+    diff_min = -radius
+    x = model.value(inputs[0]).astype(np.int64).reshape(-1, model.tensors[inputs[0]].shape[-1])
+    y = np.empty(x.shape, dtype=np.int8)
+
+    for row, values in enumerate(x):
+        peak = int(values.max())
+        exps = []
+
+        for v in values:
+            diff = int(v) - peak
+            exps.append(exp_on_negative_values(srdhm(diff * (1 << left_shift), multiplier)) if diff >= diff_min else None)
+
+        total = 0
+
+        for e in exps:
+            if e is not None:
+                total = wrap32(total + rdbpot(e, accumulation_integer_bits))
+
+        scale, bits_over_unit = reciprocal(total, accumulation_integer_bits)
+
+        for k, e in enumerate(exps):
+            if e is None:
+                y[row, k] = -128
+                continue
+
+            unsaturated = rdbpot(srdhm(scale, e), bits_over_unit + 31 - 8)
+            y[row, k] = min(max(unsaturated - 128, -128), 127)
+
+    return y
+
+
+KERNELS = {
+    AVERAGE_POOL_2D: average_pool_int8,
+    CONV_2D: conv_int8,
+    DEPTHWISE_CONV_2D: depthwise_int8,
+    FULLY_CONNECTED: fully_connected,
+    RESHAPE: reshape,
+    SOFTMAX: softmax,
+    UNIDIRECTIONAL_SEQUENCE_LSTM: lstm,
+    STRIDED_SLICE: strided_slice,
+}
+
+
+# --- regression inputs -----------------------------------------------------
+
+def quantize_int8(x, scale, zero_point):
+    """roundf(x / scale) + zero point, clamped to int8"""
+    q = round_away(np.float32(x) / np.float32(scale)) + zero_point
+
+    return np.clip(q, -128, 127).astype(np.int8)
+
+
+def person_scores(model, frame):
+    """personScore() / notPersonScore() after run() on a 96x96 gray frame"""
+    y = model.invoke(np.asarray(frame, dtype=np.int16) - 128)
+
+    return [128 + int(y[1]), 128 + int(y[0])]
+
+
+def goldens():
+    out = {}
+
+    iris_h = os.path.join(ROOT, "examples", "IrisExample", "irisModel.h")
+    iris = Model(c_bytes(iris_h, "irisModel"))
+
+    for name in ("x0", "x1", "x2"):
+        out["iris." + name] = iris.invoke(c_floats(iris_h, name))
+
+    lstm_h = os.path.join(ROOT, "examples", "LSTMExample", "tfModel.h")
+    lstm_model = Model(c_bytes(lstm_h, "tfModel"))
+
+    # tf.reset() before each window
+    for name in ("idle", "horizontal", "vertical"):
+        lstm_model.reset()
+        out["lstm." + name] = lstm_model.invoke(c_floats(lstm_h, name))
+
+    person_h = os.path.join(ROOT, "src", "eloquent_tinyml", "zoo", "person_detection_model.h")
+    frames_h = os.path.join(HERE, "person_frames.h")
+    person = Model(c_bytes(person_h, "personDetectionModel"))
+    gradient = np.array([(i % 96) * 255 // 95 for i in range(96 * 96)])
+
+    out["person.flat"] = person_scores(person, np.full(96 * 96, 128))
+    out["person.gradient"] = person_scores(person, gradient)
+
+    for name in ("astronaut", "coffee"):
+        out["person." + name] = person_scores(person, np.frombuffer(c_bytes(frames_h, name), dtype=np.uint8))
+
+    # predictInt8() on the same float pattern as person_detection.cpp
+    x = np.array([((i * 37) % 301 - 150) / 100.0 for i in range(96 * 96)], dtype=np.float32)
+    input_tensor = person.tensors[person.inputs[0]]
+    output_tensor = person.tensors[person.outputs[0]]
+    y = person.invoke(quantize_int8(x, input_tensor.scale[0], input_tensor.zero_point[0]))
+    # outputs()[i] dequantizes
+    out["person.predictInt8"] = [float((np.float32(v) - output_tensor.zero_point[0]) * output_tensor.scale[0]) for v in y]
+
+    return out
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(HERE, "goldens.txt")
+
+    with open(path, "w") as f:
+        f.write("# Golden outputs: name value...\n")
+        f.write("# Written by reference.py from an independent numpy implementation\n")
+        f.write("# of the models: rerun it when a model or a regression input changes\n")
+
+        for name in sorted(goldens().items()):
+            f.write(name[0] + "".join(" %.6f" % v for v in name[1]) + "\n")
+
+    print("Wrote " + path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,219 @@
+#ifndef ELOQUENTTINYML_HOST_REGRESSION_SUITE_H
+#define ELOQUENTTINYML_HOST_REGRESSION_SUITE_H
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+#include <string>
+#include <eloquent_tinyml/benchmark.h>
+
+
+/**
+ * Golden-output and latency regression checks.
+ * In record mode, current outputs/latencies are written
+ * to the goldens/baseline files instead of being checked.
+ * Checks without a recorded entry are skipped (failed in strict mode)
+ */
+class Suite {
+public:
+    bool record;
+    bool strict;
+    float tolerance;
+    float threshold;
+    uint16_t failures;
+    uint16_t skipped;
+
+    /**
+     * Constructor
+     */
+    Suite() :
+        record(false),
+        strict(false),
+        tolerance(1e-3f),
+        threshold(0.2f),
+        failures(0),
+        skipped(0) {
+
+    }
+
+    /**
+     * Load goldens and baseline (ignored in record mode)
+     */
+    void load(const char *goldensPath, const char *baselinePath) {
+        _goldensPath = goldensPath;
+        _baselinePath = baselinePath;
+
+        if (!record) {
+            read(goldensPath, _goldens);
+            read(baselinePath, _baseline);
+        }
+    }
+
+    /**
+     * Write goldens and baseline (record mode only)
+     */
+    void save() {
+        if (record) {
+            write(_goldensPath.c_str(), _goldens);
+            write(_baselinePath.c_str(), _baseline);
+        }
+    }
+
+    /**
+     * Check predicted class
+     */
+    void expectClass(const char *name, uint8_t expected, uint8_t actual) {
+        if (expected == actual)
+            return pass(name, "class");
+
+        fail(name, String("expected class ") + expected + ", got " + actual);
+    }
+
+    /**
+     * Check generic condition
+     */
+    void expect(const char *name, bool ok, const String& reason) {
+        if (ok)
+            return pass(name, "check");
+
+        fail(name, reason);
+    }
+
+    /**
+     * Check outputs against goldens, within tolerance
+     */
+    void expectOutputs(const char *name, const float *y, uint32_t length) {
+        if (record) {
+            _goldens[name] = std::vector<float>(y, y + length);
+            return;
+        }
+
+        auto it = _goldens.find(name);
+
+        if (it == _goldens.end())
+            return missing(name, "no golden (run with --record)");
+
+        if (it->second.size() != length)
+            return fail(name, String("expected ") + it->second.size() + " outputs, got " + length);
+
+        for (uint32_t i = 0; i < length; i++)
+            if (fabs(it->second[i] - y[i]) > tolerance)
+                return fail(name, String("output ") + i + " is " + String(y[i], 6) + ", golden is " + String(it->second[i], 6));
+
+        pass(name, "outputs");
+    }
+
+    /**
+     * Check latency percentiles against baseline.
+     * Fails if any percentile got slower than (1 + threshold) * baseline
+     */
+    template<typename Stats>
+    void expectLatency(const char *name, const Stats& stats) {
+        const std::vector<float> current = { stats.median(), stats.p95(), stats.p99() };
+
+        printf("  %s: ", name);
+        stats.print(Serial);
+
+        if (record) {
+            _baseline[name] = current;
+            return;
+        }
+
+        auto it = _baseline.find(name);
+
+        if (it == _baseline.end() || it->second.size() != current.size())
+            return missing(name, "no baseline (run with --record)");
+
+        const char *labels[] = { "median", "p95", "p99" };
+
+        for (uint8_t i = 0; i < current.size(); i++)
+            if (current[i] > it->second[i] * (1 + threshold))
+                return fail(name, String(labels[i]) + " is " + String(current[i]) + "us, baseline is " + String(it->second[i]) + "us");
+
+        pass(name, "latency");
+    }
+
+    /**
+     * Record failure
+     */
+    void fail(const char *name, const String& reason) {
+        failures += 1;
+        printf("FAIL %s: %s\n", name, reason.c_str());
+    }
+
+    /**
+     * Record a check that has nothing to compare against
+     */
+    void missing(const char *name, const char *reason) {
+        if (strict)
+            return fail(name, reason);
+
+        skipped += 1;
+        printf("skip %s: %s\n", name, reason);
+    }
+
+protected:
+    std::string _goldensPath;
+    std::string _baselinePath;
+    std::map<std::string, std::vector<float>> _goldens;
+    std::map<std::string, std::vector<float>> _baseline;
+
+    /**
+     * Record success
+     */
+    void pass(const char *name, const char *what) {
+        printf("ok   %s: %s\n", name, what);
+    }
+
+    /**
+     * Read "name v0 v1 ..." lines
+     */
+    static void read(const char *path, std::map<std::string, std::vector<float>>& dest) {
+        FILE *f = fopen(path, "r");
+        char line[4096];
+
+        if (f == nullptr)
+            return;
+
+        while (fgets(line, sizeof(line), f) != nullptr) {
+            char *token = strtok(line, " \t\r\n");
+
+            if (token == nullptr || token[0] == '#')
+                continue;
+
+            std::vector<float>& values = dest[token];
+
+            while ((token = strtok(nullptr, " \t\r\n")) != nullptr)
+                values.push_back(atof(token));
+        }
+
+        fclose(f);
+    }
+
+    /**
+     * Write "name v0 v1 ..." lines
+     */
+    static void write(const char *path, const std::map<std::string, std::vector<float>>& src) {
+        FILE *f = fopen(path, "w");
+
+        if (f == nullptr) {
+            fprintf(stderr, "Cannot write %s\n", path);
+            return;
+        }
+
+        fputs("# name value... (written by regression --record)\n", f);
+
+        for (auto& entry : src) {
+            fputs(entry.first.c_str(), f);
+
+            for (float v : entry.second)
+                fprintf(f, " %.6f", v);
+
+            fputc('\n', f);
+        }
+
+        fclose(f);
+    }
+};
+
+#endif //ELOQUENTTINYML_HOST_REGRESSION_SUITE_H
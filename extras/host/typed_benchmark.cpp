@@ -0,0 +1,48 @@
+/**
+ * Benchmark Sequential with runtime shapes against
+ * the compile-time variant (NumIn, NumOut, InT, OutT)
+ * on the Iris model, where the wrapper overhead is
+ * comparable to Invoke().
+ * Usage: typed_benchmark [iterations]
+ */
+#include <Arduino.h>
+#include "irisModel.h"
+#include <tflm_host.h>
+#include <eloquent_tinyml.h>
+
+#define ARENA_SIZE 2000
+
+
+/**
+ * Time predict() + copyOutputs()
+ */
+template<typename TF>
+void measure(const char *name, TF& tf, uint16_t iterations) {
+    Eloquent::Extra::Time::StatBenchmark<1000> stats;
+    float y[TF_NUM_OUTPUTS];
+
+    if (!tf.begin(irisModel).isOk()) {
+        printf("%-8s %s\n", name, tf.exception.toCString());
+        return;
+    }
+
+    stats.run([&]() {
+        tf.predict(x0);
+        tf.copyOutputs(y);
+    }, iterations);
+
+    printf("%-8s ", name);
+    stats.print(Serial);
+}
+
+
+int main(int argc, char **argv) {
+    const uint16_t iterations = argc > 1 ? atoi(argv[1]) : 1000;
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE> dynamic;
+    static Eloquent::TF::Sequential<TF_NUM_OPS, ARENA_SIZE, TF_NUM_INPUTS, TF_NUM_OUTPUTS, float, float> typed;
+
+    measure("dynamic", dynamic, iterations);
+    measure("typed", typed, iterations);
+
+    return 0;
+}
@@ -0,0 +1,448 @@
+#ifndef ELOQUENTTINYML_ARENA_H
+#define ELOQUENTTINYML_ARENA_H
+
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#endif
+
+// alignment of the tensor arena, in bytes
+// (16 suits ESP-NN and CMSIS-NN vector kernels)
+#ifndef TF_ARENA_ALIGNMENT
+#define TF_ARENA_ALIGNMENT 16
+#endif
+
+// TFLM's memory planner aligns tensors to 16 bytes inside the arena:
+// a coarser arena alignment would not carry over to the tensors
+static_assert(TF_ARENA_ALIGNMENT > 0 && (TF_ARENA_ALIGNMENT & (TF_ARENA_ALIGNMENT - 1)) == 0, "TF_ARENA_ALIGNMENT must be a power of 2");
+static_assert(TF_ARENA_ALIGNMENT <= 16, "TF_ARENA_ALIGNMENT can't exceed 16: TFLM only aligns tensors to 16 bytes");
+
+// smallest arena tried by Sequential::findMinArenaSize()
+#ifndef TF_MIN_ARENA_SIZE
+#define TF_MIN_ARENA_SIZE 512
+#endif
+
+
+namespace Eloquent {
+    namespace TF {
+        namespace Arena {
+            /**
+             * Round pointer up to TF_ARENA_ALIGNMENT
+             */
+            inline uint8_t* align(uint8_t *ptr) {
+                const uintptr_t p = (uintptr_t) ptr;
+
+                return (uint8_t*) ((p + TF_ARENA_ALIGNMENT - 1) & ~((uintptr_t) TF_ARENA_ALIGNMENT - 1));
+            }
+
+            /**
+             * Arena embedded in the Sequential object
+             * (static/global objects end up in internal SRAM)
+             */
+            template<size_t arenaSize>
+            class Internal {
+            public:
+
+                /**
+                 * Nothing to allocate
+                 */
+                bool alloc() {
+                    return true;
+                }
+
+                /**
+                 * Nothing to release
+                 */
+                void free() {
+                }
+
+                /**
+                 * Arena is not shared: always valid
+                 */
+                inline bool acquire(void*, void (*)(void*)) {
+                    return true;
+                }
+
+                /**
+                 * Get arena buffer
+                 */
+                inline uint8_t* data() {
+                    return _data;
+                }
+
+                /**
+                 * Get arena size
+                 */
+                inline size_t size() const {
+                    return arenaSize;
+                }
+
+            protected:
+                alignas(TF_ARENA_ALIGNMENT) uint8_t _data[arenaSize];
+            };
+
+            /**
+             * Arena allocated on the heap at begin()
+             */
+            template<size_t arenaSize>
+            class Heap {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                Heap() :
+                    _raw(nullptr),
+                    _data(nullptr) {
+
+                }
+
+                Heap(const Heap&) = delete;
+                Heap& operator=(const Heap&) = delete;
+
+                /**
+                 * Destructor
+                 */
+                ~Heap() {
+                    free();
+                }
+
+                /**
+                 * Allocate arena (once)
+                 */
+                bool alloc() {
+                    if (_raw == nullptr)
+                        _raw = (uint8_t*) malloc(arenaSize + TF_ARENA_ALIGNMENT - 1);
+
+                    _data = _raw == nullptr ? nullptr : align(_raw);
+
+                    return _data != nullptr;
+                }
+
+                /**
+                 * Release arena
+                 */
+                void free() {
+                    ::free(_raw);
+                    _raw = nullptr;
+                    _data = nullptr;
+                }
+
+                /**
+                 * Arena is not shared: always valid
+                 */
+                inline bool acquire(void*, void (*)(void*)) {
+                    return true;
+                }
+
+                /**
+                 * Get arena buffer
+                 */
+                inline uint8_t* data() {
+                    return _data;
+                }
+
+                /**
+                 * Get arena size
+                 */
+                inline size_t size() const {
+                    return arenaSize;
+                }
+
+            protected:
+                uint8_t *_raw;
+                uint8_t *_data;
+            };
+
+            /**
+             * Arena allocated in external PSRAM at begin().
+             * Falls back to the regular heap on boards without heap_caps
+             */
+            template<size_t arenaSize>
+            class PSRAM : public Heap<arenaSize> {
+            public:
+
+                /**
+                 * Destructor
+                 */
+                ~PSRAM() {
+                    free();
+                }
+
+                /**
+                 * Allocate arena (once)
+                 */
+                bool alloc() {
+                    if (this->_raw == nullptr) {
+                    #if defined(ESP32)
+                        this->_raw = (uint8_t*) heap_caps_malloc(arenaSize + TF_ARENA_ALIGNMENT - 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+                    #else
+                        this->_raw = (uint8_t*) malloc(arenaSize + TF_ARENA_ALIGNMENT - 1);
+                    #endif
+                    }
+
+                    this->_data = this->_raw == nullptr ? nullptr : align(this->_raw);
+
+                    return this->_data != nullptr;
+                }
+
+                /**
+                 * Release arena
+                 */
+                void free() {
+                #if defined(ESP32)
+                    heap_caps_free(this->_raw);
+                #else
+                    ::free(this->_raw);
+                #endif
+                    this->_raw = nullptr;
+                    this->_data = nullptr;
+                }
+            };
+
+            /**
+             * Arena provided by the caller with use(buffer, size).
+             * The template size is ignored
+             */
+            template<size_t arenaSize>
+            class External {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                External() :
+                    _data(nullptr),
+                    _size(0) {
+
+                }
+
+                /**
+                 * Set arena buffer. Must be called before begin().
+                 * A misaligned buffer is aligned forward (and shrunk)
+                 */
+                void use(uint8_t *buffer, size_t size) {
+                    uint8_t *aligned = align(buffer);
+                    const size_t skip = aligned - buffer;
+
+                    _data = skip < size ? aligned : nullptr;
+                    _size = skip < size ? size - skip : 0;
+                }
+
+                /**
+                 * Test if buffer has been set
+                 */
+                bool alloc() {
+                    return _data != nullptr && _size > 0;
+                }
+
+                /**
+                 * Buffer is owned by the caller
+                 */
+                void free() {
+                }
+
+                /**
+                 * Arena is not shared: always valid
+                 */
+                inline bool acquire(void*, void (*)(void*)) {
+                    return true;
+                }
+
+                /**
+                 * Get arena buffer
+                 */
+                inline uint8_t* data() {
+                    return _data;
+                }
+
+                /**
+                 * Get arena size
+                 */
+                inline size_t size() const {
+                    return _size;
+                }
+
+            protected:
+                uint8_t *_data;
+                size_t _size;
+            };
+
+            /**
+             * Single arena shared by many Sequential instances that never
+             * run at the same time. When an instance claims the pool,
+             * the previous owner drops its interpreter and the new one
+             * re-plans its tensors in the shared buffer
+             */
+            class Pool {
+            public:
+                uint32_t switches;
+
+                /**
+                 * Constructor
+                 */
+                Pool(uint8_t *buffer, size_t size) :
+                    switches(0),
+                    _data(nullptr),
+                    _size(0),
+                    _owner(nullptr),
+                    _onEvict(nullptr) {
+                    uint8_t *aligned = align(buffer);
+                    const size_t skip = aligned - buffer;
+
+                    // a buffer smaller than the alignment skip holds nothing
+                    if (buffer != nullptr && skip < size) {
+                        _data = aligned;
+                        _size = size - skip;
+                    }
+                }
+
+                /**
+                 * Claim the pool.
+                 * @return true if owner already held it (its tensors are still valid)
+                 */
+                bool claim(void *owner, void (*onEvict)(void*)) {
+                    if (_owner == owner)
+                        return true;
+
+                    if (_owner != nullptr && _onEvict != nullptr)
+                        _onEvict(_owner);
+
+                    _owner = owner;
+                    _onEvict = onEvict;
+                    switches += 1;
+
+                    return false;
+                }
+
+                /**
+                 * Give up the pool, if owned
+                 */
+                void unclaim(void *owner) {
+                    if (_owner != owner)
+                        return;
+
+                    _owner = nullptr;
+                    _onEvict = nullptr;
+                }
+
+                /**
+                 * Get shared buffer
+                 */
+                inline uint8_t* data() {
+                    return _data;
+                }
+
+                /**
+                 * Get shared buffer size
+                 */
+                inline size_t size() const {
+                    return _size;
+                }
+
+            protected:
+                uint8_t *_data;
+                size_t _size;
+                void *_owner;
+                void (*_onEvict)(void*);
+            };
+
+            /**
+             * Pool with statically allocated buffer.
+             * Size it as the largest arena among the models that share it
+             */
+            template<size_t poolSize>
+            class StaticPool : public Pool {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                StaticPool() :
+                    Pool(_buffer, poolSize) {
+
+                }
+
+            protected:
+                alignas(TF_ARENA_ALIGNMENT) uint8_t _buffer[poolSize];
+            };
+
+            /**
+             * Arena borrowed from a Pool (set with use(pool)).
+             * The template size is ignored
+             */
+            template<size_t arenaSize>
+            class Pooled {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                Pooled() :
+                    _pool(nullptr),
+                    _owner(nullptr) {
+
+                }
+
+                /**
+                 * Destructor.
+                 * The pool must not evict a dead owner
+                 */
+                ~Pooled() {
+                    free();
+                }
+
+                /**
+                 * Set pool. Must be called before begin()
+                 */
+                void use(Pool& pool) {
+                    _pool = &pool;
+                }
+
+                /**
+                 * Test if a (non empty) pool has been set
+                 */
+                bool alloc() {
+                    return _pool != nullptr && _pool->data() != nullptr;
+                }
+
+                /**
+                 * Give the pool back
+                 */
+                void free() {
+                    if (_pool != nullptr)
+                        _pool->unclaim(_owner);
+                }
+
+                /**
+                 * Claim the pool for owner
+                 * @return false if owner must re-plan its tensors
+                 */
+                inline bool acquire(void *owner, void (*onEvict)(void*)) {
+                    _owner = owner;
+
+                    return _pool->claim(owner, onEvict);
+                }
+
+                /**
+                 * Get arena buffer
+                 */
+                inline uint8_t* data() {
+                    return _pool == nullptr ? nullptr : _pool->data();
+                }
+
+                /**
+                 * Get arena size
+                 */
+                inline size_t size() const {
+                    return _pool == nullptr ? 0 : _pool->size();
+                }
+
+            protected:
+                Pool *_pool;
+                void *_owner;
+            };
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_ARENA_H
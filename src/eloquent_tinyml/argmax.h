@@ -0,0 +1,75 @@
+#ifndef ELOQUENTTINYML_ARGMAX_H
+#define ELOQUENTTINYML_ARGMAX_H
+
+
+namespace Eloquent {
+    namespace TF {
+        namespace Kernels {
+            /**
+             * Get index of max element of float array
+             */
+            inline uint32_t argmax(const float *x, uint32_t length, float& maxValue) {
+                uint32_t idx = 0;
+
+                maxValue = x[0];
+
+                for (uint32_t i = 1; i < length; i++) {
+                    if (x[i] > maxValue) {
+                        idx = i;
+                        maxValue = x[i];
+                    }
+                }
+
+                return idx;
+            }
+
+            /**
+             * Get index of max element of int8 array.
+             * Dequantization is monotonic (scale > 0), so the argmax
+             * of the raw values is the argmax of the dequantized ones
+             */
+            inline uint32_t argmax(const int8_t *x, uint32_t length, int8_t& maxValue) {
+                uint32_t idx = 0;
+
+                maxValue = x[0];
+
+                for (uint32_t i = 1; i < length; i++) {
+                    if (x[i] > maxValue) {
+                        idx = i;
+                        maxValue = x[i];
+                    }
+                }
+
+                return idx;
+            }
+
+            /**
+             * Dequantize int8 array and get index of max element
+             * in a single pass
+             */
+            inline uint32_t dequantizeArgmax(const int8_t *x, float *y, uint32_t length, float scale, int32_t zeroPoint, float& maxValue) {
+                int8_t maxRaw = x[0];
+                uint32_t idx = 0;
+
+                y[0] = (x[0] - zeroPoint) * scale;
+
+                for (uint32_t i = 1; i < length; i++) {
+                    const int8_t xi = x[i];
+
+                    y[i] = (xi - zeroPoint) * scale;
+
+                    if (xi > maxRaw) {
+                        idx = i;
+                        maxRaw = xi;
+                    }
+                }
+
+                maxValue = y[idx];
+
+                return idx;
+            }
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_ARGMAX_H
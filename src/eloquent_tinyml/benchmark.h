@@ -1,6 +1,10 @@
 #ifndef ELOQUENT_EXTRA_TIME_BENCHMARK
 #define ELOQUENT_EXTRA_TIME_BENCHMARK
 
+#if defined(__linux__) && !defined(ARDUINO)
+#include <time.h>
+#endif
+
 namespace Eloquent {
     namespace Extra {
         namespace Time {
@@ -79,6 +83,374 @@ namespace Eloquent {
                 size_t timeStart;
                 size_t elapsedInMicros;
             };
+
+            /**
+             * High resolution tick counter.
+             * Uses CPU cycles where available (ESP32 CCOUNT, Cortex-M DWT CYCCNT),
+             * CLOCK_MONOTONIC nanoseconds on Linux, micros() otherwise.
+             * Ticks are 64 bit on Linux: 32 bit nanoseconds wrap every 4.29 s
+             */
+            class Clock {
+            public:
+            #if defined(__linux__) && !defined(ARDUINO)
+                typedef uint64_t Ticks;
+            #else
+                typedef uint32_t Ticks;
+            #endif
+
+                /**
+                 * Enable the counter (needed on Cortex-M only).
+                 * The count is not reset, so it's safe to call
+                 * while other measurements are running
+                 */
+                static void begin() {
+                #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+                    // DEMCR.TRCENA, then DWT_CTRL.CYCCNTENA
+                    *((volatile uint32_t*) 0xE000EDFC) |= (1UL << 24);
+                    *((volatile uint32_t*) 0xE0001000) |= 1UL;
+                #endif
+                }
+
+                /**
+                 * Get current tick count
+                 */
+                static inline Ticks now() {
+                #if defined(ESP32)
+                    return ESP.getCycleCount();
+                #elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+                    return *((volatile uint32_t*) 0xE0001004);
+                #elif defined(__linux__) && !defined(ARDUINO)
+                    struct timespec ts;
+                    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+                    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+                #else
+                    return ::micros();
+                #endif
+                }
+
+                /**
+                 * Get number of ticks in one microsecond
+                 */
+                static inline float ticksPerMicro() {
+                #if defined(ESP32)
+                    return getCpuFrequencyMhz();
+                #elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+                    #ifdef F_CPU
+                    return F_CPU / 1000000.0f;
+                    #else
+                    return SystemCoreClock / 1000000.0f;
+                    #endif
+                #elif defined(__linux__) && !defined(ARDUINO)
+                    return 1000.0f;
+                #else
+                    return 1.0f;
+                #endif
+                }
+            };
+
+            /**
+             * Split latency of a prediction into
+             * input fill, Invoke() and output post-processing.
+             * Compiles to nothing unless TF_PHASE_TIMING is defined
+             */
+            class PhaseTimer {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                PhaseTimer() {
+                #ifdef TF_PHASE_TIMING
+                    Clock::begin();
+                    _last = 0;
+                    _ticks[0] = _ticks[1] = _ticks[2] = 0;
+                #endif
+                }
+
+                /**
+                 * Start input phase
+                 */
+                inline void start() {
+                #ifdef TF_PHASE_TIMING
+                    _last = Clock::now();
+                #endif
+                }
+
+                /**
+                 * End input phase
+                 */
+                inline void lapInput() {
+                    lap(0);
+                }
+
+                /**
+                 * End Invoke() phase
+                 */
+                inline void lapInvoke() {
+                    lap(1);
+                }
+
+                /**
+                 * End output phase
+                 */
+                inline void lapOutput() {
+                    lap(2);
+                }
+
+                /**
+                 * Time spent filling/quantizing input, in micros
+                 */
+                inline float input() const {
+                    return toMicros(0);
+                }
+
+                /**
+                 * Time spent in Invoke(), in micros
+                 */
+                inline float invoke() const {
+                    return toMicros(1);
+                }
+
+                /**
+                 * Time spent reading outputs/argmax, in micros
+                 */
+                inline float output() const {
+                    return toMicros(2);
+                }
+
+                /**
+                 * Total time, in micros
+                 */
+                inline float total() const {
+                    return input() + invoke() + output();
+                }
+
+            protected:
+            #ifdef TF_PHASE_TIMING
+                Clock::Ticks _last;
+                Clock::Ticks _ticks[3];
+            #endif
+
+                /**
+                 * Record time since last lap
+                 */
+                inline void lap(uint8_t phase) {
+                #ifdef TF_PHASE_TIMING
+                    const Clock::Ticks now = Clock::now();
+
+                    _ticks[phase] = now - _last;
+                    _last = now;
+                #else
+                    (void) phase;
+                #endif
+                }
+
+                /**
+                 * Convert phase ticks to micros
+                 */
+                inline float toMicros(uint8_t phase) const {
+                #ifdef TF_PHASE_TIMING
+                    return _ticks[phase] / Clock::ticksPerMicro();
+                #else
+                    (void) phase;
+                    return 0;
+                #endif
+                }
+            };
+
+            /**
+             * Run code blocks many times and collect latency statistics.
+             * Samples are stored in a fixed-size array: no heap allocation
+             */
+            template<uint16_t maxIterations = 100>
+            class StatBenchmark {
+            public:
+
+                /**
+                 * Constructor
+                 */
+                StatBenchmark() :
+                    _count(0) {
+
+                }
+
+                /**
+                 * Run callback warmup times (not recorded),
+                 * then iterations times (recorded)
+                 */
+                template<typename Callback>
+                void run(Callback callback, uint16_t iterations = maxIterations, uint16_t warmup = 5) {
+                    Clock::begin();
+                    _count = 0;
+
+                    if (iterations > maxIterations)
+                        iterations = maxIterations;
+
+                    for (uint16_t i = 0; i < warmup; i++)
+                        callback();
+
+                    for (uint16_t i = 0; i < iterations; i++) {
+                        const Clock::Ticks start = Clock::now();
+                        callback();
+                        _ticks[_count++] = Clock::now() - start;
+                    }
+
+                    sort();
+                }
+
+                /**
+                 * Benchmark Sequential::predict
+                 */
+                template<typename TF, typename Input>
+                void run(TF& tf, Input *x, uint16_t iterations = maxIterations, uint16_t warmup = 5) {
+                    run([&tf, x]() { tf.predict(x); }, iterations, warmup);
+                }
+
+                /**
+                 * Get number of recorded iterations
+                 */
+                inline uint16_t count() const {
+                    return _count;
+                }
+
+                /**
+                 * Min latency, in micros
+                 */
+                float min() const {
+                    return _count ? toMicros(_ticks[0]) : 0;
+                }
+
+                /**
+                 * Max latency, in micros
+                 */
+                float max() const {
+                    return _count ? toMicros(_ticks[_count - 1]) : 0;
+                }
+
+                /**
+                 * Mean latency, in micros
+                 */
+                float mean() const {
+                    if (!_count)
+                        return 0;
+
+                    double sum = 0;
+
+                    for (uint16_t i = 0; i < _count; i++)
+                        sum += _ticks[i];
+
+                    return toMicros(sum / _count);
+                }
+
+                /**
+                 * Standard deviation of latency, in micros
+                 */
+                float stddev() const {
+                    if (_count < 2)
+                        return 0;
+
+                    const double mu = mean() * Clock::ticksPerMicro();
+                    double sum = 0;
+
+                    for (uint16_t i = 0; i < _count; i++)
+                        sum += (_ticks[i] - mu) * (_ticks[i] - mu);
+
+                    return toMicros(sqrt(sum / (_count - 1)));
+                }
+
+                /**
+                 * Given percentile (0-100) of latency, in micros.
+                 * Uses nearest-rank
+                 */
+                float percentile(float p) const {
+                    if (!_count)
+                        return 0;
+
+                    uint16_t rank = (uint16_t) ceil(p / 100.0f * _count);
+
+                    if (rank < 1)
+                        rank = 1;
+
+                    if (rank > _count)
+                        rank = _count;
+
+                    return toMicros(_ticks[rank - 1]);
+                }
+
+                /**
+                 * Median latency, in micros
+                 */
+                inline float median() const {
+                    return percentile(50);
+                }
+
+                /**
+                 * 95th percentile latency, in micros
+                 */
+                inline float p95() const {
+                    return percentile(95);
+                }
+
+                /**
+                 * 99th percentile latency, in micros
+                 */
+                inline float p99() const {
+                    return percentile(99);
+                }
+
+                /**
+                 * Print stats to given stream (e.g. Serial)
+                 */
+                template<typename Printer>
+                void print(Printer& printer) const {
+                    printer.print("n=");
+                    printer.print(_count);
+                    printer.print(", min=");
+                    printer.print(min());
+                    printer.print("us, mean=");
+                    printer.print(mean());
+                    printer.print("us, median=");
+                    printer.print(median());
+                    printer.print("us, p95=");
+                    printer.print(p95());
+                    printer.print("us, p99=");
+                    printer.print(p99());
+                    printer.print("us, max=");
+                    printer.print(max());
+                    printer.print("us, stddev=");
+                    printer.print(stddev());
+                    printer.println("us");
+                }
+
+            protected:
+                uint16_t _count;
+                Clock::Ticks _ticks[maxIterations];
+
+                /**
+                 * Convert ticks to micros
+                 */
+                static inline float toMicros(double ticks) {
+                    return ticks / Clock::ticksPerMicro();
+                }
+
+                /**
+                 * Insertion sort of samples (runs once, after the benchmark)
+                 */
+                void sort() {
+                    for (uint16_t i = 1; i < _count; i++) {
+                        const Clock::Ticks t = _ticks[i];
+                        int32_t j = i - 1;
+
+                        while (j >= 0 && _ticks[j] > t) {
+                            _ticks[j + 1] = _ticks[j];
+                            j--;
+                        }
+
+                        _ticks[j + 1] = t;
+                    }
+                }
+            };
         }
     }
 }
@@ -1,11 +1,32 @@
 #ifndef ELOQUENT_EXCEPTION_H
 #define ELOQUENT_EXCEPTION_H
 
+#ifndef ELOQUENT_EXCEPTION_MAX_LENGTH
+#define ELOQUENT_EXCEPTION_MAX_LENGTH 80
+#endif
+
 
 namespace Eloquent {
     namespace Error {
         /**
-         * Application expcetion
+         * Exception codes
+         */
+        enum class ErrorCode : uint8_t {
+            OK = 0,
+            GENERIC = 1,    // anything else
+            NOT_READY = 2,  // begin() not called, or failed
+            MODEL = 3,      // model missing, corrupted or with wrong schema version
+            OPS = 4,        // op not registered, unsupported or resolver full
+            ALLOC = 5,      // arena allocation or AllocateTensors() failed
+            DTYPE = 6,      // tensor dtype mismatch
+            SHAPE = 7,      // tensor length / count mismatch
+            INVOKE = 8,     // Invoke() failed
+            IO = 9          // model file or partition can't be opened, mapped or read
+        };
+
+        /**
+         * Application expcetion.
+         * Never allocates: message is stored in a fixed-size buffer
          */
         class Exception {
             public:
@@ -14,8 +35,9 @@ namespace Eloquent {
                  */
                 Exception(const char* tag) : 
                     _tag(tag), 
-                    _message(""),
+                    _code(ErrorCode::OK),
                     _isSevere(true) {
+                    _message[0] = '\0';
                 }
 
                 /**
@@ -29,7 +51,7 @@ namespace Eloquent {
                  * Test if there's an exception
                  */
                 bool isOk() const {
-                    return _message == "";
+                    return _code == ErrorCode::OK;
                 }
 
                 /**
@@ -39,6 +61,13 @@ namespace Eloquent {
                     return _isSevere && !isOk();
                 }
 
+                /**
+                 * Get error code
+                 */
+                ErrorCode code() const {
+                    return _code;
+                }
+
                 /**
                  * Mark error as not severe
                  */
@@ -49,20 +78,48 @@ namespace Eloquent {
                 }
 
                 /**
-                 * Set exception message
+                 * Set exception code and message
                  */
-                Exception& set(String error) {
-                    _message = error;
+                Exception& set(ErrorCode code, const char *error) {
+                    if (code == ErrorCode::OK || error == nullptr || error[0] == '\0')
+                        return clear();
+
+                    strncpy(_message, error, ELOQUENT_EXCEPTION_MAX_LENGTH - 1);
+                    _message[ELOQUENT_EXCEPTION_MAX_LENGTH - 1] = '\0';
+                    _code = code;
                     _isSevere = true;
 
                     return *this;
                 }
 
+                /**
+                 * Set exception code and message
+                 */
+                Exception& set(ErrorCode code, const String& error) {
+                    return set(code, error.c_str());
+                }
+
+                /**
+                 * Set exception message
+                 */
+                Exception& set(const char *error) {
+                    return set(ErrorCode::GENERIC, error);
+                }
+
+                /**
+                 * Set exception message
+                 */
+                Exception& set(const String& error) {
+                    return set(ErrorCode::GENERIC, error.c_str());
+                }
+
                 /**
                  * Clear exception
                  */
                 Exception& clear() {
-                    return set("");
+                    _code = ErrorCode::OK;
+
+                    return *this;
                 }
 
                 /**
@@ -79,22 +136,23 @@ namespace Eloquent {
                  * Convert exception to string
                  */
                 inline String toString() {
-                    return _message;
+                    return String(toCString());
                 }
 
                 /**
                  * Convert exception to char*
                  */
                 inline const char* toCString() {
-                    return toString().c_str();
+                    return isOk() ? "" : _message;
                 }
 
             protected:
                 const char* _tag;
+                ErrorCode _code;
                 bool _isSevere;
-                String _message;
+                char _message[ELOQUENT_EXCEPTION_MAX_LENGTH];
         };
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,232 @@
+#ifndef ELOQUENTTINYML_IMAGE_H
+#define ELOQUENTTINYML_IMAGE_H
+
+
+namespace Eloquent {
+    namespace TF {
+        namespace Image {
+            /**
+             * Source pixel layouts.
+             * RGB565 is big-endian (high byte first), as produced by esp32-camera.
+             * esp32-camera's PIXFORMAT_RGB888 frames are actually BGR888
+             */
+            enum class PixelFormat {
+                GRAY,
+                RGB565,
+                RGB888,
+                BGR888
+            };
+
+            /**
+             * How to fit the source aspect ratio into the destination
+             */
+            enum class Fit {
+                CROP,       // center-crop the largest region with destination aspect ratio
+                LETTERBOX   // scale the whole frame, pad borders with mid gray
+            };
+
+            /**
+             * How to downscale
+             */
+            enum class Interpolation {
+                AREA,       // average all source pixels under each destination pixel
+                BILINEAR    // blend the 4 source pixels nearest to each destination pixel center
+            };
+
+            /**
+             * Get bytes per pixel of format
+             */
+            inline uint8_t bytesPerPixel(PixelFormat format) {
+                switch (format) {
+                    case PixelFormat::RGB565:
+                        return 2;
+                    case PixelFormat::RGB888:
+                    case PixelFormat::BGR888:
+                        return 3;
+                    default:
+                        return 1;
+                }
+            }
+
+            /**
+             * Read x-th pixel of row as 8-bit luma.
+             * Y = (77 R + 150 G + 29 B) >> 8 (BT.601)
+             */
+            template<PixelFormat format>
+            inline uint8_t luma(const uint8_t *row, uint16_t x);
+
+            template<>
+            inline uint8_t luma<PixelFormat::GRAY>(const uint8_t *row, uint16_t x) {
+                return row[x];
+            }
+
+            template<>
+            inline uint8_t luma<PixelFormat::RGB565>(const uint8_t *row, uint16_t x) {
+                const uint16_t p = (row[2 * x] << 8) | row[2 * x + 1];
+                const uint16_t r = (p >> 8) & 0xF8;
+                const uint16_t g = (p >> 3) & 0xFC;
+                const uint16_t b = (p << 3) & 0xF8;
+
+                return (77 * r + 150 * g + 29 * b) >> 8;
+            }
+
+            template<>
+            inline uint8_t luma<PixelFormat::RGB888>(const uint8_t *row, uint16_t x) {
+                const uint8_t *p = row + 3 * x;
+
+                return (77 * p[0] + 150 * p[1] + 29 * p[2]) >> 8;
+            }
+
+            template<>
+            inline uint8_t luma<PixelFormat::BGR888>(const uint8_t *row, uint16_t x) {
+                const uint8_t *p = row + 3 * x;
+
+                return (29 * p[0] + 150 * p[1] + 77 * p[2]) >> 8;
+            }
+
+            /**
+             * Crop/letterbox + downscale + grayscale + uint8 to int8,
+             * in a single pass over the destination.
+             * Steps are 16.16 fixed point: no float math per pixel.
+             * stride is the source row length in bytes (0 = tightly packed),
+             * so a window of a larger frame can be converted in place
+             */
+            template<PixelFormat format>
+            void toGrayInt8(const uint8_t *src, uint16_t srcWidth, uint16_t srcHeight, int8_t *dst, uint16_t dstWidth, uint16_t dstHeight, Fit fit, Interpolation interpolation, size_t stride = 0) {
+                if (!stride)
+                    stride = (size_t) srcWidth * bytesPerPixel(format);
+
+                uint16_t regionX = 0, regionY = 0, regionWidth = srcWidth, regionHeight = srcHeight;
+                uint16_t contentX = 0, contentY = 0, contentWidth = dstWidth, contentHeight = dstHeight;
+                const bool wider = (uint32_t) srcWidth * dstHeight >= (uint32_t) srcHeight * dstWidth;
+
+                if (fit == Fit::CROP) {
+                    if (wider)
+                        regionWidth = (uint32_t) srcHeight * dstWidth / dstHeight;
+                    else
+                        regionHeight = (uint32_t) srcWidth * dstHeight / dstWidth;
+
+                    regionX = (srcWidth - regionWidth) / 2;
+                    regionY = (srcHeight - regionHeight) / 2;
+                }
+                else {
+                    if (wider)
+                        contentHeight = (uint32_t) srcHeight * dstWidth / srcWidth;
+                    else
+                        contentWidth = (uint32_t) srcWidth * dstHeight / srcHeight;
+
+                    if (!contentWidth) contentWidth = 1;
+                    if (!contentHeight) contentHeight = 1;
+
+                    contentX = (dstWidth - contentWidth) / 2;
+                    contentY = (dstHeight - contentHeight) / 2;
+                }
+
+                const uint32_t stepX = ((uint32_t) regionWidth << 16) / contentWidth;
+                const uint32_t stepY = ((uint32_t) regionHeight << 16) / contentHeight;
+
+                for (uint16_t oy = 0; oy < dstHeight; oy++) {
+                    int8_t *out = dst + (size_t) oy * dstWidth;
+
+                    // letterbox padding (0 = mid gray once sign-flipped)
+                    if (oy < contentY || oy >= contentY + contentHeight) {
+                        memset(out, 0, dstWidth);
+                        continue;
+                    }
+
+                    memset(out, 0, contentX);
+                    memset(out + contentX + contentWidth, 0, dstWidth - contentX - contentWidth);
+                    out += contentX;
+
+                    const uint16_t cy = oy - contentY;
+
+                    if (interpolation == Interpolation::AREA) {
+                        const uint16_t y0 = regionY + ((cy * stepY) >> 16);
+                        uint16_t y1 = regionY + (((cy + 1) * stepY) >> 16);
+
+                        if (y1 <= y0) y1 = y0 + 1;
+
+                        for (uint16_t cx = 0; cx < contentWidth; cx++) {
+                            const uint16_t x0 = regionX + ((cx * stepX) >> 16);
+                            uint16_t x1 = regionX + (((cx + 1) * stepX) >> 16);
+                            uint32_t sum = 0;
+
+                            if (x1 <= x0) x1 = x0 + 1;
+
+                            for (uint16_t y = y0; y < y1; y++) {
+                                const uint8_t *row = src + y * stride;
+
+                                for (uint16_t x = x0; x < x1; x++)
+                                    sum += luma<format>(row, x);
+                            }
+
+                            out[cx] = (int8_t) ((sum / ((y1 - y0) * (x1 - x0))) ^ 0x80);
+                        }
+                    }
+                    else {
+                        // sample at destination pixel center, 8-bit weights
+                        int32_t sy = (int32_t) (cy * stepY + (stepY >> 1)) - 0x8000;
+
+                        if (sy < 0) sy = 0;
+
+                        uint16_t y0 = regionY + (sy >> 16);
+                        const uint16_t y1 = y0 + 1 < regionY + regionHeight ? y0 + 1 : y0;
+                        const uint16_t wy = (sy >> 8) & 0xFF;
+                        const uint8_t *row0 = src + y0 * stride;
+                        const uint8_t *row1 = src + y1 * stride;
+
+                        for (uint16_t cx = 0; cx < contentWidth; cx++) {
+                            int32_t sx = (int32_t) (cx * stepX + (stepX >> 1)) - 0x8000;
+
+                            if (sx < 0) sx = 0;
+
+                            const uint16_t x0 = regionX + (sx >> 16);
+                            const uint16_t x1 = x0 + 1 < regionX + regionWidth ? x0 + 1 : x0;
+                            const uint16_t wx = (sx >> 8) & 0xFF;
+                            const uint32_t top = luma<format>(row0, x0) * (256 - wx) + luma<format>(row0, x1) * wx;
+                            const uint32_t bottom = luma<format>(row1, x0) * (256 - wx) + luma<format>(row1, x1) * wx;
+
+                            out[cx] = (int8_t) (((top * (256 - wy) + bottom * wy) >> 16) ^ 0x80);
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Runtime dispatch on pixel format
+             */
+            inline void toGrayInt8(const uint8_t *src, uint16_t srcWidth, uint16_t srcHeight, PixelFormat format, int8_t *dst, uint16_t dstWidth, uint16_t dstHeight, Fit fit = Fit::CROP, Interpolation interpolation = Interpolation::AREA, size_t stride = 0) {
+                switch (format) {
+                    case PixelFormat::RGB565:
+                        return toGrayInt8<PixelFormat::RGB565>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight, fit, interpolation, stride);
+                    case PixelFormat::RGB888:
+                        return toGrayInt8<PixelFormat::RGB888>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight, fit, interpolation, stride);
+                    case PixelFormat::BGR888:
+                        return toGrayInt8<PixelFormat::BGR888>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight, fit, interpolation, stride);
+                    default:
+                        return toGrayInt8<PixelFormat::GRAY>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight, fit, interpolation, stride);
+                }
+            }
+
+            /**
+             * Variance of int8 pixels (in squared gray levels).
+             * Low variance = flat region (sky, wall...)
+             */
+            inline float variance(const int8_t *x, size_t length) {
+                int32_t sum = 0;
+                int64_t sumSq = 0;
+
+                for (size_t i = 0; i < length; i++) {
+                    sum += x[i];
+                    sumSq += x[i] * x[i];
+                }
+
+                const float mean = ((float) sum) / length;
+
+                return ((float) sumSq) / length - mean * mean;
+            }
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_IMAGE_H
@@ -0,0 +1,97 @@
+#ifndef ELOQUENTTINYML_INPUT_VIEW_H
+#define ELOQUENTTINYML_INPUT_VIEW_H
+
+
+namespace Eloquent {
+    namespace TF {
+        /**
+         * Map C++ type to TfLiteType
+         */
+        template<typename T>
+        struct TensorType {
+            static constexpr TfLiteType value = kTfLiteNoType;
+        };
+
+        template<>
+        struct TensorType<float> {
+            static constexpr TfLiteType value = kTfLiteFloat32;
+        };
+
+        template<>
+        struct TensorType<int8_t> {
+            static constexpr TfLiteType value = kTfLiteInt8;
+        };
+
+        template<>
+        struct TensorType<uint8_t> {
+            static constexpr TfLiteType value = kTfLiteUInt8;
+        };
+
+        /**
+         * Typed, writable view over the interpreter's input tensor.
+         * Fill it in place, then call Sequential::invoke()
+         * to skip the input copy of predict()
+         */
+        template<typename T>
+        class InputView {
+        public:
+
+            /**
+             * Constructor
+             */
+            InputView(T *data = nullptr, uint32_t length = 0) :
+                _data(data),
+                _length(length) {
+
+            }
+
+            /**
+             * Test if view is bound to a tensor
+             */
+            operator bool() const {
+                return _data != nullptr;
+            }
+
+            /**
+             * Access i-th element
+             */
+            inline T& operator[](uint32_t i) {
+                return _data[i];
+            }
+
+            /**
+             * Get raw pointer to tensor data
+             */
+            inline T* data() {
+                return _data;
+            }
+
+            /**
+             * Get number of elements
+             */
+            inline uint32_t length() const {
+                return _length;
+            }
+
+            /**
+             * Iterator begin
+             */
+            inline T* begin() {
+                return _data;
+            }
+
+            /**
+             * Iterator end
+             */
+            inline T* end() {
+                return _data + _length;
+            }
+
+        protected:
+            T *_data;
+            uint32_t _length;
+        };
+    }
+}
+
+#endif //ELOQUENTTINYML_INPUT_VIEW_H
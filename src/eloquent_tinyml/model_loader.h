@@ -0,0 +1,312 @@
+#ifndef ELOQUENTTINYML_MODEL_LOADER_H
+#define ELOQUENTTINYML_MODEL_LOADER_H
+
+#include "./exception.h"
+#include "./arena.h"
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#include <esp_idf_version.h>
+#elif defined(__linux__) && !defined(ARDUINO)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using Eloquent::Error::Exception;
+using Eloquent::Error::ErrorCode;
+
+
+namespace Eloquent {
+    namespace TF {
+        /**
+         * Load a .tflite model at runtime instead of compiling it in.
+         * Memory-maps the model when possible (ESP32 flash partition,
+         * Linux file) and copies it only when it can't be mapped
+         * or is misaligned.
+         * Owns the model memory: it can be moved, not copied
+         */
+        class ModelLoader {
+        public:
+            Exception exception;
+
+            /**
+             * Constructor
+             */
+            ModelLoader() :
+                exception("ModelLoader"),
+                _data(nullptr),
+                _size(0),
+                _copy(nullptr),
+                _mapped(false) {
+            #if defined(ESP32)
+                _handle = 0;
+            #endif
+            }
+
+            /**
+             * Move constructor
+             */
+            ModelLoader(ModelLoader&& other) :
+                exception("ModelLoader") {
+                take(other);
+            }
+
+            ModelLoader(const ModelLoader&) = delete;
+            ModelLoader& operator=(const ModelLoader&) = delete;
+
+            /**
+             * Destructor
+             */
+            ~ModelLoader() {
+                close();
+            }
+
+            /**
+             * Move assignment
+             */
+            ModelLoader& operator=(ModelLoader&& other) {
+                if (this != &other) {
+                    close();
+                    take(other);
+                }
+
+                return *this;
+            }
+
+            /**
+             * Get model data (pass it to Sequential::begin)
+             */
+            inline const unsigned char* data() const {
+                return _data;
+            }
+
+            /**
+             * Get model size
+             */
+            inline size_t size() const {
+                return _size;
+            }
+
+            /**
+             * Test if model is memory mapped (not copied to RAM)
+             */
+            inline bool isMapped() const {
+                return _mapped;
+            }
+
+            /**
+             * Use model already in memory.
+             * It is copied only if not aligned to TF_ARENA_ALIGNMENT
+             */
+            Exception& fromMemory(const void *ptr, size_t size) {
+                close();
+
+                if (ptr == nullptr || !size)
+                    return exception.set(ErrorCode::MODEL, "Empty model");
+
+                if (((uintptr_t) ptr) % TF_ARENA_ALIGNMENT == 0) {
+                    _data = (const unsigned char*) ptr;
+                    _size = size;
+
+                    return validate();
+                }
+
+                uint8_t *dest = allocCopy(size);
+
+                if (dest == nullptr)
+                    return exception;
+
+                memcpy(dest, ptr, size);
+
+                return validate();
+            }
+
+        #if defined(ESP32)
+            /**
+             * Memory-map model stored in a data partition with the given label
+             * (e.g. flashed with esptool or written OTA)
+             */
+            Exception& fromPartition(const char *label) {
+                close();
+
+                const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+                const void *ptr = nullptr;
+
+                if (partition == nullptr)
+                    return exception.set(ErrorCode::IO, String("Partition not found: ") + label);
+
+            #if ESP_IDF_VERSION_MAJOR >= 5
+                if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &ptr, &_handle) != ESP_OK)
+            #else
+                if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &ptr, &_handle) != ESP_OK)
+            #endif
+                    return exception.set(ErrorCode::IO, "Cannot mmap partition");
+
+                // mmap'd addresses are page-aligned
+                _data = (const unsigned char*) ptr;
+                _size = partition->size;
+                _mapped = true;
+
+                return validate();
+            }
+        #endif
+
+        #if defined(__linux__) && !defined(ARDUINO)
+            /**
+             * Memory-map .tflite file
+             */
+            Exception& fromPath(const char *path) {
+                close();
+
+                struct stat st;
+                const int fd = open(path, O_RDONLY);
+
+                if (fd < 0)
+                    return exception.set(ErrorCode::IO, String("Cannot open ") + path);
+
+                if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+                    ::close(fd);
+                    return exception.set(ErrorCode::IO, String("Cannot stat ") + path);
+                }
+
+                void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+
+                if (ptr == MAP_FAILED)
+                    return exception.set(ErrorCode::IO, String("Cannot mmap ") + path);
+
+                _data = (const unsigned char*) ptr;
+                _size = st.st_size;
+                _mapped = true;
+
+                return validate();
+            }
+        #endif
+
+            /**
+             * Read model from file (LittleFS, SD, SPIFFS...).
+             * Files can't be mapped, so the model is copied to RAM
+             */
+            template<typename FS>
+            Exception& fromFile(FS& fs, const char *path) {
+                close();
+
+                auto file = fs.open(path, "r");
+
+                if (!file)
+                    return exception.set(ErrorCode::IO, String("Cannot open ") + path);
+
+                const size_t size = file.size();
+                uint8_t *dest = allocCopy(size);
+
+                if (dest == nullptr) {
+                    file.close();
+                    return exception;
+                }
+
+                const size_t read = file.read(dest, size);
+                file.close();
+
+                if (read != size) {
+                    close();
+                    return exception.set(ErrorCode::IO, String("Short read from ") + path);
+                }
+
+                return validate();
+            }
+
+            /**
+             * Release model memory
+             */
+            void close() {
+            #if defined(ESP32)
+                if (_mapped) {
+                #if ESP_IDF_VERSION_MAJOR >= 5
+                    esp_partition_munmap(_handle);
+                #else
+                    spi_flash_munmap(_handle);
+                #endif
+                }
+            #elif defined(__linux__) && !defined(ARDUINO)
+                if (_mapped)
+                    munmap((void*) _data, _size);
+            #endif
+
+                free(_copy);
+                _copy = nullptr;
+                _data = nullptr;
+                _size = 0;
+                _mapped = false;
+            }
+
+        protected:
+            const unsigned char *_data;
+            size_t _size;
+            uint8_t *_copy;
+            bool _mapped;
+        #if defined(ESP32)
+        #if ESP_IDF_VERSION_MAJOR >= 5
+            esp_partition_mmap_handle_t _handle;
+        #else
+            spi_flash_mmap_handle_t _handle;
+        #endif
+        #endif
+
+            /**
+             * Check that data looks like a .tflite flatbuffer:
+             * root offset + "TFL3" file identifier at bytes 4-7.
+             * Catches empty/erased partitions and wrong files
+             * before TFLM parses them
+             */
+            Exception& validate() {
+                if (_size < 8 || memcmp(_data + 4, "TFL3", 4) != 0) {
+                    close();
+                    return exception.set(ErrorCode::MODEL, "Not a .tflite model (TFL3 identifier missing)");
+                }
+
+                return exception.clear();
+            }
+
+            /**
+             * Take ownership of other's memory
+             */
+            void take(ModelLoader& other) {
+                _data = other._data;
+                _size = other._size;
+                _copy = other._copy;
+                _mapped = other._mapped;
+            #if defined(ESP32)
+                _handle = other._handle;
+            #endif
+                exception = other.exception;
+
+                // other must not release the memory on close()
+                other._data = nullptr;
+                other._size = 0;
+                other._copy = nullptr;
+                other._mapped = false;
+            }
+
+            /**
+             * Allocate aligned RAM copy of the model
+             */
+            uint8_t* allocCopy(size_t size) {
+                _copy = (uint8_t*) malloc(size + TF_ARENA_ALIGNMENT - 1);
+
+                if (_copy == nullptr) {
+                    exception.set(ErrorCode::ALLOC, String("Cannot allocate ") + size + " bytes for model");
+                    return nullptr;
+                }
+
+                _data = Arena::align(_copy);
+                _size = size;
+
+                return (uint8_t*) _data;
+            }
+        };
+    }
+}
+
+#endif //ELOQUENTTINYML_MODEL_LOADER_H
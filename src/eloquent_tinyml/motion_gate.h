@@ -0,0 +1,170 @@
+#ifndef ELOQUENTTINYML_MOTION_GATE_H
+#define ELOQUENTTINYML_MOTION_GATE_H
+
+#include "./image.h"
+
+
+namespace Eloquent {
+    namespace TF {
+        namespace Image {
+            /**
+             * Skip inference on static scenes.
+             * Keeps a downsampled grayscale reference frame and
+             * compares new frames to it with mean absolute difference.
+             * The reference is only replaced when inference runs,
+             * so slow drifts add up until they trigger.
+             * Frames are allocated on the heap by enable(),
+             * so a gate that is never enabled costs no RAM
+             */
+            template<uint16_t width = 32, uint16_t height = 32>
+            class MotionGate {
+            public:
+                bool enabled;
+                float threshold;
+                uint32_t refreshInterval;
+                float score;
+                uint32_t skipped;
+                uint32_t executed;
+
+                /**
+                 * Constructor
+                 */
+                MotionGate() :
+                    enabled(false),
+                    threshold(5),
+                    refreshInterval(10),
+                    score(0),
+                    skipped(0),
+                    executed(0),
+                    _hasReference(false),
+                    _sinceRefresh(0),
+                    _current(nullptr),
+                    _reference(nullptr) {
+
+                }
+
+                /**
+                 * Frames are owned: no copies
+                 */
+                MotionGate(const MotionGate&) = delete;
+                MotionGate& operator=(const MotionGate&) = delete;
+
+                /**
+                 * Destructor
+                 */
+                ~MotionGate() {
+                    ::free(_current);
+                }
+
+                /**
+                 * Enable gate
+                 * @param threshold mean absolute pixel difference (0-255) that counts as motion
+                 * @param refreshInterval run inference anyway after this many skipped frames (0 = never)
+                 * @return false if frames can't be allocated (gate stays disabled)
+                 */
+                bool enable(float threshold = 5, uint32_t refreshInterval = 10) {
+                    this->threshold = threshold;
+                    this->refreshInterval = refreshInterval;
+                    reset();
+
+                    // current and reference frames in a single block
+                    if (_current == nullptr) {
+                        _current = (int8_t*) malloc(2 * width * height);
+
+                        if (_current == nullptr)
+                            return (enabled = false);
+
+                        _reference = _current + width * height;
+                    }
+
+                    return (enabled = true);
+                }
+
+                /**
+                 * Disable gate.
+                 * Frames are kept for the next enable()
+                 */
+                void disable() {
+                    enabled = false;
+                }
+
+                /**
+                 * Forget reference frame and counters
+                 */
+                void reset() {
+                    _hasReference = false;
+                    _sinceRefresh = 0;
+                    score = 0;
+                    skipped = 0;
+                    executed = 0;
+                }
+
+                /**
+                 * Fraction of frames that were skipped
+                 */
+                float skipRatio() const {
+                    const uint32_t total = skipped + executed;
+
+                    return total ? ((float) skipped) / total : 0;
+                }
+
+                /**
+                 * Test if frame changed enough to run inference.
+                 * Always true when disabled, on first frame,
+                 * when forced or when refresh interval elapsed.
+                 * Call ran() once inference succeeded
+                 */
+                bool update(const uint8_t *frame, uint16_t frameWidth, uint16_t frameHeight, PixelFormat format, Fit fit = Fit::CROP, bool force = false) {
+                    if (!enabled)
+                        return true;
+
+                    // same crop as the detector, so only motion it can see counts
+                    toGrayInt8(frame, frameWidth, frameHeight, format, _current, width, height, fit, Interpolation::AREA);
+
+                    uint32_t sad = 0;
+
+                    for (uint16_t i = 0; i < width * height; i++) {
+                        const int16_t diff = _current[i] - _reference[i];
+
+                        sad += diff >= 0 ? diff : -diff;
+                    }
+
+                    score = ((float) sad) / (width * height);
+
+                    if (!force && _hasReference && score < threshold && (refreshInterval == 0 || _sinceRefresh < refreshInterval)) {
+                        _sinceRefresh += 1;
+                        skipped += 1;
+
+                        return false;
+                    }
+
+                    return true;
+                }
+
+                /**
+                 * Record that inference ran on the frame passed to update():
+                 * it becomes the reference. Not called when inference fails,
+                 * so a failed frame neither counts as executed nor
+                 * hides later motion
+                 */
+                void ran() {
+                    if (!enabled)
+                        return;
+
+                    memcpy(_reference, _current, width * height);
+                    _hasReference = true;
+                    _sinceRefresh = 0;
+                    executed += 1;
+                }
+
+            protected:
+                bool _hasReference;
+                uint32_t _sinceRefresh;
+                int8_t *_current;
+                int8_t *_reference;
+            };
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_MOTION_GATE_H
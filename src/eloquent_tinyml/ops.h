@@ -0,0 +1,335 @@
+#ifndef ELOQUENTTINYML_OPS_H
+#define ELOQUENTTINYML_OPS_H
+
+/**
+ * Builtin ops known to MicroMutableOpResolver,
+ * as X(BUILTIN_OPERATOR_NAME, ResolverMethodSuffix)
+ */
+#define ELOQUENT_TF_OPS(X) \
+    X(ABS, Abs) \
+    X(ADD, Add) \
+    X(ADD_N, AddN) \
+    X(ARG_MAX, ArgMax) \
+    X(ARG_MIN, ArgMin) \
+    X(AVERAGE_POOL_2D, AveragePool2D) \
+    X(BATCH_TO_SPACE_ND, BatchToSpaceNd) \
+    X(CAST, Cast) \
+    X(CEIL, Ceil) \
+    X(CONCATENATION, Concatenation) \
+    X(CONV_2D, Conv2D) \
+    X(COS, Cos) \
+    X(DEPTH_TO_SPACE, DepthToSpace) \
+    X(DEPTHWISE_CONV_2D, DepthwiseConv2D) \
+    X(DEQUANTIZE, Dequantize) \
+    X(DIV, Div) \
+    X(ELU, Elu) \
+    X(EQUAL, Equal) \
+    X(EXP, Exp) \
+    X(EXPAND_DIMS, ExpandDims) \
+    X(FILL, Fill) \
+    X(FLOOR, Floor) \
+    X(FLOOR_DIV, FloorDiv) \
+    X(FLOOR_MOD, FloorMod) \
+    X(FULLY_CONNECTED, FullyConnected) \
+    X(GATHER, Gather) \
+    X(GATHER_ND, GatherNd) \
+    X(GREATER, Greater) \
+    X(GREATER_EQUAL, GreaterEqual) \
+    X(HARD_SWISH, HardSwish) \
+    X(L2_NORMALIZATION, L2Normalization) \
+    X(L2_POOL_2D, L2Pool2D) \
+    X(LEAKY_RELU, LeakyRelu) \
+    X(LESS, Less) \
+    X(LESS_EQUAL, LessEqual) \
+    X(LOG, Log) \
+    X(LOGICAL_AND, LogicalAnd) \
+    X(LOGICAL_NOT, LogicalNot) \
+    X(LOGICAL_OR, LogicalOr) \
+    X(LOGISTIC, Logistic) \
+    X(LOG_SOFTMAX, LogSoftmax) \
+    X(MAX_POOL_2D, MaxPool2D) \
+    X(MAXIMUM, Maximum) \
+    X(MEAN, Mean) \
+    X(MINIMUM, Minimum) \
+    X(MIRROR_PAD, MirrorPad) \
+    X(MUL, Mul) \
+    X(NEG, Neg) \
+    X(NOT_EQUAL, NotEqual) \
+    X(PACK, Pack) \
+    X(PAD, Pad) \
+    X(PADV2, PadV2) \
+    X(PRELU, Prelu) \
+    X(QUANTIZE, Quantize) \
+    X(REDUCE_MAX, ReduceMax) \
+    X(RELU, Relu) \
+    X(RELU6, Relu6) \
+    X(RESHAPE, Reshape) \
+    X(RESIZE_BILINEAR, ResizeBilinear) \
+    X(RESIZE_NEAREST_NEIGHBOR, ResizeNearestNeighbor) \
+    X(ROUND, Round) \
+    X(RSQRT, Rsqrt) \
+    X(SHAPE, Shape) \
+    X(SIN, Sin) \
+    X(SLICE, Slice) \
+    X(SOFTMAX, Softmax) \
+    X(SPACE_TO_BATCH_ND, SpaceToBatchNd) \
+    X(SPACE_TO_DEPTH, SpaceToDepth) \
+    X(SPLIT, Split) \
+    X(SPLIT_V, SplitV) \
+    X(SQRT, Sqrt) \
+    X(SQUARE, Square) \
+    X(SQUARED_DIFFERENCE, SquaredDifference) \
+    X(SQUEEZE, Squeeze) \
+    X(STRIDED_SLICE, StridedSlice) \
+    X(SUB, Sub) \
+    X(SUM, Sum) \
+    X(SVDF, Svdf) \
+    X(TANH, Tanh) \
+    X(TRANSPOSE, Transpose) \
+    X(TRANSPOSE_CONV, TransposeConv) \
+    X(UNIDIRECTIONAL_SEQUENCE_LSTM, UnidirectionalSequenceLSTM) \
+    X(UNPACK, Unpack) \
+    X(WHILE, While) \
+    X(ZEROS_LIKE, ZerosLike)
+
+
+namespace Eloquent {
+    namespace TF {
+        /**
+         * One tag type per builtin op (e.g. Op::Conv2D).
+         * Only the tags listed in an OpList reference their kernel,
+         * so the linker can strip all the others
+         */
+        namespace Op {
+        #define ELOQUENT_TF_OP_TAG(op, method) \
+            struct method { \
+                static constexpr tflite::BuiltinOperator code = tflite::BuiltinOperator_##op; \
+                \
+                template<typename Resolver> \
+                static TfLiteStatus add(Resolver& resolver) { \
+                    return resolver.FindOp(code) != nullptr ? kTfLiteOk : resolver.Add##method(); \
+                } \
+            };
+            ELOQUENT_TF_OPS(ELOQUENT_TF_OP_TAG)
+        #undef ELOQUENT_TF_OP_TAG
+        }
+
+        /**
+         * Compile-time list of ops.
+         * Use OpList<...>::size as numOps and registerIn(tf.resolver)
+         * before begin(), or define TF_OPS in the model header
+         */
+        template<typename... Ts>
+        struct OpList {
+            static constexpr uint8_t size = sizeof...(Ts);
+
+            /**
+             * Register all listed ops (already registered ones are skipped)
+             * @return kTfLiteError if any op can't be registered (resolver full)
+             */
+            template<typename Resolver>
+            static TfLiteStatus registerIn(Resolver& resolver) {
+                TfLiteStatus status = kTfLiteOk;
+                const int unused[] = { 0, (status = Ts::add(resolver) == kTfLiteOk ? status : kTfLiteError, 0)... };
+                (void) unused;
+
+                return status;
+            }
+
+            /**
+             * Test if op is listed
+             */
+            static bool contains(tflite::BuiltinOperator code) {
+                bool found = false;
+                const int unused[] = { 0, (found = found || Ts::code == code, 0)... };
+                (void) unused;
+
+                return found;
+            }
+
+            /**
+             * Register op by builtin code.
+             * Only the listed ops are referenced
+             * @return kTfLiteError if op is not listed or can't be registered
+             */
+            template<typename Resolver>
+            static TfLiteStatus add(Resolver& resolver, tflite::BuiltinOperator code) {
+                TfLiteStatus status = kTfLiteError;
+                const int unused[] = { 0, (status = Ts::code == code ? Ts::add(resolver) : status, 0)... };
+                (void) unused;
+
+                return status;
+            }
+        };
+
+        /**
+         * Every op in ELOQUENT_TF_OPS, matched at runtime.
+         * References all the kernels, so all of them are linked:
+         * prefer an OpList with the ops you need
+         */
+        struct AllOps {
+            /**
+             * Test if op is known
+             */
+            static bool contains(tflite::BuiltinOperator code) {
+                switch (code) {
+                #define ELOQUENT_TF_HAS_OP(op, method) \
+                    case tflite::BuiltinOperator_##op: \
+                        return true;
+                    ELOQUENT_TF_OPS(ELOQUENT_TF_HAS_OP)
+                #undef ELOQUENT_TF_HAS_OP
+                    default:
+                        return false;
+                }
+            }
+
+            /**
+             * Register op by builtin code
+             * @return kTfLiteError if op is unknown or can't be registered
+             */
+            template<typename Resolver>
+            static TfLiteStatus add(Resolver& resolver, tflite::BuiltinOperator code) {
+                switch (code) {
+                #define ELOQUENT_TF_ADD_OP(op, method) \
+                    case tflite::BuiltinOperator_##op: \
+                        return Op::method::add(resolver);
+                    ELOQUENT_TF_OPS(ELOQUENT_TF_ADD_OP)
+                #undef ELOQUENT_TF_ADD_OP
+                    default:
+                        return kTfLiteError;
+                }
+            }
+        };
+
+        namespace Ops {
+            /**
+             * Get builtin code of operator
+             * (same as tflite::GetBuiltinCode, without schema_utils.h)
+             */
+            inline tflite::BuiltinOperator builtinCode(const tflite::OperatorCode *opcode) {
+                const int32_t code = opcode->builtin_code();
+                const int32_t deprecated = opcode->deprecated_builtin_code();
+
+                return (tflite::BuiltinOperator) (code > deprecated ? code : deprecated);
+            }
+
+            /**
+             * Test if two operator codes resolve to the same kernel.
+             * The same builtin can be listed once per op version
+             */
+            inline bool sameOp(const tflite::OperatorCode *a, const tflite::OperatorCode *b) {
+                const tflite::BuiltinOperator code = builtinCode(a);
+
+                if (code != builtinCode(b))
+                    return false;
+
+                if (code != tflite::BuiltinOperator_CUSTOM)
+                    return true;
+
+                return a->custom_code() != nullptr && b->custom_code() != nullptr && strcmp(a->custom_code()->c_str(), b->custom_code()->c_str()) == 0;
+            }
+
+            /**
+             * Get number of distinct ops used by model
+             * (the minimum numOps of Sequential)
+             */
+            inline uint16_t count(const tflite::Model *model) {
+                const auto *opcodes = model->operator_codes();
+                uint16_t distinct = 0;
+
+                if (opcodes == nullptr)
+                    return 0;
+
+                for (uint32_t i = 0; i < opcodes->size(); i++) {
+                    bool seen = false;
+
+                    for (uint32_t j = 0; j < i && !seen; j++)
+                        seen = sameOp(opcodes->Get(i), opcodes->Get(j));
+
+                    distinct += !seen;
+                }
+
+                return distinct;
+            }
+
+            /**
+             * Register all the ops used by model, picking them from List
+             * (an OpList or AllOps).
+             * On failure, exception holds the reason
+             */
+            template<typename List, typename Resolver>
+            bool addAll(Resolver& resolver, const tflite::Model *model, uint16_t maxOps, Eloquent::Error::Exception& exception) {
+                const auto *opcodes = model->operator_codes();
+
+                if (opcodes == nullptr)
+                    return true;
+
+                if (count(model) > maxOps) {
+                    exception.set(Eloquent::Error::ErrorCode::OPS, String("Model needs ") + count(model) + " ops, but numOps is " + maxOps);
+                    return false;
+                }
+
+                for (uint32_t i = 0; i < opcodes->size(); i++) {
+                    const tflite::BuiltinOperator code = builtinCode(opcodes->Get(i));
+
+                    if (code == tflite::BuiltinOperator_CUSTOM) {
+                        exception.set(Eloquent::Error::ErrorCode::OPS, "Custom ops must be registered manually");
+                        return false;
+                    }
+
+                    if (resolver.FindOp(code) != nullptr)
+                        continue;
+
+                    if (!List::contains(code)) {
+                        exception.set(Eloquent::Error::ErrorCode::OPS, String("Op not in op list: ") + tflite::EnumNameBuiltinOperator(code));
+                        return false;
+                    }
+
+                    if (List::add(resolver, code) != kTfLiteOk) {
+                        exception.set(Eloquent::Error::ErrorCode::OPS, String("Cannot register op: ") + tflite::EnumNameBuiltinOperator(code));
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            /**
+             * Test if resolver can run all the ops of model.
+             * On failure, missing holds the name of the first missing op
+             */
+            template<typename Resolver>
+            bool allRegistered(const Resolver& resolver, const tflite::Model *model, const char *&missing) {
+                const auto *opcodes = model->operator_codes();
+
+                missing = nullptr;
+
+                if (opcodes == nullptr)
+                    return true;
+
+                for (uint32_t i = 0; i < opcodes->size(); i++) {
+                    const tflite::OperatorCode *opcode = opcodes->Get(i);
+                    const tflite::BuiltinOperator code = builtinCode(opcode);
+
+                    if (code == tflite::BuiltinOperator_CUSTOM) {
+                        if (opcode->custom_code() == nullptr || resolver.FindOp(opcode->custom_code()->c_str()) == nullptr) {
+                            missing = "CUSTOM";
+                            return false;
+                        }
+
+                        continue;
+                    }
+
+                    if (resolver.FindOp(code) == nullptr) {
+                        missing = tflite::EnumNameBuiltinOperator(code);
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_OPS_H
@@ -0,0 +1,81 @@
+#ifndef ELOQUENTTINYML_OUTPUT_VIEW_H
+#define ELOQUENTTINYML_OUTPUT_VIEW_H
+
+
+namespace Eloquent {
+    namespace TF {
+        /**
+         * Read-only view over the interpreter's output tensor.
+         * Quantized elements are converted to float only when read
+         */
+        class OutputView {
+        public:
+
+            /**
+             * Constructor
+             */
+            OutputView(const TfLiteTensor *tensor = nullptr, uint32_t length = 0) :
+                _tensor(tensor),
+                _length(length) {
+
+            }
+
+            /**
+             * Test if view is bound to a tensor
+             */
+            operator bool() const {
+                return _tensor != nullptr;
+            }
+
+            /**
+             * Get i-th output as float.
+             * NaN if view is unbound or i is out of range
+             */
+            float operator[](uint32_t i) const {
+                if (_tensor == nullptr || i >= _length)
+                    return NAN;
+
+                switch (_tensor->type) {
+                    case kTfLiteInt8:
+                        return (_tensor->data.int8[i] - _tensor->params.zero_point) * _tensor->params.scale;
+                    case kTfLiteUInt8:
+                        return (_tensor->data.uint8[i] - _tensor->params.zero_point) * _tensor->params.scale;
+                    default:
+                        return _tensor->data.f[i];
+                }
+            }
+
+            /**
+             * Get i-th output without dequantization.
+             * 0 if view is unbound, i is out of range
+             * or tensor is not int8
+             */
+            inline int8_t int8(uint32_t i) const {
+                if (_tensor == nullptr || i >= _length || _tensor->type != kTfLiteInt8)
+                    return 0;
+
+                return _tensor->data.int8[i];
+            }
+
+            /**
+             * Get number of elements
+             */
+            inline uint32_t length() const {
+                return _length;
+            }
+
+            /**
+             * Get tensor dtype
+             */
+            inline TfLiteType type() const {
+                return _tensor == nullptr ? kTfLiteNoType : _tensor->type;
+            }
+
+        protected:
+            const TfLiteTensor *_tensor;
+            uint32_t _length;
+        };
+    }
+}
+
+#endif //ELOQUENTTINYML_OUTPUT_VIEW_H
@@ -0,0 +1,172 @@
+#ifndef ELOQUENTTINYML_PROFILER_H
+#define ELOQUENTTINYML_PROFILER_H
+
+#ifndef TF_PROFILER_MAX_OPS
+#define TF_PROFILER_MAX_OPS 64
+#endif
+
+#include "./benchmark.h"
+
+
+namespace Eloquent {
+    namespace TF {
+        using Eloquent::Extra::Time::Clock;
+
+        /**
+         * Per-node timing entry
+         */
+        struct OpProfile {
+            const char *op;
+            uint16_t node;
+            uint32_t calls;
+            Clock::Ticks totalTicks;
+            Clock::Ticks maxTicks;
+            Clock::Ticks startedAt;
+        };
+
+        /**
+         * Per-operator profiler for MicroInterpreter.
+         * Attach to Sequential with tf.setProfiler(&profiler) before begin().
+         * Nodes are indexed in execution order: ops inside control-flow
+         * subgraphs (e.g. WHILE) get their own entries
+         */
+        class OpProfiler : public tflite::MicroProfilerInterface {
+        public:
+
+            /**
+             * Constructor
+             */
+            OpProfiler() :
+                _numEntries(0),
+                _cursor(0) {
+                // on Cortex-M the cycle counter is off at boot
+                Clock::begin();
+            }
+
+            /**
+             * Clear all stats
+             */
+            void reset() {
+                _numEntries = 0;
+                _cursor = 0;
+            }
+
+            /**
+             * Called by Sequential before each Invoke()
+             */
+            void beginInvoke() {
+                _cursor = 0;
+            }
+
+            /**
+             * Called by MicroInterpreter before each op
+             */
+            uint32_t BeginEvent(const char *tag) override {
+                if (_cursor >= TF_PROFILER_MAX_OPS)
+                    return TF_PROFILER_MAX_OPS;
+
+                const uint16_t i = _cursor++;
+                OpProfile& entry = _entries[i];
+
+                if (i >= _numEntries) {
+                    entry.op = tag;
+                    entry.node = i;
+                    entry.calls = 0;
+                    entry.totalTicks = 0;
+                    entry.maxTicks = 0;
+                    _numEntries = i + 1;
+                }
+
+                entry.startedAt = Clock::now();
+
+                return i;
+            }
+
+            /**
+             * Called by MicroInterpreter after each op
+             */
+            void EndEvent(uint32_t handle) override {
+                if (handle >= _numEntries)
+                    return;
+
+                OpProfile& entry = _entries[handle];
+                const Clock::Ticks elapsed = Clock::now() - entry.startedAt;
+
+                entry.calls += 1;
+                entry.totalTicks += elapsed;
+
+                if (elapsed > entry.maxTicks)
+                    entry.maxTicks = elapsed;
+            }
+
+            /**
+             * Get number of profiled nodes
+             */
+            inline uint16_t length() const {
+                return _numEntries;
+            }
+
+            /**
+             * Get i-th node stats
+             */
+            inline const OpProfile& operator[](uint16_t i) const {
+                return _entries[i];
+            }
+
+            /**
+             * Print human readable table (e.g. to Serial)
+             */
+            template<typename Printer>
+            void print(Printer& printer) const {
+                const float ticksPerMicro = Clock::ticksPerMicro();
+
+                printer.println("node\top\tcalls\ttotal(us)\tavg(us)\tmax(us)");
+
+                for (uint16_t i = 0; i < _numEntries; i++) {
+                    const OpProfile& entry = _entries[i];
+
+                    printer.print(entry.node);
+                    printer.print('\t');
+                    printer.print(entry.op);
+                    printer.print('\t');
+                    printer.print(entry.calls);
+                    printer.print('\t');
+                    printer.print(entry.totalTicks / ticksPerMicro);
+                    printer.print('\t');
+                    printer.print(entry.calls ? entry.totalTicks / ticksPerMicro / entry.calls : 0);
+                    printer.print('\t');
+                    printer.println(entry.maxTicks / ticksPerMicro);
+                }
+            }
+
+            /**
+             * Print CSV (ticks)
+             */
+            template<typename Printer>
+            void printCsv(Printer& printer) const {
+                printer.println("node,op,calls,total_ticks,max_ticks");
+
+                for (uint16_t i = 0; i < _numEntries; i++) {
+                    const OpProfile& entry = _entries[i];
+
+                    printer.print(entry.node);
+                    printer.print(',');
+                    printer.print(entry.op);
+                    printer.print(',');
+                    printer.print(entry.calls);
+                    printer.print(',');
+                    printer.print(entry.totalTicks);
+                    printer.print(',');
+                    printer.println(entry.maxTicks);
+                }
+            }
+
+        protected:
+            uint16_t _numEntries;
+            uint16_t _cursor;
+            OpProfile _entries[TF_PROFILER_MAX_OPS];
+        };
+    }
+}
+
+#endif //ELOQUENTTINYML_PROFILER_H
@@ -0,0 +1,154 @@
+#ifndef ELOQUENTTINYML_QUANTIZE_H
+#define ELOQUENTTINYML_QUANTIZE_H
+
+// SSAT16 / UXTB16 (Cortex-M4/M7/M33 and other cores with the DSP extension)
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define ELOQUENT_QUANTIZE_SIMD32
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+namespace Eloquent {
+    namespace TF {
+        namespace Kernels {
+            /**
+             * Quantize a single float to int8 as
+             * y = clamp(round(x / scale) + zeroPoint, -128, 127)
+             * Rounding is half away from zero, like TfLiteRound().
+             * The value is clamped in the float domain before the
+             * integer cast (out of range floats can't overflow it).
+             * NaN maps to zeroPoint, i.e. to 0.0
+             */
+            inline int8_t quantize(float x, float scale, int32_t zeroPoint) {
+                const float lo = -128.0f - zeroPoint;
+                const float hi = 127.0f - zeroPoint;
+                float v = x / scale;
+
+                v = v == v ? v : 0;
+                v = v < lo ? lo : (v > hi ? hi : v);
+
+                // bounds are integers, so rounding can't push the value out of range
+                return (int8_t) (((int32_t) (v + (v >= 0 ? 0.5f : -0.5f))) + zeroPoint);
+            }
+
+            /**
+             * Quantize float array to int8, one element at a time.
+             * Branch-free, so the compiler can auto-vectorize it
+             */
+            inline void quantizePortable(const float *x, int8_t *y, size_t length, float scale, int32_t zeroPoint) {
+                for (size_t i = 0; i < length; i++)
+                    y[i] = quantize(x[i], scale, zeroPoint);
+            }
+
+            /**
+             * Saturate a and b to [-128, 127] and return them as
+             * bytes 0 and 2 of a word (SSAT16 + UXTB16 on SIMD32 cores).
+             * a and b must fit in 16 bits
+             */
+            inline uint32_t saturatePair(int32_t a, int32_t b) {
+            #if defined(ELOQUENT_QUANTIZE_SIMD32)
+                return __uxtb16(__ssat16((int32_t) ((((uint32_t) a) & 0xFFFF) | (((uint32_t) b) << 16)), 8));
+            #else
+                a = a < -128 ? -128 : (a > 127 ? 127 : a);
+                b = b < -128 ? -128 : (b > 127 ? 127 : b);
+
+                return ((uint32_t) (uint8_t) a) | (((uint32_t) (uint8_t) b) << 16);
+            #endif
+            }
+
+            /**
+             * Quantize float array to int8, 4 elements at a time.
+             * Multiplies by a precomputed 1 / scale instead of dividing,
+             * saturates two elements per instruction and writes four
+             * per word store. At exact ties, x * (1 / scale) can round
+             * one step away from x / scale: results may differ by 1
+             * from quantize(). y must be word-aligned.
+             * @return number of elements processed (a multiple of 4)
+             */
+            inline size_t quantizeSIMD(const float *x, int8_t *y, size_t length, float scale, int32_t zeroPoint) {
+                const float inv = 1.0f / scale;
+                uint32_t *y32 = (uint32_t*) y;
+                size_t i = 0;
+
+                for (; i + 4 <= length; i += 4) {
+                    int32_t q[4];
+
+                    for (uint8_t j = 0; j < 4; j++) {
+                        float v = x[i + j] * inv;
+
+                        // +-256 keeps v + zeroPoint in 16 bits: the int8
+                        // saturation happens after the zero point is added
+                        v = v == v ? v : 0;
+                        v = v < -256.0f ? -256.0f : (v > 256.0f ? 256.0f : v);
+                        q[j] = ((int32_t) (v + (v >= 0 ? 0.5f : -0.5f))) + zeroPoint;
+                    }
+
+                    // pair (0, 2) and (1, 3) so the bytes interleave in order
+                    *y32++ = saturatePair(q[0], q[2]) | (saturatePair(q[1], q[3]) << 8);
+                }
+
+                return i;
+            }
+
+            /**
+             * Quantize float array to int8.
+             * On SIMD32 cores (with a word-aligned destination) uses
+             * quantizeSIMD(), else matches TFLM's quantize exactly
+             */
+            inline void quantize(const float *x, int8_t *y, size_t length, float scale, int32_t zeroPoint) {
+                size_t i = 0;
+
+            #if defined(ELOQUENT_QUANTIZE_SIMD32)
+                if ((((uintptr_t) y) & 3) == 0)
+                    i = quantizeSIMD(x, y, length, scale, zeroPoint);
+            #endif
+
+                quantizePortable(x + i, y + i, length - i, scale, zeroPoint);
+            }
+
+            /**
+             * Convert uint8 to int8 as y = x - 128,
+             * i.e. flip the sign bit of each byte.
+             * Works 16 bytes at a time with NEON, else 4 bytes
+             * at a time with word-wide XOR. x and y may alias
+             */
+            inline void flipSign(const uint8_t *x, int8_t *y, size_t length) {
+                size_t i = 0;
+
+            #if defined(__ARM_NEON)
+                const uint8x16_t mask = vdupq_n_u8(0x80);
+
+                for (; i + 16 <= length; i += 16)
+                    vst1q_u8((uint8_t*) y + i, veorq_u8(vld1q_u8(x + i), mask));
+            #endif
+
+                // memcpy compiles to a single (unaligned-safe) load/store
+                for (; i + 4 <= length; i += 4) {
+                    uint32_t word;
+
+                    memcpy(&word, x + i, 4);
+                    word ^= 0x80808080UL;
+                    memcpy(y + i, &word, 4);
+                }
+
+                for (; i < length; i++)
+                    y[i] = (int8_t) (x[i] ^ 0x80);
+            }
+
+            /**
+             * Dequantize int8 array to float as
+             * y = (x - zeroPoint) * scale
+             */
+            inline void dequantize(const int8_t *x, float *y, size_t length, float scale, int32_t zeroPoint) {
+                for (size_t i = 0; i < length; i++)
+                    y[i] = (x[i] - zeroPoint) * scale;
+            }
+        }
+    }
+}
+
+#endif //ELOQUENTTINYML_QUANTIZE_H
@@ -0,0 +1,55 @@
+#ifndef ELOQUENTTINYML_TENSOR_INFO_H
+#define ELOQUENTTINYML_TENSOR_INFO_H
+
+#ifndef TF_MAX_INPUTS
+#define TF_MAX_INPUTS 4
+#endif
+
+#ifndef TF_MAX_OUTPUTS
+#define TF_MAX_OUTPUTS 4
+#endif
+
+
+namespace Eloquent {
+    namespace TF {
+        /**
+         * Per-tensor metadata, cached at begin()
+         */
+        struct TensorInfo {
+            TfLiteTensor *tensor;
+            uint32_t length;
+            TfLiteType type;
+            float scale;
+            int32_t zeroPoint;
+
+            /**
+             * Constructor
+             */
+            TensorInfo() :
+                tensor(nullptr),
+                length(0),
+                type(kTfLiteNoType),
+                scale(0),
+                zeroPoint(0) {
+
+            }
+
+            /**
+             * Bind to tensor
+             */
+            void bind(TfLiteTensor *t) {
+                tensor = t;
+                type = t->type;
+                scale = t->params.scale;
+                zeroPoint = t->params.zero_point;
+                length = 1;
+
+                if (t->dims != nullptr)
+                    for (int i = 0; i < t->dims->size; i++)
+                        length *= t->dims->data[i];
+            }
+        };
+    }
+}
+
+#endif //ELOQUENTTINYML_TENSOR_INFO_H
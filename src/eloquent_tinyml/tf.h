@@ -7,19 +7,45 @@
 
 #include "./exception.h"
 #include "./benchmark.h"
+#include "./input_view.h"
+#include "./output_view.h"
+#include "./quantize.h"
+#include "./argmax.h"
+#include "./tensor_info.h"
+#include "./profiler.h"
+#include "./arena.h"
+#include "./ops.h"
+#include "./model_loader.h"
+#include <new>
+#include <type_traits>
 
 using Eloquent::Error::Exception;
+using Eloquent::Error::ErrorCode;
 using Eloquent::Extra::Time::Benchmark;
-using eloq::tf::newInterpreter;
+using Eloquent::Extra::Time::PhaseTimer;
+using Eloquent::TF::InputView;
+using Eloquent::TF::OutputView;
+using Eloquent::TF::TensorInfo;
+using Eloquent::TF::OpProfiler;
+using Eloquent::TF::ModelLoader;
+using Eloquent::TF::OpList;
 
 
 namespace Eloquent {
     namespace TF {
         /**
-         * Run TensorFlow model
+         * Run TensorFlow model.
+         * Set NumIn/NumOut (and InT/OutT) to fix the input/output
+         * shape and dtype at compile time: copy and argmax loops get
+         * a constant trip count and begin() checks them against the model.
+         * ArenaPolicy selects where the tensor arena lives (see arena.h)
          */
-        template<uint8_t numOps, size_t tensorArenaSize>
+        template<uint8_t numOps, size_t tensorArenaSize, uint32_t NumIn = 0, uint32_t NumOut = 0, typename InT = float, typename OutT = float, template<size_t> class ArenaPolicy = Arena::Internal>
         class Sequential {
+            static_assert((NumIn == 0) == (NumOut == 0), "NumIn and NumOut must be both set or both 0");
+            static_assert(TensorType<InT>::value != kTfLiteNoType, "InT must be float, int8_t or uint8_t");
+            static_assert(TensorType<OutT>::value != kTfLiteNoType, "OutT must be float, int8_t or uint8_t");
+
         public:
             const Model *model;
             MicroMutableOpResolver<numOps> resolver;
@@ -27,52 +53,156 @@ namespace Eloquent {
             TfLiteTensor *in;
             TfLiteTensor *out;
             Exception exception;
-            uint8_t arena[tensorArenaSize];
-            uint16_t numInputs;
-            uint16_t numOutputs;
+            ArenaPolicy<tensorArenaSize> arena;
+            bool opsRegistered;
+            uint32_t numInputs;
+            uint32_t numOutputs;
+            TensorInfo inputTensors[TF_MAX_INPUTS];
+            TensorInfo outputTensors[TF_MAX_OUTPUTS];
+            uint8_t numInputTensors;
+            uint8_t numOutputTensors;
             uint8_t classification;
+            float score;
             Benchmark benchmark;
-            float *outputs;
+            PhaseTimer phases;
+            OpProfiler *profiler;
 
             /**
              * Constructor
              */
             Sequential() :
-                exception("TF"),
                 model(nullptr),
                 interpreter(nullptr),
                 in(nullptr),
                 out(nullptr),
-                numInputs(0),
-                numOutputs(0),
+                exception("TF"),
+                opsRegistered(false),
+                numInputs(NumIn),
+                numOutputs(NumOut),
+                numInputTensors(0),
+                numOutputTensors(0),
                 classification(255),
-                outputs(NULL)
+                score(0),
+                profiler(nullptr)
             {
 
             }
 
+            Sequential(const Sequential&) = delete;
+            Sequential& operator=(const Sequential&) = delete;
+
+            /**
+             * Destructor.
+             * Destroys the interpreter and frees (or gives back) the arena
+             */
+            ~Sequential() {
+                end();
+            }
+
             /**
              * Set number of inputs
              */
-            void setNumInputs(uint16_t n) {
-                numInputs = n;
+            void setNumInputs(uint32_t n) {
+                if (!NumIn)
+                    numInputs = n;
             }
 
             /**
              * Set number of outputs
              */
-            void setNumOutputs(uint16_t n) {
-                numOutputs = n;
+            void setNumOutputs(uint32_t n) {
+                if (!NumOut)
+                    numOutputs = n;
+            }
+
+            /**
+             * Attach per-operator profiler.
+             * Must be called before begin()
+             */
+            void setProfiler(OpProfiler *p) {
+                profiler = p;
+            }
+
+            /**
+             * Get length of (first) input tensor
+             */
+            inline uint32_t inputLength() const {
+                return NumIn ? NumIn : numInputs;
             }
 
             /**
-             * Get i-th output
+             * Get length of (first) output tensor
              */
-            float output(uint16_t i = 0) {
-                if (outputs == NULL || i >= numOutputs)
+            inline uint32_t outputLength() const {
+                return NumOut ? NumOut : numOutputs;
+            }
+
+            /**
+             * Get i-th output (of given output tensor)
+             */
+            float output(uint32_t i = 0, uint8_t tensorIndex = 0) {
+                OutputView y = outputs(tensorIndex);
+
+                if (!y || i >= y.length())
                     return sqrt(-1);
 
-                return outputs[i];
+                return y[i];
+            }
+
+            /**
+             * Get a view over the given output tensor.
+             * Elements are dequantized when read
+             */
+            OutputView outputs(uint8_t tensorIndex = 0) {
+                if (tensorIndex >= numOutputTensors)
+                    return OutputView();
+
+                if (tensorIndex == 0)
+                    return OutputView(out, outputLength());
+
+                return OutputView(outputTensors[tensorIndex].tensor, outputTensors[tensorIndex].length);
+            }
+
+            /**
+             * Copy (dequantized) outputs to given array.
+             * For int8 models, classification and score are
+             * refreshed in the same pass
+             */
+            Exception& copyOutputs(float *y) {
+                if (out == nullptr)
+                    return exception.set(ErrorCode::NOT_READY, "You must call begin() first");
+
+                if (out->type == kTfLiteFloat32) {
+                    memcpy(y, out->data.f, sizeof(float) * outputLength());
+                    return exception;
+                }
+
+                if (out->type == kTfLiteInt8) {
+                    classification = Kernels::dequantizeArgmax(out->data.int8, y, outputLength(), out->params.scale, out->params.zero_point, score);
+                    return exception;
+                }
+
+                OutputView y_ = outputs();
+
+                for (uint32_t i = 0; i < outputLength(); i++)
+                    y[i] = y_[i];
+
+                return exception;
+            }
+
+            /**
+             * Copy raw int8 outputs to given array
+             */
+            Exception& copyOutputs(int8_t *y) {
+                if (out == nullptr)
+                    return exception.set(ErrorCode::NOT_READY, "You must call begin() first");
+
+                if (out->type != kTfLiteInt8)
+                    return exception.set(ErrorCode::DTYPE, String("Output dtype mismatch: tensor is ") + TfLiteTypeGetName(out->type));
+
+                memcpy(y, out->data.int8, sizeof(int8_t) * outputLength());
+
+                return exception;
             }
 
             /**
@@ -90,181 +220,603 @@ namespace Eloquent {
                 #endif
 
                 if (!numInputs)
-                    return exception.set("You must set the number of inputs");
+                    return exception.set(ErrorCode::SHAPE, "You must set the number of inputs");
 
                 if (!numOutputs)
-                    return exception.set("You must set the number of outputs");
+                    return exception.set(ErrorCode::SHAPE, "You must set the number of outputs");
+
+                // ops are registered only once,
+                // so begin() can be called again (e.g. after end())
+                if (!opsRegistered && !registerOps().isOk())
+                    return exception;
+
+                const char *missing = nullptr;
+                model = tflite::GetModel(data);
+
+                if (model->version() != TFLITE_SCHEMA_VERSION)
+                    return exception.set(ErrorCode::MODEL, String("Model version mismatch. Expected ") + TFLITE_SCHEMA_VERSION + ", got " + model->version());
+
+                #if defined(TF_AUTO_OPS) && defined(TF_OPS)
+                // register exactly the ops the model uses, among TF_OPS
+                if (!Ops::addAll<OpList<TF_OPS>>(resolver, model, numOps, exception))
+                    return exception;
+                #elif defined(TF_AUTO_OPS)
+                // register exactly the ops the model uses (links all kernels)
+                if (!Ops::addAll<AllOps>(resolver, model, numOps, exception))
+                    return exception;
+                #endif
+
+                if (!Ops::allRegistered(resolver, model, missing))
+                    return exception.set(ErrorCode::OPS, String("Op not registered: ") + missing + " (model needs numOps >= " + Ops::count(model) + ")");
+
+                if (!arena.alloc())
+                    return exception.set(ErrorCode::ALLOC, String("Cannot allocate tensor arena of ") + arena.size() + " bytes");
+
+                // evict current owner of a shared arena
+                arena.acquire(this, &Sequential::evict);
+
+                return allocate();
+            }
+
+            /**
+             * Init model from file, partition or memory.
+             * The loader must outlive the Sequential
+             */
+            Exception& begin(const ModelLoader& loader) {
+                if (loader.data() == nullptr)
+                    return exception.set(ErrorCode::MODEL, "Model not loaded");
+
+                return begin(loader.data());
+            }
+
+            /**
+             * Swap model without reconstructing Sequential.
+             * Arena and registered ops are reused: all the ops of the
+             * new model must already be registered.
+             * If the new model can't be allocated, the previous one
+             * is restored and the error is returned
+             */
+            Exception& reload(const unsigned char *data) {
+                if (model == nullptr)
+                    return begin(data);
+
+                const Model *next = tflite::GetModel(data);
+                const char *missing = nullptr;
+
+                if (next->version() != TFLITE_SCHEMA_VERSION)
+                    return exception.set(ErrorCode::MODEL, String("Model version mismatch. Expected ") + TFLITE_SCHEMA_VERSION + ", got " + next->version());
+
+                if (!Ops::allRegistered(resolver, next, missing))
+                    return exception.set(ErrorCode::OPS, String("Op not registered: ") + missing);
+
+                const Model *prev = model;
+
+                model = next;
+                arena.acquire(this, &Sequential::evict);
+
+                if (allocate().isOk())
+                    return exception;
+
+                // keep running the previous model, but report the failure
+                const Exception failure = exception;
+
+                model = prev;
+                allocate();
+                exception = failure;
+
+                return exception;
+            }
+
+            /**
+             * Swap model with one from file, partition or memory
+             */
+            Exception& reload(const ModelLoader& loader) {
+                if (loader.data() == nullptr)
+                    return exception.set(ErrorCode::MODEL, "Model not loaded");
+
+                return reload(loader.data());
+            }
+
+            /**
+             * Release interpreter and (heap/PSRAM) arena.
+             * Call begin() again to reuse: until then, input(),
+             * invoke() and predict() fail with NOT_READY
+             */
+            Exception& end() {
+                destroyInterpreter();
+                model = nullptr;
+                in = nullptr;
+                out = nullptr;
+                numInputTensors = 0;
+                numOutputTensors = 0;
+                arena.free();
+
+                return exception.clear();
+            }
+
+            /**
+             * Count input/output tensors whose buffer is not
+             * aligned to TF_ARENA_ALIGNMENT
+             */
+            uint8_t countMisalignedTensors() {
+                uint8_t count = 0;
+
+                for (uint8_t i = 0; i < numInputTensors; i++)
+                    if (((uintptr_t) inputTensors[i].tensor->data.raw) % TF_ARENA_ALIGNMENT)
+                        count++;
+
+                for (uint8_t i = 0; i < numOutputTensors; i++)
+                    if (((uintptr_t) outputTensors[i].tensor->data.raw) % TF_ARENA_ALIGNMENT)
+                        count++;
+
+                return count;
+            }
+
+            /**
+             * Get number of distinct ops used by the model
+             * (the minimum value for numOps)
+             */
+            uint16_t requiredNumOps() {
+                return model == nullptr ? 0 : Ops::count(model);
+            }
+
+            /**
+             * Get number of arena bytes actually used by the model
+             */
+            size_t arenaUsedBytes() {
+                return interpreter == nullptr ? 0 : interpreter->arena_used_bytes();
+            }
+
+            /**
+             * Find the smallest arena the model can be allocated in,
+             * by binary search between a floor and the arena size.
+             * The floor is TF_MIN_ARENA_SIZE or 3/4 of the bytes used
+             * by the current allocation, whichever is larger: TFLM is not
+             * guaranteed to fail cleanly with arenas of a few bytes.
+             * Each step re-plans the whole model: it's slow, meant to be
+             * run once on host or at development time, not in production.
+             * Must be called after begin(): the model is re-allocated at the end
+             */
+            size_t findMinArenaSize() {
+                if (model == nullptr || arena.data() == nullptr)
+                    return 0;
+
+                const size_t used = arenaUsedBytes();
+                size_t lo = used - used / 4 > TF_MIN_ARENA_SIZE ? used - used / 4 : TF_MIN_ARENA_SIZE;
+                size_t hi = arena.size();
+
+                if (lo > hi)
+                    lo = hi;
+
+                // trials share the arena with the current interpreter
+                destroyInterpreter();
+
+                if (!tryArenaSize(hi)) {
+                    allocate();
+                    return 0;
+                }
+
+                while (lo < hi) {
+                    const size_t mid = lo + (hi - lo) / 2;
+
+                    if (tryArenaSize(mid))
+                        hi = mid;
+                    else
+                        lo = mid + 1;
+                }
+
+                allocate();
+
+                return hi;
+            }
+
+            /**
+             * Print the ARENA_SIZE to use for this model
+             */
+            template<typename Printer>
+            void printMinArenaSize(Printer& printer) {
+                const size_t size = findMinArenaSize();
+
+                if (!size) {
+                    printer.println("Model doesn't fit in the current arena: increase ARENA_SIZE");
+                    return;
+                }
+
+                printer.print("#define ARENA_SIZE ");
+                printer.println(size);
+            }
+
+            /**
+             * Copy input to the input tensor and run model.
+             * T must match the tensor dtype (float, int8_t or uint8_t).
+             * When NumIn is set, T must be InT (checked at compile time)
+             * and the copy has a constant size
+             */
+            template<typename T>
+            Exception& predict(const T *x) {
+                static_assert(TensorType<T>::value != kTfLiteNoType, "predict() input must be float, int8_t or uint8_t");
+                static_assert(!NumIn || std::is_same<T, InT>::value, "predict() input must be InT");
+
+                phases.start();
+                InputView<T> x_ = input<T>();
+
+                if (!x_)
+                    return exception;
+
+                // skip copy if caller filled the input view in place
+                if (x != x_.data())
+                    memcpy(x_.data(), x, sizeof(T) * inputLength());
 
+                return run();
+            }
+
+            /**
+             *
+             */
+            Exception& predictInt8(const float *x) {
+                phases.start();
+                InputView<int8_t> x_ = input<int8_t>();
+
+                if (!x_)
+                    return exception;
+
+                Kernels::quantize(x, x_.data(), inputLength(), in->params.scale, in->params.zero_point);
+
+                return run();
+            }
+
+            /**
+             * Fill multiple input tensors and run model once.
+             * i-th argument goes to i-th input tensor
+             */
+            template<typename T0, typename T1, typename... Ts>
+            Exception& predict(const T0 *x0, const T1 *x1, const Ts*... xs) {
+                phases.start();
+
+                if (!fillInputs(0, x0, x1, xs...))
+                    return exception;
+
+                return run();
+            }
+
+            /**
+             * Get a typed view over the given input tensor.
+             * Write the input directly into it, then call invoke()
+             * to run the model without copying the input
+             */
+            template<typename T>
+            InputView<T> input(uint8_t tensorIndex = 0) {
+                if (!ensureArena() || in == nullptr) {
+                    exception.set(ErrorCode::NOT_READY, "You must call begin() first");
+                    return InputView<T>();
+                }
+
+                if (tensorIndex >= numInputTensors) {
+                    exception.set(ErrorCode::SHAPE, String("Input tensor index out of range: model has ") + numInputTensors + " inputs");
+                    return InputView<T>();
+                }
+
+                const TensorInfo& info = inputTensors[tensorIndex];
+                const uint32_t length = tensorIndex == 0 ? inputLength() : info.length;
+
+                if (info.type != TensorType<T>::value) {
+                    exception.set(ErrorCode::DTYPE, String("Input dtype mismatch: tensor is ") + TfLiteTypeGetName(info.type));
+                    return InputView<T>();
+                }
+
+                if (info.tensor->bytes < sizeof(T) * length) {
+                    exception.set(ErrorCode::SHAPE, String("Input tensor holds ") + (info.tensor->bytes / sizeof(T)) + " elements, expected " + length);
+                    return InputView<T>();
+                }
+
+                return InputView<T>((T*) info.tensor->data.raw, length);
+            }
+
+            /**
+             * Run model on the current content of the input tensor
+             */
+            Exception& invoke() {
+                if (!ensureArena() || in == nullptr)
+                    return exception.set(ErrorCode::NOT_READY, "You must call begin() first");
+
+                phases.start();
+
+                return run();
+            }
+
+            /**
+             * Zero the model's state (e.g. LSTM hidden and cell state).
+             * Variable tensors carry over from one predict() to the next:
+             * call this between independent windows
+             */
+            Exception& reset() {
+                if (!ensureArena() || in == nullptr)
+                    return exception.set(ErrorCode::NOT_READY, "You must call begin() first");
+
+                if (interpreter->Reset() != kTfLiteOk)
+                    return exception.set(ErrorCode::INVOKE, "Reset() failed");
+
+                return exception.clear();
+            }
+
+        protected:
+            alignas(MicroInterpreter) uint8_t _interpreterStorage[sizeof(MicroInterpreter)];
+
+            /**
+             * Make sure the arena holds this model's tensors.
+             * Only shared (pooled) arenas can be lost to another model:
+             * in that case, tensors are re-planned
+             */
+            inline bool ensureArena() {
+                if (model == nullptr || arena.data() == nullptr)
+                    return false;
+
+                if (arena.acquire(this, &Sequential::evict) && interpreter != nullptr)
+                    return true;
+
+                return allocate().isOk();
+            }
+
+            /**
+             * Drop interpreter when another model takes the shared arena
+             */
+            static void evict(void *self) {
+                Sequential *tf = (Sequential*) self;
+
+                tf->destroyInterpreter();
+                tf->in = nullptr;
+                tf->out = nullptr;
+                tf->numInputTensors = 0;
+                tf->numOutputTensors = 0;
+            }
+
+            /**
+             * Destroy in-place interpreter
+             */
+            void destroyInterpreter() {
+                if (interpreter != nullptr)
+                    interpreter->~MicroInterpreter();
+
+                interpreter = nullptr;
+            }
+
+            /**
+             * Register ops listed by TF_OPS and TF_OP_* macros
+             * (ops already in the resolver are skipped).
+             * With TF_AUTO_OPS, TF_OPS is only the set begin()
+             * picks the model's ops from: nothing is registered here.
+             * Fails if the resolver runs out of slots
+             */
+            Exception& registerOps() {
+                uint8_t failures = 0;
+
+                #if defined(TF_OPS) && !defined(TF_AUTO_OPS)
+                failures += OpList<TF_OPS>::registerIn(resolver) != kTfLiteOk;
+                #endif
                 #ifdef TF_OP_ADD
-                resolver.AddAdd();
+                failures += Op::Add::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_AVERAGEPOOL2D
-                resolver.AddAveragePool2D();
+                failures += Op::AveragePool2D::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_CONCATENATION
-                resolver.AddConcatenation();
+                failures += Op::Concatenation::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_CONV2D
-                resolver.AddConv2D();
+                failures += Op::Conv2D::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_DEPTHWISECONV2D
-                resolver.AddDepthwiseConv2D();
+                failures += Op::DepthwiseConv2D::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_ELU
-                resolver.AddElu();
+                failures += Op::Elu::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_FULLYCONNECTED
-                resolver.AddFullyConnected();
+                failures += Op::FullyConnected::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_LEAKYRELU
-                resolver.AddLeakyRelu();
+                failures += Op::LeakyRelu::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_MAXPOOL2D
-                resolver.AddMaxPool2D();
+                failures += Op::MaxPool2D::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_MAXIMUM
-                resolver.AddMaximum();
+                failures += Op::Maximum::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_MINIMUM
-                resolver.AddMinimum();
+                failures += Op::Minimum::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_RELU
-                resolver.AddRelu();
+                failures += Op::Relu::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_RESHAPE
-                resolver.AddReshape();
+                failures += Op::Reshape::add(resolver) != kTfLiteOk;
                 #endif
                 #ifdef TF_OP_SOFTMAX
-                resolver.AddSoftmax();
+                failures += Op::Softmax::add(resolver) != kTfLiteOk;
                 #endif
 
-                model = tflite::GetModel(data);
-
-                if (model->version() != TFLITE_SCHEMA_VERSION)
-                    return exception.set(String("Model version mismatch. Expected ") + TFLITE_SCHEMA_VERSION + ", got " + model->version());
-
-                interpreter = newInterpreter<numOps>(&resolver, model, arena, tensorArenaSize);
-
-                if (interpreter->AllocateTensors() != kTfLiteOk)
-                    return exception.set("AllocateTensors() failed");
-
-                in = interpreter->input(0);
-                out = interpreter->output(0);
+                if (failures)
+                    return exception.set(ErrorCode::OPS, String("Cannot register ops: resolver is full (numOps is ") + numOps + ")");
 
-                // allocate outputs
-                outputs = (float*) calloc(numOutputs, sizeof(float));
+                opsRegistered = true;
 
                 return exception.clear();
             }
 
             /**
-             *
+             * Create interpreter, allocate tensors and
+             * cache tensor metadata
              */
-            Exception& predict(float *x) {
-                const float inputScale = in->params.scale;
-                const float inputOffset = in->params.zero_point;
-                const float outputScale = out->params.scale;
-                const float outputOffset = out->params.zero_point;
+            Exception& allocate() {
+                destroyInterpreter();
+                in = nullptr;
+                out = nullptr;
+                numInputTensors = 0;
+                numOutputTensors = 0;
 
-//                ESP_LOGI("TF", "this->input.offset=%.4f, this->input.scale=%.4f", inputOffset, inputScale);
+                // construct in place: reload() never touches the heap
+                interpreter = new (_interpreterStorage) MicroInterpreter(model, resolver, arena.data(), arena.size(), nullptr, profiler);
 
-                for (uint16_t i = 0; i < numInputs; i++)
-                    in->data.f[i] = x[i];
+                if (interpreter->AllocateTensors() != kTfLiteOk)
+                    return exception.set(ErrorCode::ALLOC, String("AllocateTensors() failed in a ") + arena.size() + " bytes arena");
 
-                benchmark.start();
+                if (interpreter->inputs_size() > TF_MAX_INPUTS)
+                    return exception.set(ErrorCode::SHAPE, String("Model has ") + interpreter->inputs_size() + " inputs: define TF_MAX_INPUTS accordingly");
 
-                if (interpreter->Invoke() != kTfLiteOk)
-                    return exception.set("Invoke() failed");
+                if (interpreter->outputs_size() > TF_MAX_OUTPUTS)
+                    return exception.set(ErrorCode::SHAPE, String("Model has ") + interpreter->outputs_size() + " outputs: define TF_MAX_OUTPUTS accordingly");
 
-                for (uint16_t i = 0; i < numOutputs; i++) {
-                    ESP_LOGI("TF", "this->out.f[%d] = %.4f, this->out.int8[%d] = %d", i, out->data.f[i], i, (int) out->data.int8[i]);
-                    outputs[i] = out->data.f[i];
-                }
+                numInputTensors = interpreter->inputs_size();
+                numOutputTensors = interpreter->outputs_size();
 
-                getClassificationResult();
-                benchmark.stop();
+                for (uint8_t i = 0; i < numInputTensors; i++)
+                    inputTensors[i].bind(interpreter->input(i));
 
-                return exception.clear();
-            }
+                for (uint8_t i = 0; i < numOutputTensors; i++)
+                    outputTensors[i].bind(interpreter->output(i));
 
-            /**
-             *
-             */
-            Exception& predictInt8(float *x) {
-                const float inputScale = in->params.scale;
-                const float inputOffset = in->params.zero_point;
-                const float outputScale = out->params.scale;
-                const float outputOffset = out->params.zero_point;
+                in = inputTensors[0].tensor;
+                out = outputTensors[0].tensor;
 
-                ESP_LOGI("TF", "input.offset=%.4f, input.scale=%.4f", inputOffset, inputScale);
+                #ifdef TF_DEBUG_ALIGNMENT
+                if (const uint8_t misaligned = countMisalignedTensors())
+                    return exception.set(ErrorCode::ALLOC, String(misaligned) + " input/output tensors are not aligned to " + TF_ARENA_ALIGNMENT + " bytes");
+                #endif
 
-                for (uint16_t i = 0; i < numInputs; i++)
-                    in->data.int8[i] = (x[i] * inputScale) + inputOffset;
+                // outputs(), copyOutputs() and argmax read outputLength() elements
+                if (!NumIn && inputTensors[0].length < numInputs)
+                    return exception.set(ErrorCode::SHAPE, String("Model input holds ") + inputTensors[0].length + " elements, numInputs is " + numInputs);
 
-                benchmark.start();
+                if (!NumOut && outputTensors[0].length < numOutputs)
+                    return exception.set(ErrorCode::SHAPE, String("Model output holds ") + outputTensors[0].length + " elements, numOutputs is " + numOutputs);
 
-                if (interpreter->Invoke() != kTfLiteOk)
-                    return exception.set("Invoke() failed");
+                if (NumIn) {
+                    if (inputTensors[0].length != NumIn || inputTensors[0].type != TensorType<InT>::value)
+                        return exception.set(ErrorCode::SHAPE, String("Model input is ") + inputTensors[0].length + "x" + TfLiteTypeGetName(inputTensors[0].type) + ", expected " + NumIn + "x" + TfLiteTypeGetName(TensorType<InT>::value));
 
-                for (uint16_t i = 0; i < numOutputs; i++) {
-                    ESP_LOGI("TF", "out.f[%d] = %.4f, out.int8[%d] = %d", i, out->data.f[i], i, (int) out->data.int8[i]);
-                    outputs[i] = out->data.f[i];
+                    if (outputTensors[0].length != NumOut || outputTensors[0].type != TensorType<OutT>::value)
+                        return exception.set(ErrorCode::SHAPE, String("Model output is ") + outputTensors[0].length + "x" + TfLiteTypeGetName(outputTensors[0].type) + ", expected " + NumOut + "x" + TfLiteTypeGetName(TensorType<OutT>::value));
                 }
 
-                getClassificationResult();
-                benchmark.stop();
-
                 return exception.clear();
             }
 
             /**
-             *
+             * Test if model can be allocated in the given arena size
              */
-            Exception& predict(int8_t *x) {
-                // quantization
-                const float inputScale = in->params.scale;
-                const float inputOffset = in->params.zero_point;
-                const float outputScale = out->params.scale;
-                const float outputOffset = out->params.zero_point;
+            bool tryArenaSize(size_t size) {
+                MicroInterpreter trial(model, resolver, arena.data(), size);
 
-                memcpy(in->data.int8, x, sizeof(int8_t) * numInputs);
+                return trial.AllocateTensors() == kTfLiteOk;
+            }
 
-                // execute
+            /**
+             * Invoke interpreter and post-process outputs
+             */
+            Exception& run() {
+                phases.lapInput();
                 benchmark.start();
 
-                if (interpreter->Invoke() != kTfLiteOk)
-                    return exception.set("Invoke() failed");
+                if (profiler != nullptr)
+                    profiler->beginInvoke();
 
-                for (uint16_t i = 0; i < numOutputs; i++) {
-                    outputs[i] = out->data.int8[i];
-                }
+                if (interpreter->Invoke() != kTfLiteOk)
+                    return exception.set(ErrorCode::INVOKE, "Invoke() failed");
 
+                phases.lapInvoke();
                 getClassificationResult();
                 benchmark.stop();
+                phases.lapOutput();
 
                 return exception.clear();
             }
 
-        protected:
+            /**
+             * Copy each input array into its tensor
+             */
+            template<typename T, typename... Ts>
+            bool fillInputs(uint8_t tensorIndex, const T *x, const Ts*... xs) {
+                InputView<T> x_ = input<T>(tensorIndex);
+
+                if (!x_)
+                    return false;
+
+                if (x != x_.data())
+                    memcpy(x_.data(), x, sizeof(T) * x_.length());
+
+                return fillInputs(tensorIndex + 1, xs...);
+            }
+
+            /**
+             * End of recursion
+             */
+            bool fillInputs(uint8_t) {
+                return true;
+            }
 
             /**
-             * If classification task, get most probable class
+             * If classification task, get most probable class.
+             * Quantized outputs are compared in the integer domain
+             * and only the winner is dequantized
              */
             void getClassificationResult() {
-                if (numOutputs < 2)
+                if (outputLength() < 2)
+                    return;
+
+                if (out->type == kTfLiteInt8) {
+                    int8_t maxValue;
+
+                    classification = Kernels::argmax(out->data.int8, outputLength(), maxValue);
+                    score = (maxValue - out->params.zero_point) * out->params.scale;
+                    return;
+                }
+
+                if (out->type == kTfLiteFloat32) {
+                    classification = Kernels::argmax(out->data.f, outputLength(), score);
                     return;
+                }
 
-                float maxProba = outputs[0];
+                OutputView y = outputs();
+                score = y[0];
                 classification = 0;
 
-                for (uint16_t i = 1; i < numOutputs; i++) {
-                    if (outputs[i] > maxProba) {
+                for (uint32_t i = 1; i < outputLength(); i++) {
+                    const float proba = y[i];
+
+                    if (proba > score) {
                         classification = i;
-                        maxProba = outputs[i];
+                        score = proba;
                     }
                 }
             }
         };
+
+        /**
+         * Sequential with arena allocated on the heap at begin()
+         */
+        template<uint8_t numOps, size_t tensorArenaSize>
+        using HeapSequential = Sequential<numOps, tensorArenaSize, 0, 0, float, float, Arena::Heap>;
+
+        /**
+         * Sequential with arena allocated in PSRAM at begin()
+         */
+        template<uint8_t numOps, size_t tensorArenaSize>
+        using PSRAMSequential = Sequential<numOps, tensorArenaSize, 0, 0, float, float, Arena::PSRAM>;
+
+        /**
+         * Sequential with arena provided by the caller
+         * (with tf.arena.use(buffer, size))
+         */
+        template<uint8_t numOps>
+        using ExternalArenaSequential = Sequential<numOps, 0, 0, 0, float, float, Arena::External>;
+
+        /**
+         * Sequential that borrows its arena from a shared Arena::Pool
+         * (with tf.arena.use(pool))
+         */
+        template<uint8_t numOps>
+        using PooledSequential = Sequential<numOps, 0, 0, 0, float, float, Arena::Pooled>;
     } // namespace TF
 } // namespace Eloquent
 
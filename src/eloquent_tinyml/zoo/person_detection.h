@@ -5,40 +5,110 @@
 #define PERSON_DETECTION_ARENA_SIZE 90000L
 #endif
 
+// where to allocate the arena
+// (Eloquent::TF::Arena::Internal, Heap, PSRAM).
+// Heap and PSRAM allocate at begin() and release at end()
+#ifndef PERSON_DETECTION_ARENA_POLICY
+#define PERSON_DETECTION_ARENA_POLICY Eloquent::TF::Arena::Heap
+#endif
+
+// side of the motion gate's reference frame
+#ifndef PERSON_DETECTION_MOTION_SIZE
+#define PERSON_DETECTION_MOTION_SIZE 32
+#endif
+
+// max windows evaluated by search()
+#ifndef PERSON_DETECTION_MAX_TILES
+#define PERSON_DETECTION_MAX_TILES 128
+#endif
+
+// side of search()'s heatmap grid
+#ifndef PERSON_DETECTION_HEATMAP_SIZE
+#define PERSON_DETECTION_HEATMAP_SIZE 16
+#endif
+
 #include "../tf.h"
 #include "../exception.h"
 #include "../benchmark.h"
+#include "../image.h"
+#include "../motion_gate.h"
 #include "./person_detection_model.h"
 
+#if defined(ESP32) && defined(__has_include)
+#if __has_include(<esp_camera.h>)
+#include <esp_camera.h>
+#define PERSON_DETECTION_ESP_CAMERA
+#endif
+#endif
+
 using Eloquent::TF::Sequential;
 using Eloquent::Error::Exception;
+using Eloquent::TF::Image::PixelFormat;
+using Eloquent::TF::Image::Fit;
+using Eloquent::TF::Image::Interpolation;
+using Eloquent::TF::Image::MotionGate;
 
 
 namespace Eloquent {
     namespace TinyML {
         namespace Zoo {
+            /**
+             * A window of search()
+             */
+            struct Tile {
+                uint16_t x;
+                uint16_t y;
+                uint16_t size;
+                uint8_t score;
+                bool skipped;
+            };
+
             /**
              * Run person detection on 96x96 grayscale image
              */
             class PersonDetection {
             public:
-                Sequential<5, PERSON_DETECTION_ARENA_SIZE> tf;
+                Sequential<5, PERSON_DETECTION_ARENA_SIZE, 0, 0, float, float, PERSON_DETECTION_ARENA_POLICY> tf;
                 Exception exception;
+                MotionGate<PERSON_DETECTION_MOTION_SIZE, PERSON_DETECTION_MOTION_SIZE> motionGate;
+                Tile *tiles;
+                uint16_t numTiles;
+                int16_t bestTile;
+                bool found;
+                bool timedOut;
+                uint8_t *heatmap;
 
                 /**
                  * Constructor
                  */
                 PersonDetection() :
                     exception("PersonDetection"),
-                    _thresh(180) {
+                    tiles(nullptr),
+                    numTiles(0),
+                    bestTile(-1),
+                    found(false),
+                    timedOut(false),
+                    heatmap(nullptr),
+                    _thresh(180),
+                    _fit(Fit::CROP),
+                    _interpolation(Interpolation::AREA),
+                    _searchLevels(3),
+                    _minTileVariance(25) {
 
                 }
 
+                /**
+                 * Destructor
+                 */
+                ~PersonDetection() {
+                    freeSearch();
+                }
+
                 /**
                  * Test if a person is detected
                  */
                 operator bool() {
-                    if (exception || tf.exception)
+                    if (exception || tf.exception || !tf.outputs())
                         return false;
 
                     const uint8_t pos = personScore();
@@ -53,15 +123,37 @@ namespace Eloquent {
                  */
                 Exception& begin() {
                     tf.setNumInputs(96 * 96);
-                    tf.setNumOutputs(3);
-                    tf.resolver.AddDepthwiseConv2D();
-                    tf.resolver.AddConv2D();
-                    tf.resolver.AddAveragePool2D();
-                    tf.resolver.AddReshape();
-                    tf.resolver.AddSoftmax();
+                    tf.setNumOutputs(2);
 
+                    // ops are still registered after end()
+                    if (!tf.opsRegistered) {
+                        tf.resolver.AddDepthwiseConv2D();
+                        tf.resolver.AddConv2D();
+                        tf.resolver.AddAveragePool2D();
+                        tf.resolver.AddReshape();
+                        tf.resolver.AddSoftmax();
+                    }
+
+                    // e.g. "Cannot allocate tensor arena of 90000 bytes"
                     if (!tf.begin(eloq::tinyml::zoo::personDetectionModel).isOk())
-                        return tf.exception;
+                        return exception.set(tf.exception.code(), tf.exception.toCString());
+
+                    return exception.clear();
+                }
+
+                /**
+                 * Release arena (with Heap or PSRAM policy)
+                 * and search() buffers, and forget last results.
+                 * Call begin() again to resume detection
+                 */
+                Exception& end() {
+                    tf.end();
+                    motionGate.reset();
+                    freeSearch();
+                    numTiles = 0;
+                    bestTile = -1;
+                    found = false;
+                    timedOut = false;
 
                     return exception.clear();
                 }
@@ -72,44 +164,305 @@ namespace Eloquent {
                  * @return
                  */
                 Exception& run(uint8_t *image) {
-                    for (int i = 0; i < 96 * 96; i++)
-                        _buffer[i] = ((int16_t) image[i]) - 128;
+                    return run(image, 96, 96, PixelFormat::GRAY);
+                }
+
+                /**
+                 * Run detection on frame of any size and pixel format.
+                 * Frame is cropped (or letterboxed), downscaled and
+                 * converted to grayscale straight into the input tensor.
+                 * When the motion gate is enabled and the scene is static,
+                 * inference is skipped and the last result is kept
+                 */
+                Exception& run(const uint8_t *frame, uint16_t width, uint16_t height, PixelFormat format = PixelFormat::GRAY) {
+                    // no valid last result to reuse
+                    const bool force = tf.out == nullptr || tf.exception;
 
-                    if (!tf.predict(_buffer).isOk())
-                        return tf.exception;
+                    if (!motionGate.update(frame, width, height, format, _fit, force))
+                        return exception.clear();
+
+                    // convert straight into the input tensor
+                    Eloquent::TF::InputView<int8_t> input = tf.input<int8_t>();
+
+                    if (!input)
+                        return exception.set(tf.exception.code(), tf.exception.toCString());
+
+                    if (width == 96 && height == 96 && format == PixelFormat::GRAY)
+                        Eloquent::TF::Kernels::flipSign(frame, input.data(), input.length());
+                    else
+                        Eloquent::TF::Image::toGrayInt8(frame, width, height, format, input.data(), 96, 96, _fit, _interpolation);
+
+                    if (!tf.invoke().isOk())
+                        return exception.set(tf.exception.code(), tf.exception.toCString());
+
+                    motionGate.ran();
 
                     return exception.clear();
                 }
 
                 /**
-                 * Run detection on camera
+                 * Run detection on camera.
+                 * Pixel format is read from esp32-camera frames,
+                 * inferred from frame length for other cameras
+                 * (1 byte per pixel = grayscale, 2 = RGB565, 3 = RGB888)
                  * @param camera
                  * @return
                  */
                  template<typename Camera>
                 Exception& run(Camera& camera) {
-                    return run(camera.frame->buf);
+                    PixelFormat format;
+
+                    if (!frameFormat(camera.frame, format))
+                        return exception.set("Unsupported pixel format (JPEG?)");
+
+                    return run(camera.frame->buf, camera.frame->width, camera.frame->height, format);
                 }
 
                 /**
-                 *
+                 * Search for people in a large frame.
+                 * Square windows slide across the frame at up to
+                 * setSearchLevels() scales (each half the previous,
+                 * 50% overlap, down to 96x96), coarsest first.
+                 * Each window is converted into the same input tensor;
+                 * flat windows (variance below setMinTileVariance()) are skipped.
+                 * Stops at the first window above threshold, when the
+                 * time budget (micros, 0 = none) runs out or after
+                 * PERSON_DETECTION_MAX_TILES windows.
+                 * Results are in found, tiles, bestTile and heatmap,
+                 * allocated on the heap by the first search()
+                 */
+                Exception& search(const uint8_t *frame, uint16_t width, uint16_t height, PixelFormat format = PixelFormat::GRAY, uint32_t budgetMicros = 0) {
+                    const uint32_t startedAt = micros();
+                    const uint8_t bpp = Eloquent::TF::Image::bytesPerPixel(format);
+                    const size_t stride = (size_t) width * bpp;
+                    uint16_t side = width < height ? width : height;
+
+                    numTiles = 0;
+                    bestTile = -1;
+                    found = false;
+                    timedOut = false;
+
+                    // tiles and heatmap in a single block
+                    if (tiles == nullptr) {
+                        tiles = (Tile*) malloc(PERSON_DETECTION_MAX_TILES * sizeof(Tile) + PERSON_DETECTION_HEATMAP_SIZE * PERSON_DETECTION_HEATMAP_SIZE);
+
+                        if (tiles == nullptr)
+                            return exception.set(Eloquent::Error::ErrorCode::ALLOC, "Cannot allocate search() tiles");
+
+                        heatmap = (uint8_t*) (tiles + PERSON_DETECTION_MAX_TILES);
+                    }
+
+                    memset(heatmap, 0, PERSON_DETECTION_HEATMAP_SIZE * PERSON_DETECTION_HEATMAP_SIZE);
+
+                    Eloquent::TF::InputView<int8_t> input = tf.input<int8_t>();
+
+                    if (!input)
+                        return exception.set(tf.exception.code(), tf.exception.toCString());
+
+                    for (uint8_t level = 0; level < _searchLevels && (level == 0 || side >= 96); level++, side /= 2) {
+                        const uint16_t step = side / 2 > 0 ? side / 2 : 1;
+                        const uint16_t nx = (width - side + step - 1) / step + 1;
+                        const uint16_t ny = (height - side + step - 1) / step + 1;
+
+                        for (uint16_t j = 0; j < ny; j++) {
+                            for (uint16_t i = 0; i < nx; i++) {
+                                if (numTiles >= PERSON_DETECTION_MAX_TILES)
+                                    return exception.clear();
+
+                                if (budgetMicros && micros() - startedAt >= budgetMicros) {
+                                    timedOut = true;
+                                    return exception.clear();
+                                }
+
+                                Tile& tile = tiles[numTiles++];
+
+                                // spread windows evenly, first and last touch the borders
+                                tile.x = nx > 1 ? (uint32_t) i * (width - side) / (nx - 1) : (width - side) / 2;
+                                tile.y = ny > 1 ? (uint32_t) j * (height - side) / (ny - 1) : (height - side) / 2;
+                                tile.size = side;
+                                tile.score = 0;
+                                tile.skipped = false;
+
+                                Eloquent::TF::Image::toGrayInt8(frame + tile.y * stride + tile.x * bpp, side, side, format, input.data(), 96, 96, Fit::CROP, _interpolation, stride);
+
+                                if (Eloquent::TF::Image::variance(input.data(), input.length()) < _minTileVariance) {
+                                    tile.skipped = true;
+                                    continue;
+                                }
+
+                                if (!tf.invoke().isOk())
+                                    return exception.set(tf.exception.code(), tf.exception.toCString());
+
+                                tile.score = personScore();
+                                paintHeatmap(tile, width, height);
+
+                                if (bestTile < 0 || tile.score > tiles[bestTile].score)
+                                    bestTile = numTiles - 1;
+
+                                // early exit
+                                if (tile.score >= _thresh && tile.score > notPersonScore()) {
+                                    found = true;
+                                    return exception.clear();
+                                }
+                            }
+                        }
+                    }
+
+                    return exception.clear();
+                }
+
+                /**
+                 * Search for people in camera frame
+                 */
+                template<typename Camera>
+                Exception& search(Camera& camera, uint32_t budgetMicros = 0) {
+                    PixelFormat format;
+
+                    if (!frameFormat(camera.frame, format))
+                        return exception.set("Unsupported pixel format (JPEG?)");
+
+                    return search(camera.frame->buf, camera.frame->width, camera.frame->height, format, budgetMicros);
+                }
+
+                /**
+                 * Set number of scales searched by search()
+                 */
+                void setSearchLevels(uint8_t levels) {
+                    _searchLevels = levels;
+                }
+
+                /**
+                 * Set min pixel variance for a window to be classified
+                 * by search(). Set to 0 to classify every window
+                 */
+                void setMinTileVariance(float variance) {
+                    _minTileVariance = variance;
+                }
+
+                /**
+                 * Set how non-square frames are fitted
+                 * (center crop or letterbox)
+                 */
+                void setFit(Fit fit) {
+                    _fit = fit;
+                }
+
+                /**
+                 * Set how frames are downscaled
+                 * (area average or bilinear)
+                 */
+                void setInterpolation(Interpolation interpolation) {
+                    _interpolation = interpolation;
+                }
+
+                /**
+                 * Get person score (0-255).
+                 * 0 before begin() or after end()
                  * @return
                  */
                 uint8_t personScore() {
-                    return 128 + tf.output(1);
+                    return score(1);
                 }
 
                 /**
-                 *
+                 * Get not-person score (0-255).
+                 * 0 before begin() or after end()
                  * @return
                  */
                 uint8_t notPersonScore() {
-                    return 128 + tf.output(2);
+                    return score(0);
                 }
 
             protected:
                 uint8_t _thresh;
-                int8_t _buffer[96 * 96];
+                Fit _fit;
+                Interpolation _interpolation;
+                uint8_t _searchLevels;
+                float _minTileVariance;
+
+                /**
+                 * Get i-th output as 0-255 score
+                 * (0 = not person, 1 = person)
+                 */
+                uint8_t score(uint8_t i) {
+                    Eloquent::TF::OutputView y = tf.outputs();
+
+                    if (!y || i >= y.length())
+                        return 0;
+
+                    return 128 + y.int8(i);
+                }
+
+            #if defined(PERSON_DETECTION_ESP_CAMERA)
+                /**
+                 * Read pixel format of esp32-camera frame.
+                 * Its RGB888 is stored as BGR
+                 */
+                bool frameFormat(camera_fb_t *frame, PixelFormat& format) {
+                    switch (frame->format) {
+                        case PIXFORMAT_GRAYSCALE:
+                            format = PixelFormat::GRAY;
+                            return true;
+                        case PIXFORMAT_RGB565:
+                            format = PixelFormat::RGB565;
+                            return true;
+                        case PIXFORMAT_RGB888:
+                            format = PixelFormat::BGR888;
+                            return true;
+                        default:
+                            return false;
+                    }
+                }
+            #endif
+
+                /**
+                 * Infer pixel format from frame length
+                 * (frames without a format field)
+                 */
+                template<typename Frame>
+                bool frameFormat(Frame *frame, PixelFormat& format) {
+                    const size_t pixels = (size_t) frame->width * frame->height;
+
+                    if (frame->len == pixels)
+                        format = PixelFormat::GRAY;
+                    else if (frame->len == 2 * pixels)
+                        format = PixelFormat::RGB565;
+                    else if (frame->len == 3 * pixels)
+                        format = PixelFormat::RGB888;
+                    else
+                        return false;
+
+                    return true;
+                }
+
+                /**
+                 * Release tiles and heatmap
+                 */
+                void freeSearch() {
+                    ::free(tiles);
+                    tiles = nullptr;
+                    heatmap = nullptr;
+                }
+
+                /**
+                 * Raise heatmap cells whose center falls inside tile
+                 */
+                void paintHeatmap(const Tile& tile, uint16_t width, uint16_t height) {
+                    for (uint8_t cy = 0; cy < PERSON_DETECTION_HEATMAP_SIZE; cy++) {
+                        const uint16_t y = (uint32_t) (2 * cy + 1) * height / (2 * PERSON_DETECTION_HEATMAP_SIZE);
+
+                        if (y < tile.y || y >= tile.y + tile.size)
+                            continue;
+
+                        for (uint8_t cx = 0; cx < PERSON_DETECTION_HEATMAP_SIZE; cx++) {
+                            const uint16_t x = (uint32_t) (2 * cx + 1) * width / (2 * PERSON_DETECTION_HEATMAP_SIZE);
+                            uint8_t& cell = heatmap[cy * PERSON_DETECTION_HEATMAP_SIZE + cx];
+
+                            if (x >= tile.x && x < tile.x + tile.size && tile.score > cell)
+                                cell = tile.score;
+                        }
+                    }
+                }
             };
         }
     }
@@ -118,7 +471,22 @@ namespace Eloquent {
 namespace eloq {
     namespace tinyml {
         namespace zoo {
-            static Eloquent::TinyML::Zoo::PersonDetection personDetection;
+            /**
+             * Get the shared instance.
+             * It is constructed on first call, once for the whole
+             * firmware (not once per translation unit);
+             * the arena is only allocated by begin()
+             */
+            inline Eloquent::TinyML::Zoo::PersonDetection& getPersonDetection() {
+                static Eloquent::TinyML::Zoo::PersonDetection instance;
+
+                return instance;
+            }
+
+            /**
+             * Shared instance, under the name sketches already use
+             */
+            static Eloquent::TinyML::Zoo::PersonDetection& personDetection = getPersonDetection();
         }
     }
 }